@@ -0,0 +1,88 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+//////////////////////////////////
+// mnist_mlp_distributed.cpp:
+// The basic MLP for mnist, trained by several processes,
+// each one on its part of every batch.
+//
+// Setup file (e.g. job.cfg):
+//   workers 2
+//   transport unix
+//   address /tmp/eddl_mnist
+//   threads 2
+//   lsb 0
+//
+// Run on one box:
+//   EDDL_RANK=0 ./mnist_mlp_distributed job.cfg &
+//   EDDL_RANK=1 ./mnist_mlp_distributed job.cfg
+//////////////////////////////////
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s setup_file\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    compserv cs = CS_COMPSS(argv[1]);
+
+    // Download mnist once, the others wait for rank 0 in build
+    if (cs->rank == 0) download_mnist();
+
+    // Settings
+    int epochs = 1;
+    int batch_size = 100;
+    int num_classes = 10;
+
+    // Define network
+    layer in = Input({784});
+    layer l = in;  // Aux var
+
+    l = LeakyReLu(Dense(l, 1024));
+    l = LeakyReLu(Dense(l, 1024));
+    l = LeakyReLu(Dense(l, 1024));
+
+    layer out = Softmax(Dense(l, num_classes));
+    model net = Model({in}, {out});
+
+    // Build model, all the processes start from the weights of rank 0
+    build(net,
+          rmsprop(0.01), // Optimizer
+          {"soft_cross_entropy"}, // Losses
+          {"categorical_accuracy"}, // Metrics
+          cs
+    );
+
+    if (cs->rank == 0) summary(net);
+
+    // Load dataset
+    Tensor* x_train = Tensor::load("mnist_trX.bin");
+    Tensor* y_train = Tensor::load("mnist_trY.bin");
+    Tensor* x_test = Tensor::load("mnist_tsX.bin");
+    Tensor* y_test = Tensor::load("mnist_tsY.bin");
+
+    // Preprocessing
+    x_train->div_(255.0f);
+    x_test->div_(255.0f);
+
+    // Train model, every process draws the same batches and trains its part
+    fit(net, {x_train}, {y_train}, batch_size, epochs);
+
+    // Evaluate
+    if (cs->rank == 0) evaluate(net, {x_test}, {y_test});
+
+}
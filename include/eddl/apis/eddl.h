@@ -18,6 +18,8 @@
 
 #include "eddl/net/net.h"
 #include "eddl/net/netloss.h"
+#include "eddl/net/session.h"
+#include "eddl/net/batch_queue.h"
 #include "eddl/initializers/initializer.h"
 #include "eddl/regularizers/regularizer.h"
 #include "eddl/losses/loss.h"
@@ -77,13 +79,23 @@ typedef NetLoss * metric;
     */
     void build(model net, optimizer o, const vector<string> &lo, const vector<string> &me, CompServ *cs=nullptr, bool init_weights=true);
 
+    /**
+      *  @brief Builds the model for inference only. Only the params and the activations are allocated: there is no optimizer state, the gradients are released and the training functions (fit, evaluate, train_batch, backward, update) are refused.
+      *
+      *  @param net  Model
+      *  @param cs  Computing service
+      *  @param init_weights  Initialize the params (set to false when they are loaded later)
+      *  @return     (void)
+    */
+    void build_inference(model net, CompServ *cs=nullptr, bool init_weights=true);
+
     // Computing services
     /**
       *  @brief Assign model operations to the GPU.
       *
       *  @param net  Model
       *  @param g  Vector with gpu ids to allocate the model
-      *  @param lsb  Number of batches to sync model weights
+      *  @param lsb  Number of batches to sync model weights, 0 to average the gradients of every batch instead
       *  @return     (void)
     */
     void toGPU(model net, vector<int> g, int lsb);
@@ -156,7 +168,7 @@ typedef NetLoss * metric;
       *  @brief Executes de code in the GPU.
       *
       *  @param g  Vector of bools to set which GPUs will be used (1=on, 0=off)
-      *  @param lsb  (Multi-gpu setting) Number of batches to run before synchronizing the weights of the different GPUs
+      *  @param lsb  (Multi-gpu setting) Number of batches to run before synchronizing the weights of the different GPUs, 0 to average their gradients every batch instead
       *  @param mem  Indicates de memory consumption of the model. One of "full_mem" (default), "mid_mem" or "low_mem".
       *  @return     The computer service itself.
     */
@@ -166,7 +178,7 @@ typedef NetLoss * metric;
       *  @brief Executes de code in the GPU.
       *
       *  @param g  Vector of bools to set which GPUs will be used (1=on, 0=off)
-      *  @param lsb  (Multi-gpu setting) Number of batches to run before synchronizing the weights of the different GPUs
+      *  @param lsb  (Multi-gpu setting) Number of batches to run before synchronizing the weights of the different GPUs, 0 to average their gradients every batch instead
       *  @param mem  Indicates de memory consumption of the model. One of "full_mem" (default), "mid_mem" or "low_mem".
       *  @return     The computer service itself.
     */
@@ -177,15 +189,15 @@ typedef NetLoss * metric;
       *  @brief Executes de code in the FPGA.
       *
       *  @param f  Vector of bools to set which FPGAs will be used (1=on, 0=off)
-      *  @param lsb  (Multi-fpga setting) Number of batches to run before synchronizing the weights of the different FPGAs
+      *  @param lsb  (Multi-fpga setting) Number of batches to run before synchronizing the weights of the different FPGAs, 0 to average their gradients every batch instead
       *  @return     The computer service itself.
     */
     compserv CS_FGPA(const vector<int> &f,int lsb=1);
 
     /**
-      *  @brief Executes de code through the COMP Superscalar (COMPSs) framework.
+      *  @brief Executes de code as one of the processes of a data-parallel job. Every process runs the same program, trains on CPU its part of every batch and averages with the others, through Unix domain or TCP sockets, the gradients every batch (lsb 0) or the weights every lsb batches.
       *
-      *  @param filename  File with the setup specification
+      *  @param filename  File with the setup specification: workers, rank (or the EDDL_RANK environment variable), transport, address, threads, lsb and mem
       *  @return     The computer service itself.
     */
     compserv CS_COMPSS(string filename);
@@ -245,6 +257,45 @@ typedef NetLoss * metric;
     */
     void setlr(model net,vector<float>p);
 
+    /**
+      *  @brief  Sets the loss scale used to keep small gradients representable in mixed precision training.
+      *
+      *  @param net  Model
+      *  @param scale  Initial loss scale
+      *  @param dynamic  If true, the scale is halved when the gradients overflow (skipping that update) and doubled after "window" good steps
+      *  @param window  Number of steps without overflow before growing the scale
+      *  @return     (void)
+    */
+    void set_loss_scale(model net, float scale, bool dynamic=true, int window=2000);
+
+    /**
+      *  @brief  Emulates a reduced precision for the activations and deltas of the model: they are rounded to dtype after every layer, to check how the model trains with that precision. Weights, gradients and accumulations are kept in float32. The CPU/GPU kernels are float32 only, so activations are still stored in float32: the rounding is an extra pass over them and no memory is saved.
+      *
+      *  @param net  Model (already built)
+      *  @param dtype  One of "float32" (no rounding) or "bfloat16"
+      *  @return     (void)
+    */
+    void set_mixed_precision(model net, const string& dtype="bfloat16");
+
+    /**
+      *  @brief  Trains the model (on CPU) as a pipeline: its layers are split in stages that run on their own threads and cores, and every batch is split in micro-batches that go through the stages at the same time. Gradients are accumulated over the micro-batches and applied once per batch.
+      *
+      *  @param net  Model (already built)
+      *  @param stages  Number of stages, 0 goes back to the regular training
+      *  @param micro_batches  Number of micro-batches each batch is split into
+      *  @return     (void)
+    */
+    void set_pipeline(model net, int stages, int micro_batches);
+
+    /**
+      *  @brief  Overlaps the optimizer step with the backward: the weights of every layer are updated (and, with lsb=0, its gradients averaged over the devices) on their own thread as soon as its backward is done. Steps with loss scaling or gradient accumulation are not overlapped.
+      *
+      *  @param net  Model (already built)
+      *  @param enable  Overlap the updates or go back to updating all the layers after the backward
+      *  @return     (void)
+    */
+    void set_overlap_update(model net, bool enable=true);
+
 
     /**
       *  @brief Adadelta optimizer.
@@ -368,32 +419,74 @@ typedef NetLoss * metric;
       *  @param out  Output data (labels)
       *  @param batch  Number of samples per gradient update
       *  @param epochs  Number of epochs to train the model. An epoch is an iteration over the entire data provided
+      *  @param accumulation_steps  Number of micro-batches each batch is split into. Their gradients are accumulated and applied once per batch
       *  @return     (void) Trains the model
     */
-    void fit(model m, const vector<Tensor *> &in, const vector<Tensor *> &out, int batch, int epochs);
+    void fit(model m, const vector<Tensor *> &in, const vector<Tensor *> &out, int batch, int epochs, int accumulation_steps=1);
     /**
       *  @brief Returns the loss value & metrics values for the model in test mode.
       *
       *  @param m  Model to train
       *  @param in  Input data (features)
       *  @param out  Output data (labels)
+      *  @param bs  Samples per forward pass, the current batch size of the model if not given
       *  @return     (void) Evaluates the model
     */
-    void evaluate(model m, const vector<Tensor *> &in, const vector<Tensor *> &out);
+    void evaluate(model m, const vector<Tensor *> &in, const vector<Tensor *> &out, int bs=-1);
 
     /**
       *  @brief Performs a prediction with input data
       *
       *  @param m  Model
       *  @param in  Input data (features)
+      *  @param bs  Samples per forward pass, the current batch size of the model if not given. Memory does not grow with the number of samples
       *  @return    vector of output tensors.
     */
-    vector<Tensor *>  predict(model m, const vector<Tensor *> &in);
+    vector<Tensor *>  predict(model m, const vector<Tensor *> &in, int bs=-1);
+
+    /**
+      *  @brief Post-training int8 quantization. Calibrates the activation ranges of the Dense and Conv layers with the given samples and quantizes their weights. The int8 path is used in inference (CPU only). Depthwise Conv, MatMul and MultiHeadAttention layers are kept in float32. Nets built with build_inference release the float32 weights of the quantized layers (4x less weight memory), so they can not be saved, loaded or quantized again; other nets keep them to go on training.
+      *
+      *  @param m  Model
+      *  @param in  Calibration data (features)
+      *  @param per_channel  Quantize the weights with one scale per output channel (true) or per tensor (false)
+      *  @return    (void)
+    */
+    void quantize(model m, const vector<Tensor *> &in, bool per_channel=true);
+
+    /**
+      *  @brief Creates an inference session over a built model. Sessions share the weights of the model and own their activations, so several threads can predict at the same time with one session each.
+      *
+      *  @param m  Model
+      *  @param max_batch  Maximum number of samples per forward pass. Larger inputs are processed in chunks
+      *  @return    (InferenceSession*) The session, to be deleted by the caller before the model
+    */
+    InferenceSession* inference_session(model m, int max_batch);
+
+    /**
+      *  @brief Creates a queue that groups single-sample requests from several threads into batches, run as one forward over the model. See BatchQueue::submit and BatchQueue::stats.
+      *
+      *  @param m  Model
+      *  @param max_batch  Maximum number of requests per batch
+      *  @param max_wait_us  Maximum time (microseconds) a request waits for the batch to fill
+      *  @return    (BatchQueue*) The queue, to be deleted by the caller before the model
+    */
+    BatchQueue* batch_queue(model m, int max_batch, int max_wait_us);
 
 
     // Finer methods
     vector<int> random_indices(int batch_size, int num_samples);
-    void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices);
+    /**
+      *  @brief Trains the model with the samples selected by indices.
+      *
+      *  @param net  Model to train
+      *  @param in  Input data (features)
+      *  @param out  Output data (labels)
+      *  @param indices  Indices of the samples of the batch
+      *  @param accumulation_steps  Number of micro-batches the batch is split into. Their gradients are accumulated and applied once
+      *  @return     (void)
+    */
+    void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices, int accumulation_steps=1);
     void eval_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices);
     void next_batch(vector<Tensor *> in,vector<Tensor *> out);
     void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out);
@@ -664,8 +757,8 @@ typedef NetLoss * metric;
       *  @param strides  Vector of 2 integers, specifying the strides of the convolution along the height and width
       *  @param padding  One of "none", "valid" or "same"
       *  @param use_bias  Boolean, whether the layer uses a bias vector.
-      *  @param groups  Number of blocked connections from input channels to output channels
-      *  @param dilation_rate  Vector of 2 integers, specifying the dilation rate to use for dilated convolution
+      *  @param groups  Number of blocked connections from input channels to output channels. Use as many groups as input channels for a depthwise convolution (CPU only)
+      *  @param dilation_rate  Vector of 2 integers, specifying the dilation rate to use for dilated convolution (CPU only)
       *  @param name  A name for the operation
       *  @return     Convolution layer
     */
@@ -704,6 +797,37 @@ typedef NetLoss * metric;
     */
     layer Dense(layer parent, int ndim, bool use_bias = true,  string name = "");
 
+    /**
+      *  @brief Multi-head scaled dot-product self-attention.
+      *
+      *  @details
+      *   The input (batch x length x features) is projected into queries, keys and values of num_heads heads,
+      *   softmax(QK^T/sqrt(head_dim))V is computed for every head and the heads are projected back to the input features.
+      *   The CPU kernel works on tiles with an online softmax, so memory grows linearly with the sequence length.
+      *
+      *  @param parent  Parent layer
+      *  @param num_heads  Number of attention heads
+      *  @param head_dim  Size of each head for queries, keys and values
+      *  @param causal  Whether each position only attends to the previous ones
+      *  @param use_bias  Boolean, whether the projections use a bias vector
+      *  @param name  A name for the operation
+      *  @return     Output of the attention, with the shape of the input
+    */
+    layer MultiHeadAttention(layer parent, int num_heads, int head_dim, bool causal = false, bool use_bias = true, string name = "");
+
+    /**
+      *  @brief Multi-head scaled dot-product attention of a query sequence over another sequence (cross-attention).
+      *
+      *  @param query  Layer with the queries (batch x length x features)
+      *  @param memory  Layer the keys and values are computed from (batch x length' x features')
+      *  @param num_heads  Number of attention heads
+      *  @param head_dim  Size of each head for queries, keys and values
+      *  @param use_bias  Boolean, whether the projections use a bias vector
+      *  @param name  A name for the operation
+      *  @return     Output of the attention, with the shape of the query
+    */
+    layer MultiHeadAttention(layer query, layer memory, int num_heads, int head_dim, bool use_bias = true, string name = "");
+
     /**
       *  @brief Applies Dropout to a layer.
       *
@@ -771,17 +895,17 @@ typedef NetLoss * metric;
       *  @param filters  the dimensionality of the output space (i.e. the number of output filters in the convolution).
       *  @param kernel_size  the height and width of the 2D convolution window.
       *  @param output_padding  the amount of padding along the height and width of the output tensor. The amount of output padding along a given dimension must be lower than the stride along that same dimension
-      *  @param padding  one of "valid" or "same"
+      *  @param padding  one of "valid" or "same" ("same" outputs input size times the strides)
       *  @param dilation_rate  the dilation rate to use for dilated convolution. Spacing between kernel elements.
       *  @param strides  the strides of the convolution along the height and width.
       *  @param use_bias  Boolean, whether the layer uses a bias vector.
       *  @param name  A name for the operation.
-      *  @return     Output layer after upsampling operation
+      *  @return     Output of the transposed convolution (only available on CPU)
     */
     layer ConvT(layer parent, int filters, const vector<int> &kernel_size,
                 const vector<int> &output_padding, string padding = "same",
                 const vector<int> &dilation_rate = {1, 1},
-                const vector<int> &strides = {1, 1}, bool use_bias = true, string name = ""); //Todo: Implement
+                const vector<int> &strides = {1, 1}, bool use_bias = true, string name = "");
 
     /**
       *  @brief Turns positive integers (indexes) into dense vectors of fixed size. eg. [[4], [20]] -> [[0.25, 0.1], [0.6, -0.2]]
@@ -1118,6 +1242,16 @@ typedef NetLoss * metric;
     */
     layer Concat(const vector<layer> &layers, unsigned int axis=1, string name = "");
 
+    /**
+      *  @brief Layer that multiplies two inputs as batches of matrices.
+      *
+      *  @details
+      *   The last two dimensions hold the matrices (m x k and k x n) and the leading dimensions, batch included, must match.
+      *
+      *  @param layers  List with the two layers
+      *  @param name  A name for the operation
+      *  @return     Output of the batched matrix product (... x m x n)
+    */
     layer MatMul(const vector<layer> &layers, string name = "");
 
     /**
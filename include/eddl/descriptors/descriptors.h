@@ -14,6 +14,7 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <cstdint>
 
 #include "Eigen/Dense"
 
@@ -63,17 +64,22 @@ public:
     vector<int> ksize;
     vector<int> stride;
     vector<int> pad; // {rows-top, rows-bottom, cols-left, cols-right}
+    vector<int> dilation; // distance between kernel taps {rows, cols}
     string padding; // valid/none, same/zeros, custom
 
     int nk, kr, kc, kz;
     int sr, sc;
+    int dr, dc;
     int ir, ic, iz;
     int r, c, z;
     int padrt,padrb;
     int padcl,padcr;
+    int groups; // input channels are split in groups, kz=iz/groups per filter
     int size;
     bool use_bias;
     int mem_level; // see CS
+    int act = GEMM_ACT_NONE; // activation fused into the output (GEMM_ACT_*)
+    float act_param = 0.0f;
 
     Tensor *I= nullptr; // Input map
     Tensor *ID= nullptr;// Delta input map
@@ -105,13 +111,14 @@ public:
 
     ConvolDescriptor();
 
-    ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool use_bias, int mem=0);
+    ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool use_bias, int mem=0, int groups=1, const vector<int> &dil={1, 1});
 
-    ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem=0);
+    ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem=0, int groups=1, const vector<int> &dil={1, 1});
 
     void build(Tensor *A);
     void resize(int b);
 	void enable_distributed();
+    bool is_depthwise();
 
 	static int compute_output(const string& padding, int input_size, int kerkel_size, int stride, int dilation_rate=1);
 	static int compute_output(vector<int> padding, int input_size, int kerkel_size, int stride, int dilation_rate=1);
@@ -122,7 +129,8 @@ public:
 
 class PoolDescriptor : public ConvolDescriptor {
 public:
-    Tensor *indX, *indY; // indexes
+    Tensor *indX, *indY; // indexes (GPU)
+    vector<int> ind; // argmax as an offset in the input plane, -1 for a window in the padding (CPU)
     int mem_level; // see CS
 
     PoolDescriptor(const vector<int> &ks, const vector<int> &st, const string& p, int mem=0);
@@ -133,4 +141,82 @@ public:
     void resize(int b);
 };
 
+// Scaled dot-product attention over several heads: O = softmax(Q*K^T*scale)*V.
+// Q, K, V and O hold one row per (sample, position), with the heads side by
+// side: (batch*length) x (heads*head_dim). The kernels work on tiles of rows
+// with an online softmax, so the lq x lk attention matrix is never stored.
+class AttentionDescriptor {
+public:
+    int heads, head_dim;
+    bool causal; // position i only attends to positions <= i
+    float scale;
+    int tile; // rows per tile
+    int batch, lq, lk;
+    int mem_level; // see CS
+
+    Tensor *Q, *K, *V, *O;
+    Tensor *L; // log-sum-exp of every attention row (batch x heads x lq), kept for backward
+
+    Tensor *dQ, *dK, *dV, *dO;
+
+    AttentionDescriptor(int heads, int head_dim, bool causal, int mem=0);
+    ~AttentionDescriptor();
+
+    void build(int batch, int lq, int lk, int dev);
+    void resize(int b);
+};
+
+// Post-training int8 quantization of a linear layer (Dense, Conv).
+// Weights are stored channel-major (one row of K elements per output
+// channel) as symmetric int8; activations as asymmetric uint8.
+#define QUANT_NB 16 // filters of a block of packed weights
+
+class QuantDescriptor {
+public:
+    int channels; // output channels (N)
+    int ksize; // reduction size (K)
+    int groups; // filters split in groups of channels/groups, each one a GEMM
+    int kpad; // ksize rounded up to 4
+    bool per_channel;
+    bool calibrating;
+    bool quantized;
+
+    // Calibrated ranges
+    float in_min, in_max;
+    float out_min, out_max;
+
+    // Input (uint8) quantization
+    float in_scale;
+    int in_zero;
+
+    // Output (uint8) quantization, only used on export
+    float out_scale;
+    int out_zero;
+
+    // Weights (int8) quantization
+    vector<float> w_scale;
+    vector<int> w_sum; // sum of each weight row, to remove the input zero point
+
+    // Int8 weights packed for the GEMM kernels (the only copy kept): per
+    // group, blocks of QUANT_NB filters where every 4 consecutive k of the
+    // QUANT_NB filters are contiguous
+    vector<int8_t> pW;
+
+    // Scratch buffer for the quantized input, rows of kpad
+    vector<uint8_t> qI;
+
+    QuantDescriptor(int channels, int ksize, int groups=1);
+
+    void reset_ranges();
+    void observe(Tensor *in, Tensor *out);
+
+    // Quantizes W, given as a KxN matrix with stride (sk, sn) between elements
+    void quantize(const float *W, int sk, int sn, bool per_channel);
+    void pack(const vector<int8_t> &qW);
+    int blocks(); // packed blocks of a group
+    int8_t weight(int n, int k); // int8 weight k of filter n, read from pW
+
+    static void compute_params(float min, float max, float &scale, int &zero);
+};
+
 #endif //EDDL_DESCRIPTORS_H
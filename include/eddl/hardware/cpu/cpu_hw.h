@@ -12,6 +12,7 @@
 
 #include "eddl/tensor/tensor.h"
 #include "eddl/tensor/tensor_reduction.h"
+#include "eddl/tensor/tensor_expr.h"
 #include "eddl/descriptors/descriptors.h"
 
 #define MAX_FLOAT std::numeric_limits<float>::max()
@@ -91,6 +92,7 @@ void cpu_powb_(Tensor *A, float base);
 void cpu_reciprocal_(Tensor *A);
 void cpu_remainder_(Tensor *A, float v);
 void cpu_round_(Tensor *A);
+void cpu_round_bfloat16_(Tensor *A);
 void cpu_rsqrt_(Tensor *A);
 void cpu_sigmoid_(Tensor *A);
 void cpu_sign_(Tensor *A);
@@ -106,12 +108,18 @@ void cpu_trunc_(Tensor *A);
 void cpu_add(float scA, Tensor *A, float scB, Tensor *B, Tensor *C, int incC);
 void cpu_inc(Tensor *A, Tensor *B);
 void cpu_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC);
+void cpu_gemm(float alpha, Tensor *A, int tA, Tensor *B, int tB, float beta, Tensor *C, Tensor *bias, int act, float act_param);
+void cpu_batched_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC);
+void cpu_act_epilogue(float *ptr, int size, int act, float act_param);
 void cpu_el_div(Tensor *A, Tensor *B, Tensor *C, int incC);
 void cpu_el_mult(Tensor *A, Tensor *B, Tensor *C, int incC);
 void cpu_sign2(Tensor *A, Tensor *B); // TODO: Remove
 void cpu_sum2D_rowwise(Tensor *A, Tensor *B, Tensor *C);
 void cpu_sum2D_colwise(Tensor *A, Tensor *B, Tensor *C);
 
+// CPU: Fused elementwise expressions, returns the sum of the reduced statements
+float cpu_eval(ExprProgram *P);
+
 // CPU: Should be reductions
 float cpu_max(Tensor *A);
 float cpu_min(Tensor *A);
@@ -17,6 +17,7 @@
 // Aux
 float get_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsize);
 void add_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsize,float val);
+void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im,int zoff=0);
 
 // Activations
 void cpu_relu(Tensor *A, Tensor *B);
@@ -66,9 +67,29 @@ void cpu_conv2D(ConvolDescriptor *D);
 void cpu_conv2D_grad(ConvolDescriptor *D);
 void cpu_conv2D_back(ConvolDescriptor *D);
 
+void cpu_convT2D(ConvolDescriptor *D, Tensor *A, Tensor *B);
+void cpu_convT2D_grad(ConvolDescriptor *D, Tensor *A, Tensor *DB);
+void cpu_convT2D_back(ConvolDescriptor *D, Tensor *DB, Tensor *DA);
+
+// Int8 inference (see QuantDescriptor)
+#define INT8_SCALAR 0
+#define INT8_AVX2 1
+#define INT8_VNNI 2 // AVX512-VNNI
+void cpu_dense_int8(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *B);
+void cpu_conv2D_int8(ConvolDescriptor *D, QuantDescriptor *Q);
+// GEMM kernels in use, the best one of the CPU unless forced (-1 goes back to it)
+int cpu_int8_isa();
+void cpu_set_int8_isa(int isa);
+
+// Attention (tiled, online softmax)
+void cpu_attention(AttentionDescriptor *D);
+void cpu_attention_back(AttentionDescriptor *D);
+
 // MaxPool
 void cpu_mpool2D(PoolDescriptor*D);
 void cpu_mpool2D_back(PoolDescriptor *D);
+void cpu_mpool1D(PoolDescriptor*D);
+void cpu_mpool1D_back(PoolDescriptor *D);
 
 // AvgPool
 void cpu_avgpool2D(PoolDescriptor*D);
@@ -83,4 +104,15 @@ void cpu_permute_channels_first(Tensor *A,Tensor *B);
 void cpu_permute_channels_last(Tensor *A,Tensor *B);
 void cpu_permute_batch_first(Tensor *A,Tensor *B);
 void cpu_permute_batch_last(Tensor *A,Tensor *B);
+
+// Row-sparse updates (only the listed rows of 2D tensors are touched)
+void cpu_zero_rows(Tensor *A, const vector<int> &rows);
+void cpu_inc_rows(Tensor *D, Tensor *G, const vector<int> &ids, const vector<int> &start, const vector<int> &order, bool mask_zeros);
+void cpu_sgd_rows(Tensor *W, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu);
+void cpu_adam_rows(Tensor *W, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1, float beta_2, float epsilon, int t);
+void cpu_rmsprop_rows(Tensor *W, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon);
+
+// LayerNorm, GroupNorm (row-wise, native layout)
+void cpu_layernorm(Tensor *A, Tensor *B, Tensor *opa, Tensor *mean, Tensor *sd, Tensor *gamma, Tensor *beta, int rows, float epsilon);
+void cpu_layernorm_back(Tensor *D, Tensor *opa, Tensor *sd, Tensor *gamma, Tensor *ggamma, Tensor *gbeta, Tensor *PD, int rows);
 #endif //EDDL_CPU_NN_H
@@ -30,6 +30,7 @@ public:
 	bool distributed_training;
 
     ConvolDescriptor *cd;
+    QuantDescriptor *qd;
 
     // constructors and clones
     LConv(Layer *parent, const vector<int> &ks, const vector<int> &st, const vector<int> &p, string name, int dev, int mem);
@@ -45,12 +46,15 @@ public:
 
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
+    void share_params(LConv *n);
+
     void mem_delta() override;
 
     // implementation
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     void resize(int batch) override;
 
@@ -68,32 +72,68 @@ public:
 
 	void enable_distributed() override;
 
+	void enable_calibration() override;
+
+	void quantize(bool per_channel) override;
+
+	void free_float_weights() override;
+
+};
+
+/// Conv1D Layer (batch x channels x length), a single row for the ConvolDescriptor
+class LConv1D : public LConv {
+public:
+    static int total_layers;
+
+    // constructors and clones
+    LConv1D(Layer *parent, int filters, const vector<int> &kernel_size, const vector<int> &strides, string padding,
+            int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem);
+
+    LConv1D(Layer *parent, ConvolDescriptor *cd, string name, int dev, int mem);
+
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+    static void reset_name_counter();
+
 };
 
-/// ConvT2D Layer
+/// ConvT2D Layer, the transpose of the convolution (cd) from its output to its input
 class LConvT : public LinLayer {
 public:
     static int total_layers;
+    vector<int> output_padding; // extra output rows and cols, over the size given by the padding
+
+    ConvolDescriptor *cd;
 
     // constructors and clones
     LConvT(Layer *parent, int filters, const vector<int> &kernel_size,
            const vector<int> &output_padding, string padding, const vector<int> &dilation_rate,
            const vector<int> &strides, bool use_bias, string name, int dev, int mem);
 
-    LConvT(Layer *parent, ConvolDescriptor *cd, string name, int dev, int mem);
-
-//    Layer *share(int c, int bs, vector<Layer *> p) override;
-//
-//    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
-//
-//    // Params are in ConvolDescriptor
-//
-//    // implementation
-//    void forward() override;
-//
-//    void backward() override;
-//
-//    string plot(int c) override;
+    LConvT(Layer *parent, int filters, ConvolDescriptor *cd, const vector<int> &output_padding, string name, int dev, int mem);
+
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+    // Params are in ConvolDescriptor
+
+    // implementation
+    void forward() override;
+
+    void backward() override;
+    void free_grads() override;
+
+    void resize(int batch) override;
+
+    string plot(int c) override;
+
+    static void reset_name_counter();
+
+private:
+    void setup(Layer *parent, int filters, ConvolDescriptor *D);
 
 };
 
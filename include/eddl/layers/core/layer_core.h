@@ -89,6 +89,14 @@ public:
     Tensor *E;
     Tensor *gE;
     vector<int> sind;
+    // Row-sparse gE (CPU): words of the batch grouped as uids[k] at the
+    // positions uorder[ustart[k]..ustart[k+1]), and rows touched since the
+    // last zeroGrads. Shared copies (unrolled nets, lanes) record their rows
+    // in the grows/touched of master, the layer that owns gE.
+    vector<int> uids, ustart, uorder;
+    vector<int> grows;
+    vector<unsigned char> touched;
+    LEmbedding *master;
     static int total_layers;
 
     LEmbedding(Layer *parent, int vocsize, int lenght, int dim, bool mask_zeros, string name, int dev, int mem);
@@ -100,6 +108,12 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
+
+    void zeroGrads() override;
+
+    vector<int> *sparse_rows(int j) override;
+    void add_sparse_rows(int j, const vector<int> &rows) override;
 
     string plot(int c) override;
 
@@ -112,6 +126,10 @@ public:
     int ndim;
     bool use_bias;  // TODO: Implement
 	bool distributed_training;
+    QuantDescriptor *qd;
+    int act;  // activation fused into the output by Net::fuse_activations (GEMM_ACT_*)
+    float act_param;
+    float alpha;  // scale of the input, a Dropout folded by Net::alias_eval (CPU)
 
     LDense(Layer *parent, int ndim, bool use_bias, string name, int dev, int mem);
 
@@ -130,6 +148,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
 	// Sets the weights to the values of the parameter w
 	void update_weights(Tensor* w, Tensor* bias=nullptr) override;
@@ -148,6 +167,12 @@ public:
 
 	void enable_distributed() override;
 
+	void enable_calibration() override;
+
+	void quantize(bool per_channel) override;
+
+	void free_float_weights() override;
+
 };
 
 /// Activation Layer
@@ -156,8 +181,10 @@ public:
     string act;
     static int total_layers;
     vector<float> params;
+    bool fused;  // computed as the epilogue of its parent, output is the parent's
 
     LActivation(Layer *parent, string act, vector<float> params, string name, int dev, int mem);
+    ~LActivation() override;
 
     Layer *share(int c, int bs, vector<Layer *> p) override;
 
@@ -166,12 +193,55 @@ public:
     void save(std::ofstream &ofs, string format) override;
     void load(std::ifstream &ifs, string format) override;
 
+    void resize(int batch) override;
+
+    void forward() override;
+
+    void backward() override;
+
+    string plot(int c) override;
+
+};
+
+/// MultiHeadAttention Layer
+class LMultiHeadAttention : public MLayer {
+public:
+    static int total_layers;
+    int num_heads;
+    int head_dim;
+    bool use_bias;
+    AttentionDescriptor *ad;
+
+    // Queries come from parent[0], keys and values from the last parent (self-attention if only one)
+    LMultiHeadAttention(vector<Layer *> parent, int num_heads, int head_dim, bool causal, bool use_bias, string name, int dev, int mem);
+    ~LMultiHeadAttention() override;
+
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+    // Params
+    Tensor *Wq, *Wk, *Wv, *Wo;
+    Tensor *bq, *bk, *bv, *bo;
+    Tensor *gWq, *gWk, *gWv, *gWo;
+    Tensor *gbq, *gbk, *gbv, *gbo;
+
+    // 2D views (rows x features) of the 3D inputs, output and deltas
+    Tensor *xq, *xkv, *out2, *dout2, *dxq, *dxkv;
+
+    void resize(int batch) override;
+
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
+
+    void enable_calibration() override;
 
     string plot(int c) override;
 
+    static void reset_name_counter();
+
 };
 
 /// Reshape Layer
@@ -191,6 +261,7 @@ public:
     // implementation
     void mem_delta() override;
     void free_delta() override;
+    bool shares_parent_delta() override { return true; }
 
     void forward() override;
 
@@ -243,6 +314,8 @@ public:
 
     // implementation
     void forward() override;
+    // The 1-df scaling (iw) is folded into the next Dense by Net::alias_eval
+    bool eval_identity() override { return true; }
 
     void backward() override;
     void resize(int batch) override;
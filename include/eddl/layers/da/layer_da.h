@@ -31,6 +31,7 @@ public:
 
     void mem_delta() override;
     void free_delta() override;
+    bool shares_parent_delta() override { return true; }
 
 //    void resize(int batch) override;
 
@@ -197,6 +198,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -220,6 +222,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -242,6 +245,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -262,6 +266,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -282,6 +287,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -303,6 +309,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -325,6 +332,7 @@ public:
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -43,6 +43,7 @@ public:
     bool isrecurrent;
     bool isshared;
     bool isnorm;
+    Tensor *own_output; // holds the output data while the output aliases the input (Net::alias_eval)
 
     vector<Tensor *> params;
     vector<Tensor *> gradients;
@@ -52,10 +53,15 @@ public:
 
   	vector<Tensor *> acc_gradients;
 
+    // Compressed exchange (distributed module)
+    vector<Tensor *> comp_residuals; // Compression error, added to the next exchange
+    vector<Tensor *> sync_params; // Params as seen by the other nodes (weights delta exchange)
+
     vector<Layer *> parent;
     vector<Layer *> child;
 
     Regularizer *reg;
+    bool hold_reg; // backward does not apply reg (micro-batches but the last one)
     Initializer *init;
 
     int mode;
@@ -106,6 +112,17 @@ public:
     virtual void reset();
     virtual int get_trainable_params_count();
     virtual void zeroGrads();
+    // Inference only: gradients are released, entries are kept as nullptr
+    virtual void free_grads();
+    // Rows of gradients[j] that can be non-zero, nullptr when it is dense
+    virtual vector<int> *sparse_rows(int j) { return nullptr; }
+    // Adds rows to sparse_rows(j), e.g. the ones other replicas touched
+    virtual void add_sparse_rows(int j, const vector<int> &rows) {}
+    // The output equals the input in TSMODE, so it can alias it
+    virtual bool eval_identity() { return false; }
+    void alias_input(bool on);
+    // The delta is the parent's delta (see mem_delta), its children write into it
+    virtual bool shares_parent_delta() { return false; }
     virtual string plot(int c) { return ""; }
 
     virtual void addchild(Layer *l) {}
@@ -130,6 +147,16 @@ public:
 
 	virtual void enable_distributed() {}
 
+	// Post-training quantization: record ranges on the next forwards
+	virtual void enable_calibration() {}
+
+	// Post-training quantization: quantize the weights with the recorded ranges
+	virtual void quantize(bool per_channel) {}
+
+	// Inference only: frees the data of the float32 weights replaced by int8
+	// ones, the tensors (and their shapes) are kept
+	virtual void free_float_weights() {}
+
 };
 
 
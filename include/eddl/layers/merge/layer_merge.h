@@ -78,6 +78,8 @@ public:
 
     void backward() override;
 
+    void enable_calibration() override;
+
     string plot(int c) override;
 
 };
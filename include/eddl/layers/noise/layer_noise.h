@@ -40,8 +40,10 @@ public:
 
     void mem_delta() override;
     void free_delta() override;
+    bool shares_parent_delta() override { return true; }
 
     void forward() override;
+    bool eval_identity() override { return true; }
 
     void backward() override;
 
@@ -62,6 +62,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     void initialize() override;
 
@@ -93,6 +94,8 @@ public:
 
     LLayerNorm(Layer *parent, float epsilon, bool affine, string name, int dev, int mem);
 
+    ~LLayerNorm();
+
     Layer *share(int c, int bs, vector<Layer *> p) override;
 
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
@@ -106,6 +109,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     string plot(int c) override;
 };
@@ -132,6 +136,8 @@ public:
 
     LGroupNorm(Layer *parent, int g,  float epsilon, bool affine,string name, int dev, int mem);
 
+    ~LGroupNorm();
+
     Layer *share(int c, int bs, vector<Layer *> p) override;
 
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
@@ -139,6 +145,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     void initialize() override;
 
@@ -66,6 +66,26 @@ public:
 
 };
 
+/// MaxPool1D Layer (batch x channels x length), a single row for the PoolDescriptor
+class LMaxPool1D : public LMaxPool {
+public:
+
+    // constructors and clones
+    LMaxPool1D(Layer *parent, const vector<int> &pool_size, const vector<int> &strides, const string& padding, const string& name, int dev, int mem);
+
+    LMaxPool1D(Layer *parent, PoolDescriptor *cd, const string& name, int dev, int mem);
+
+    // implementation
+    void forward() override;
+
+    void backward() override;
+
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+};
+
 /// AveragePool2D Layer
 class LAveragePool : public LPool {
 public:
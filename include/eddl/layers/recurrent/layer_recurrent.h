@@ -52,6 +52,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     string plot(int c) override;
 };
@@ -108,6 +109,7 @@ public:
     void forward() override;
 
     void backward() override;
+    void free_grads() override;
 
     string plot(int c) override;
 };
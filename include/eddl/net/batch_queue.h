@@ -0,0 +1,88 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_BATCH_QUEUE_H
+#define EDDL_BATCH_QUEUE_H
+
+#include <vector>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+#include "eddl/net/session.h"
+
+using namespace std;
+
+// Buckets of the power of two histograms: bucket k counts values in [2^k, 2^(k+1)),
+// bucket 0 also counts 0
+#define BQ_BUCKETS 32
+
+class BatchQueueStats {
+public:
+    long requests;
+    long batches;
+    int queue_depth;           // requests waiting now
+    vector<long> batch_size;   // batch_size[b]: batches of b samples
+    vector<long> depth;        // queue depth seen by each request, power of two buckets
+    vector<long> latency;      // submit to result (us), power of two buckets
+
+    BatchQueueStats(int max_batch);
+
+    // Value below which a fraction q of the latencies fall (upper bound of its bucket)
+    long latency_quantile(float q);
+};
+
+// Coalesces single-sample requests from any number of threads into batches
+// that run as one forward over an InferenceSession of the net. A batch is
+// launched when max_batch requests are waiting or the oldest one has waited
+// max_wait_us.
+class BatchQueue {
+public:
+    Net *net;
+    int max_batch;
+    int max_wait_us;
+
+    BatchQueue(Net *net, int max_batch, int max_wait_us);
+    // Pending requests are served before the worker stops
+    ~BatchQueue();
+
+    // One CPU tensor per input of the net with the size of a sample (with or
+    // without the batch dimension). The result has one tensor per output with
+    // batch 1, owned by the caller.
+    future<vtensor> submit(vtensor sample);
+
+    BatchQueueStats stats();
+
+private:
+    typedef chrono::steady_clock clock;
+
+    struct Request {
+        vtensor in;
+        promise<vtensor> out;
+        clock::time_point t;
+    };
+
+    InferenceSession *session;
+    vector<int> in_size;   // elements per sample of every input
+
+    deque<Request *> queue;
+    mutex mtx;
+    condition_variable cv;
+    bool stop;
+    BatchQueueStats st;
+    thread worker;
+
+    void run();
+    void run_batch(vector<Request *> &batch);
+};
+
+#endif //EDDL_BATCH_QUEUE_H
@@ -0,0 +1,67 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_CLUSTER_H
+#define EDDL_CLUSTER_H
+
+#include <string>
+#include <vector>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/net/compserv.h"
+
+using namespace std;
+
+#define CLUSTER_TIMEOUT 60       // seconds to wait for the other processes
+#define CLUSTER_SEGMENT 65536    // floats per message
+
+// The processes (ranks) of a distributed computing service, see
+// CompServ(filename). They are linked in a ring through Unix domain or TCP
+// sockets: every rank sends to rank+1 and receives from rank-1. The tensors of
+// a collective are seen as one flat vector split in one chunk per rank, and
+// chunks travel in segments, so a rank reduces (or forwards) a segment while
+// the next one is still on its way.
+class Cluster {
+public:
+    int rank;
+    int workers;
+    float weight;   // samples of the last shard, times workers, over the ones of its batch
+
+    // transport "unix": address is a path prefix, rank r listens on <address>.<r>
+    // transport "tcp": address is host:port, rank r listens on port+r of hosts[r] (host if not given)
+    Cluster(int rank, int workers, const string &transport, const string &address, const vector<string> &hosts={});
+    explicit Cluster(CompServ *cs);
+    ~Cluster();
+
+    // Sum (or average) of the tensors of all the ranks, in all of them
+    void all_reduce(const vector<Tensor *> &T, bool average);
+    // Tensors of root, in all the ranks
+    void broadcast(const vector<Tensor *> &T, int root=0);
+    // Part of the samples trained by this rank, sizes differ by one at most
+    vector<int> shard(const vector<int> &sind);
+
+private:
+    string transport;
+    string path;        // socket file of this rank (unix)
+    int listen_fd;
+    int send_fd;        // to rank+1
+    int recv_fd;        // from rank-1
+    vector<float> buf;
+    vector<float> seg;
+
+    void connect_ring(const string &address, const vector<string> &hosts);
+    void send_all(const float *p, long n);
+    void recv_all(float *p, long n);
+    void exchange(long si, long se, long ri, long re, bool sum);
+    void chunk(int c, long size, long &ini, long &end);
+    void gather(const vector<Tensor *> &T, long size);
+    void scatter(const vector<Tensor *> &T);
+};
+
+#endif //EDDL_CLUSTER_H
@@ -0,0 +1,56 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_COLLECTIVES_H
+#define EDDL_COLLECTIVES_H
+
+#include <vector>
+
+#include "eddl/tensor/tensor.h"
+
+using namespace std;
+
+#define AR_RING 0     // n-1 steps of 1/n of the data
+#define AR_HALVING 1  // recursive halving and doubling, log2(n) steps (n power of two, else ring)
+
+// Collectives over the replicas of a list of tensors (e.g. the params or the
+// gradients of every snet). The tensors of a replica are seen as one flat
+// vector split in one chunk per replica. At every step each replica exchanges
+// one chunk with another one, all the replicas at the same time, and the
+// chunks written and read in a step never overlap. Replicas can be on any
+// device, transfers between two accelerators go through the host.
+class Collective {
+public:
+    int n;       // replicas
+    int algo;
+    long size;   // elements of a replica
+
+    // R[i] are the tensors of replica i, the same shapes in all of them
+    Collective(vector<vector<Tensor *>> R, int algo=AR_RING);
+
+    // Afterwards replica i holds in chunk(i) the sum of all the replicas
+    void reduce_scatter();
+    // Every replica i sends its chunk(i) to all the others
+    void all_gather();
+    // Sum (or average) of all the replicas, in all of them
+    void all_reduce(bool average);
+
+    // Elements [ini, end) of the flat vector that replica i reduces
+    void chunk(int i, long &ini, long &end);
+
+private:
+    vector<vector<Tensor *>> R;
+    vector<long> offset;   // first element of every tensor
+
+    void chunks(int lo, int hi, long &ini, long &end);
+    void transfer(int src, int dst, long ini, long end, bool sum);
+    void scale(int i, long ini, long end, float f);
+};
+
+#endif //EDDL_COLLECTIVES_H
@@ -25,7 +25,7 @@ public:
     int local_threads;
     vector<int> local_gpus;
     vector<int> local_fpgas;
-    int lsb; //local sync batches
+    int lsb; //local sync batches, 0: gradients averaged every batch
     bool isshared;
 
 
@@ -36,6 +36,14 @@ public:
     // 2: low memory. save memory as much as possible
     int mem_level;
 
+    // for distributed: this process (rank) among workers, and how to reach
+    // the others (see Cluster)
+    int rank;
+    int workers;
+    string transport;
+    string address;
+    vector<string> hosts;
+
 
 
     CompServ();
@@ -44,7 +52,16 @@ public:
     // for local
     CompServ(int threads, const vector<int> g, const vector<int> &f,int lsb=1, int mem=0);
 
-    // for Distributed
+    // for Distributed: one process of a data-parallel job, set up by a file of
+    // "key value" lines (# starts a comment):
+    //   workers 4              processes of the job
+    //   rank 0                 this process, the EDDL_RANK environment variable overrides it
+    //   transport unix         unix or tcp
+    //   address /tmp/eddl_job  unix: socket path prefix, tcp: host:port of rank 0 (rank r uses port+r)
+    //   host 2 10.0.0.12       tcp: host of a rank, if not the one of address
+    //   threads 4              CPU threads of this process (-1 for all)
+    //   lsb 0                  0: gradients averaged every batch, k: weights averaged every k batches
+    //   mem full_mem           full_mem, mid_mem or low_mem
     explicit CompServ(string filename);
 
 
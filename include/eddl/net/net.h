@@ -19,6 +19,7 @@
 #include "eddl/losses/loss.h"
 #include "eddl/metrics/metric.h"
 #include "eddl/net/compserv.h"
+#include "eddl/net/scheduler.h"
 
 using namespace std;
 
@@ -36,18 +37,37 @@ typedef vector<Metric *> vmetrics;
 int isIn(Layer *l, vlayer vl, int &ind);
 int isInorig(Layer *l, vlayer vl, int &ind);
 
+class Pipeline;
+class UpdateStream;
+class Cluster;
+
 #define MAX_THREADS 1024
 
+// Chunk size of predict/evaluate when neither the call nor the net set one
+#define STREAM_BATCH 256
+
 class Net {
+	friend class Pipeline;
+
 private:
 	void build(Optimizer *opt, vloss lo, vmetrics me, bool initialize=true);
 
 	void set_compserv(CompServ *cs);
 
+	void load_batch(vtensor X, vtensor Y, vind sind);
+	void train_batch_accumulated(vtensor X, vtensor Y, vind sind, int accumulation_steps);
+	int stream_batch(int n, int batch);
+	void eval_partial_batch(vtensor X, vtensor Y, vind sind, int n);
+	bool run_parallel(LayerScheduler *sched);
+	void average_grads(int steps);
+	void hold_regularizers(bool hold);
+	bool overlap_update();
+
 public:
 	string name;
 	int dev;
 	int batch_size;
+	int batch_set;  // batch of the last resize, -1 before the first one (layers are built for 1)
 	int tr_batches;
 	int inferenced_samples;
 	int trmode;
@@ -56,6 +76,9 @@ public:
 	bool onnx_pretrained;
   bool isrecurrent;
   bool isbuild;
+  bool isaliased; // see alias_eval
+  bool isinference; // params and activations only, training calls are refused
+  int precision; // activations and deltas are rounded to it, see set_mixed_precision
 
 	vector<int> devsel;
 	CompServ *cs;
@@ -65,6 +88,12 @@ public:
 	vlayer lout;
 	vlayer vfts;
 	vlayer vbts;
+	LayerScheduler *fsched; // vfts and vbts as task graphs, nullptr for a chain
+	LayerScheduler *bsched;
+	Pipeline *pipeline; // see set_pipeline
+	UpdateStream *ustream; // see set_overlap_update
+	UpdateStream *backward_hook; // ustream of the master, during its steps
+	Cluster *cluster; // processes of a distributed CS, nullptr if local
 	vlayer netinput;
 
 	vloss losses;
@@ -89,6 +118,7 @@ public:
 	~Net();
 
 	void build(Optimizer *opt, vloss lo, vmetrics me, CompServ *cs, bool initialize=true);
+	void build_inference(CompServ *cs, bool initialize=true);
 	void toGPU(vector<int> g,int lsb,int mem);
 	void toCPU(int t);
 
@@ -104,9 +134,15 @@ public:
 
 
 	void resize(int batch);
+	void fuse_activations();
+	void alias_eval(bool on);
 
 	void enable_distributed();
 
+	void set_mixed_precision(int dtype);
+	void set_pipeline(int nstages, int micro_batches);
+	void set_overlap_update(bool on);
+
 	string summary();
 	void plot(string fname,string mode);
 
@@ -123,15 +159,19 @@ public:
 	void do_reset();
 	void do_reset_grads();
 	void do_forward();
+	void do_forward(int first, int last);
 	void do_delta();
 	void do_compute_loss();
 	void do_backward();
+	void do_backward(int first, int last);
 	void do_applygrads();
 
 	void reset_accumulated_gradients();
 	void apply_accumulated_gradients();
 
 	void sync_weights();
+	void sync_grads();
+	void sync_cluster(bool grads);
 
 	// API
 	void run_snets(void *(*F)(void *t));
@@ -154,12 +194,13 @@ public:
 	void setlr(vector <float> p);
 
 
-	void fit(vtensor tin, vtensor tout, int batch_size, int epochs);
+	void fit(vtensor tin, vtensor tout, int batch_size, int epochs, int accumulation_steps = 1);
 	void fit_recurrent(vtensor tin, vtensor tout, int batch_size, int epochs);
-	void train_batch(vtensor X, vtensor Y, vind sind, int eval = 0);
-	void evaluate(vtensor tin, vtensor tout);
+	void train_batch(vtensor X, vtensor Y, vind sind, int eval = 0, int accumulation_steps = 1);
+	void evaluate(vtensor tin, vtensor tout, int batch = -1);
 	void evaluate_recurrent(vtensor tin, vtensor tout);
-	vtensor predict(vtensor tin);
+	vtensor predict(vtensor tin, int batch = -1);
+	void quantize(vtensor tin, bool per_channel = true);
 
 
 };
@@ -0,0 +1,81 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_PIPELINE_H
+#define EDDL_PIPELINE_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include "eddl/net/net.h"
+
+using namespace std;
+
+// Pipeline-parallel training on CPU. The forward order of the net is split in
+// nstages contiguous stages of similar cost, each one run by its own thread
+// bound to its own group of cores. A batch is split in micro-batches that go
+// through the stages with a 1F1B schedule (after a warm-up, every stage
+// alternates one forward and one backward), stages hand micro-batches over
+// through bounded queues.
+//
+// Every micro-batch in flight runs on a lane: a replica of the net that shares
+// the params and gradients with it and owns its activations, allocated by the
+// thread of each stage. The gradients of all the micro-batches are averaged and
+// applied once per batch with the optimizer of the net.
+class Pipeline {
+public:
+    Net *net;
+    int nstages;
+    int micro_batches;
+    int batch_size;          // samples per micro-batch
+    vector<int> first;       // stage s runs vfts[first[s]] .. vfts[first[s+1]-1]
+    vector<Net *> lanes;     // min(nstages, micro_batches) replicas of the net
+
+    Pipeline(Net *net, int nstages, int micro_batches);
+    ~Pipeline();
+
+    // One training step, sind.size() must be a multiple of micro_batches
+    void train_batch(vtensor X, vtensor Y, vind sind);
+
+private:
+    // Micro-batch indices from one stage to the next (forward) or the previous one (backward)
+    struct Channel {
+        mutex mtx;
+        condition_variable cv;
+        deque<int> q;
+        int capacity;
+        bool closed;
+
+        bool push(int m);
+        bool pop(int &m);
+        void close();
+    };
+
+    int threads;             // per stage
+    vector<Channel *> fwd;   // stage s to s+1
+    vector<Channel *> bwd;   // stage s+1 to s
+    verr lane_err;           // losses and metrics of the batch (last stage)
+
+    mutex err_mtx;
+    exception_ptr error;
+
+    void split();
+    void bind(int s);
+    void on_stages(const function<void(int)> &f);
+    void resize(int b);
+    void run_stage(int s, vtensor &X, vtensor &Y, vind &sind);
+    bool forward(int s, int m, vtensor &X, vtensor &Y, vind &sind);
+    bool backward(int s, int m);
+};
+
+#endif //EDDL_PIPELINE_H
@@ -0,0 +1,85 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_SCHEDULER_H
+#define EDDL_SCHEDULER_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include "eddl/layers/layer.h"
+
+using namespace std;
+
+// Runs the layers of a forward (or backward) order as a graph of tasks: a
+// layer is launched as soon as the layers it depends on are done, so the
+// independent branches of a net run at the same time. Ready layers go to a
+// pool of worker threads with one deque each, idle workers steal from the
+// others. The OpenMP threads of every layer are the threads of the net
+// divided by the layers in flight.
+//
+// Dependencies are the parents (forward) or the children (backward). Besides,
+// forward layers with the same params (shared copies), and backward layers
+// that write the same delta (they share a parent, maybe through a Reshape) or
+// the same gradients (shared layers) keep their order.
+class LayerScheduler {
+public:
+    int size;
+    int width;   // most layers at the same depth of the graph
+
+    LayerScheduler(vector<Layer *> &order, bool backward);
+    ~LayerScheduler();
+
+    // Calls f(i) for every layer i of the order, on up to nthreads threads
+    // (the caller is one of them). The first exception of f is rethrown once
+    // the running layers are done; the layers after it are skipped.
+    void run(int nthreads, const function<void(int)> &f);
+
+private:
+    struct Queue {
+        mutex mtx;
+        deque<int> q;
+    };
+
+    vector<vector<int>> succ;
+    vector<int> npred;
+    unique_ptr<atomic<int>[]> pending;
+
+    int nthreads;
+    const function<void(int)> *task;
+    atomic<int> remaining;
+    atomic<int> queued;
+    atomic<int> running;
+    atomic<bool> failed;
+    exception_ptr error;
+
+    vector<thread> workers;
+    vector<unique_ptr<Queue>> queues;   // queues[0] is the caller's
+    mutex mtx;
+    condition_variable cv;
+    long generation;
+    bool stop;
+
+    void start_workers(int n);
+    void stop_workers();
+    void worker(int w);
+    void drain(int w);
+    void push(int w, int i);
+    bool pop(int w, int &i);
+    void execute(int w, int i);
+};
+
+#endif //EDDL_SCHEDULER_H
@@ -0,0 +1,48 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_SESSION_H
+#define EDDL_SESSION_H
+
+#include <vector>
+
+#include "eddl/net/net.h"
+
+using namespace std;
+
+// Inference over a built Net without touching it. The session layers share
+// the params of the net and own their activations, sized for max_batch.
+// Sessions are created from one thread (e.g. one per worker) and then each
+// one can run predict concurrently with the others, with no locks.
+// Quantized layers run in int8 with a copy of the quantization of the net
+// at the time the session is created.
+class InferenceSession {
+public:
+    Net *net;
+    int max_batch;
+    int batch_size;
+
+    vlayer lin;
+    vlayer lout;
+    vlayer layers;   // forward order
+
+    InferenceSession(Net *net, int max_batch);
+    ~InferenceSession();
+
+    // Any number of samples, in chunks of at most max_batch
+    vtensor predict(vtensor tin);
+
+private:
+    vector<QuantDescriptor *> quant;   // owned by the session
+
+    void resize(int b);
+    void forward();
+};
+
+#endif //EDDL_SESSION_H
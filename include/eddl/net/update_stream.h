@@ -0,0 +1,67 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_UPDATE_STREAM_H
+#define EDDL_UPDATE_STREAM_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <unordered_map>
+#include <condition_variable>
+
+#include "eddl/net/net.h"
+
+using namespace std;
+
+// Optimizer steps overlapped with the backward. The gradients of a layer are
+// final once its backward is done (in every snet that averages them with the
+// others), so its update runs then on a thread of its own while the backward
+// goes on with the layers before it. Layers that share their gradients are
+// updated once the last of them is done.
+class UpdateStream {
+public:
+    Net *net;
+    bool sync;   // average the gradients of the snets first (lsb=0)
+
+    explicit UpdateStream(Net *net);
+    ~UpdateStream();
+
+    // Before the backward of a step, with the gradients already reset
+    void begin();
+    // After the backward of l in snet
+    void ready(Net *snet, Layer *l);
+    // Waits for the updates of all the layers
+    void end();
+
+private:
+    vector<Net *> snets;
+    vector<vector<Net *>> groups;             // snets updated together
+    unordered_map<Layer *, pair<int, int>> where;  // layer of a snet: group and index
+    vector<int> owner;                        // first layer with the same gradients, -1 without
+    vector<vector<int>> members;              // layers with the gradients of an owner
+    vector<vector<int>> pending;              // backwards to wait for, per group and owner
+    int total;                                // updates of a step
+    int done;
+
+    thread worker;
+    mutex mtx;
+    condition_variable cv;
+    deque<pair<int, int>> q;
+    bool stop;
+    exception_ptr error;
+
+    void setup();
+    void run();
+    void update(int g, int o);
+};
+
+#endif //EDDL_UPDATE_STREAM_H
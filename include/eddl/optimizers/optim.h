@@ -32,14 +32,31 @@ public:
     float clip_val;
     Optimizer *orig;
 
+    // Loss scaling (mixed precision)
+    float loss_scale;
+    bool dynamic_loss_scale;
+    int scale_window;
+    int good_steps;
+
     Optimizer();
 
     void set_clip_val(float v);
     void clip();
+    void clip(int i);
+
+    void set_loss_scale(float scale, bool dynamic=true, int window=2000);
+    void copy_loss_scale(Optimizer *o);
+    float get_loss_scale();
+    bool unscale_grads();
 
     virtual void setlayers(vlayer l) {}
 
-    virtual void applygrads(int batch) {}
+    // One step updates all the layers at once or, as the gradients of every
+    // layer are ready, begin_step() and then update_layer(i) for each of them
+    virtual void applygrads(int batch);
+    virtual void begin_step() {}
+    virtual void update_layer(int i) {}
+    int param_index(int i);
 
     virtual Optimizer *clone() { return nullptr; }
     virtual Optimizer *share() { return nullptr; }
@@ -65,7 +82,7 @@ public:
 
     void setlayers(vlayer l) override;
 
-    void applygrads(int batch) override;
+    void update_layer(int i) override;
 
     void change(vector<float> &p) override;
 };
@@ -83,8 +100,6 @@ public:
 
     vtensor mT;
     vtensor vT;
-    vtensor mCap;
-    vtensor vCap;
 
     explicit Adam(float lr=0.01f, float beta_1=0.9f, float beta_2=0.999f, float epsilon=1e-8f, float weight_decay=0.0f, bool amsgrad=false);
     ~Adam();
@@ -94,7 +109,8 @@ public:
 
     void setlayers(vlayer l) override;
 
-    void applygrads(int batch) override;
+    void begin_step() override;
+    void update_layer(int i) override;
 
     void change(vector<float> &p) override;
 };
@@ -193,7 +209,6 @@ public:
     float epsilon;
     float weight_decay;
 
-    vtensor gT;
     vtensor gT1;
 
     explicit RMSProp(float lr=0.01f, float rho=0.9f, float epsilon=1e-8f, float weight_decay=0.0f);
@@ -205,7 +220,7 @@ public:
 
     void setlayers(vlayer l) override;
 
-    void applygrads(int batch) override;
+    void update_layer(int i) override;
 
     void change(vector<float> &p) override;
 };
@@ -68,15 +68,33 @@ void D_Tanh(Tensor *D, Tensor *I, Tensor *PD);
 void Linear(Tensor *A, Tensor *B, float param);
 void D_Linear(Tensor *D, Tensor *I, Tensor *PD, float param);
 
+// Fused epilogue (in place), act is one of GEMM_ACT_*
+void FusedActivation(Tensor *A, int act, float param);
+
 // ***** Deep Learning *****************************
+// Multi-head attention, D holds Q, K, V and O
+void Attention(AttentionDescriptor *D);
+void D_Attention(AttentionDescriptor *D);
+
 // Conv2D
 void Conv2D(ConvolDescriptor *D);
 void Conv2D_grad(ConvolDescriptor *D);
 void Conv2D_back(ConvolDescriptor *D);
 
+// ConvT2D, D is the convolution it transposes (from B to A)
+void ConvT2D(ConvolDescriptor *D, Tensor *A, Tensor *B);
+void ConvT2D_grad(ConvolDescriptor *D, Tensor *A, Tensor *DB);
+void ConvT2D_back(ConvolDescriptor *D, Tensor *DB, Tensor *DA);
+
+// Int8 inference
+void Dense_int8(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *B);
+void Conv2D_int8(ConvolDescriptor *D, QuantDescriptor *Q);
+
 // MaxPool
 void MPool2D(PoolDescriptor *D);
 void MPool2D_back(PoolDescriptor *D);
+void MPool1D(PoolDescriptor *D);
+void MPool1D_back(PoolDescriptor *D);
 
 
 // AvgPool
@@ -93,4 +111,18 @@ void permute_channels_first(Tensor *A,Tensor *B);
 void permute_batch_last(Tensor *A,Tensor *B);
 void permute_batch_first(Tensor *A,Tensor *B);
 
+// ***** Row-sparse updates (see Layer::sparse_rows) ********************
+void zero_rows(Tensor *A, const vector<int> &rows);
+// G[ids[k]] += sum of the rows order[start[k]..start[k+1]) of D
+void inc_rows(Tensor *D, Tensor *G, const vector<int> &ids, const vector<int> &start, const vector<int> &order, bool mask_zeros);
+void sgd_rows(Tensor *W, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu);
+void adam_rows(Tensor *W, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1, float beta_2, float epsilon, int t);
+void rmsprop_rows(Tensor *W, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon);
+
+// ***** LayerNorm, GroupNorm ********************
+// A is normalized as {rows, A->size/rows}, gamma and beta (or nullptr) are
+// applied per element or per channel depending on their size
+void LayerNorm(Tensor *A, Tensor *B, Tensor *opa, Tensor *mean, Tensor *sd, Tensor *gamma, Tensor *beta, int rows, float epsilon);
+void D_LayerNorm(Tensor *D, Tensor *opa, Tensor *sd, Tensor *gamma, Tensor *ggamma, Tensor *gbeta, Tensor *PD, int rows);
+
 #endif //EDDL_TENSOR_NN_H
@@ -51,12 +51,26 @@
 
 #define MAX_GPUS 8
 
+// Precision of the activations and deltas of a Net (see set_mixed_precision),
+// tensors always store and compute float32
+#define DT_FLOAT32 0
+#define DT_BFLOAT16 1
+
+// Activations applied by Tensor::gemm (and the conv kernels) while the output is in cache
+#define GEMM_ACT_NONE 0
+#define GEMM_ACT_RELU 1
+#define GEMM_ACT_LEAKY_RELU 2
+#define GEMM_ACT_SIGMOID 3
+#define GEMM_ACT_TANH 4
+
 using namespace std;
 
 // TODO: Remove this. Don't like here
 typedef Eigen::Matrix<float, -1, -1, Eigen::RowMajor> MatrixXRMf;
 typedef vector<int> tshape;
 
+class Expr;
+
 class Tensor {
 private:
     void updateDevice(int dev);
@@ -444,8 +458,16 @@ public:
     static Tensor* mult(Tensor *A, float v);
     static Tensor* mult(Tensor *A, Tensor *B);
     static void mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC);
+    static void gemm(float alpha, Tensor *A, int tA, Tensor *B, int tB, float beta, Tensor *C,
+                     Tensor *bias=nullptr, int act=GEMM_ACT_NONE, float act_param=0.0f);
+    static void batched_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC);
     static void el_mult(Tensor *A, Tensor *B, Tensor *C, int incC);
 
+    // Fused elementwise expressions (see tensor_expr.h), one pass over memory
+    static void eval(Tensor *A, const Expr &e);
+    static void eval(const vector<Tensor*> &A, const vector<Expr> &e);
+    static float eval_sum(const Expr &e);
+
     void neg_();
     static Tensor* neg(Tensor *A);
 
@@ -467,6 +489,13 @@ public:
     void round_();
     static Tensor* round(Tensor *A);
 
+    /**
+      *  @brief Round the values to the nearest bfloat16 (round-to-nearest-even), keeping them as float32.
+      *
+      *  @return    void
+    */
+    void round_bfloat16_();
+
     void rsqrt_();
     static Tensor* rsqrt(Tensor *A);
 
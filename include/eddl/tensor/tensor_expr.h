@@ -0,0 +1,114 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_TENSOR_EXPR_H
+#define EDDL_TENSOR_EXPR_H
+
+#include <memory>
+#include <vector>
+
+#include "eddl/tensor/tensor.h"
+
+using namespace std;
+
+// Elementwise expressions over tensors of the same size and scalars. They
+// are only recorded when written and evaluated in a single pass by
+// Tensor::eval, e.g. an Adam step without temporaries:
+//
+//   Tensor::eval({M, V, W}, {b1*Expr(M) + (1-b1)*Expr(G),
+//                            b2*Expr(V) + (1-b2)*sqr(Expr(G)),
+//                            Expr(W) - lr*(Expr(M)/c1) / sqrt(Expr(V)/c2 + eps)});
+//
+// Statements are evaluated in order for each element, so a statement reads
+// the values written by the previous ones (M and V above).
+
+#define EXPR_LOAD   0
+#define EXPR_CONST  1
+#define EXPR_STORE  2
+#define EXPR_ADD    3
+#define EXPR_SUB    4
+#define EXPR_MUL    5
+#define EXPR_DIV    6
+#define EXPR_NEG    7
+#define EXPR_SQR    8
+#define EXPR_SQRT   9
+#define EXPR_EXP    10
+#define EXPR_LOG    11
+#define EXPR_ABS    12
+#define EXPR_SIGN   13
+#define EXPR_POW    14  // scalar exponent
+#define EXPR_MAX    15  // scalar bound
+#define EXPR_MIN    16  // scalar bound
+
+// Binary operands: both on the stack, or one of them is the scalar val
+#define EXPR_VV 0
+#define EXPR_VS 1
+#define EXPR_SV 2
+
+// One instruction of the compiled (postfix) program
+struct ExprOp {
+    int op;
+    int arg;    // tensor index for LOAD/STORE, operand mode for binary ops
+    float val;
+};
+
+class ExprNode {
+public:
+    int op;
+    Tensor *T;
+    float val;
+    shared_ptr<ExprNode> a, b;
+
+    ExprNode(int op, Tensor *T, float val, shared_ptr<ExprNode> a, shared_ptr<ExprNode> b);
+};
+
+class Expr {
+public:
+    shared_ptr<ExprNode> node;
+
+    Expr(Tensor *T);
+    Expr(float v);
+    Expr(int op, const Expr &a, const Expr &b);
+    Expr(int op, const Expr &a, float v);
+
+    bool isconst() const { return node->op==EXPR_CONST; }
+};
+
+Expr operator+(const Expr &a, const Expr &b);
+Expr operator-(const Expr &a, const Expr &b);
+Expr operator*(const Expr &a, const Expr &b);
+Expr operator/(const Expr &a, const Expr &b);
+Expr operator-(const Expr &a);
+
+Expr sqr(const Expr &a);
+Expr sqrt(const Expr &a);
+Expr exp(const Expr &a);
+Expr log(const Expr &a);
+Expr abs(const Expr &a);
+Expr sign(const Expr &a);
+Expr pow(const Expr &a, float e);
+Expr maximum(const Expr &a, float v);
+Expr minimum(const Expr &a, float v);
+
+// Statements compiled to a single instruction list over the tensors in T
+class ExprProgram {
+public:
+    vector<ExprOp> ops;
+    vector<Tensor *> T;
+    int depth;   // max. number of live values
+    int size;    // elements of every tensor
+
+    ExprProgram(const vector<Tensor *> &outs, const vector<Expr> &exprs);
+
+private:
+    int tensor_index(Tensor *A);
+    void emit(const shared_ptr<ExprNode> &n, int level);
+};
+
+#endif //EDDL_TENSOR_EXPR_H
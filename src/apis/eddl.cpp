@@ -72,6 +72,15 @@ namespace eddl {
         net->build(o, l, m, cs, init_weights);
     }
 
+    void build_inference(model net, CompServ *cs, bool init_weights){
+        // Assign default computing service
+        if (cs== nullptr){
+            cs = new CompServ(std::thread::hardware_concurrency(), {}, {});
+        }
+
+        net->build_inference(cs, init_weights);
+    }
+
     // Computing services
 
     // GPU
@@ -183,6 +192,25 @@ namespace eddl {
     {
         net->setlr(p);
     }
+    void set_loss_scale(model net, float scale, bool dynamic, int window)
+    {
+        for(int i=0;i<net->snets.size();i++)
+            net->snets[i]->optimizer->set_loss_scale(scale, dynamic, window);
+    }
+    void set_mixed_precision(model net, const string& dtype)
+    {
+        if (dtype=="float32") net->set_mixed_precision(DT_FLOAT32);
+        else if (dtype=="bfloat16") net->set_mixed_precision(DT_BFLOAT16);
+        else msg("Unknown data type: " + dtype, "set_mixed_precision");
+    }
+    void set_pipeline(model net, int stages, int micro_batches)
+    {
+        net->set_pipeline(stages, micro_batches);
+    }
+    void set_overlap_update(model net, bool enable)
+    {
+        net->set_overlap_update(enable);
+    }
     optimizer adadelta(float lr, float rho, float epsilon, float weight_decay){
         //Todo: Implement
         return new AdaDelta(lr, rho, epsilon, weight_decay);
@@ -219,15 +247,27 @@ namespace eddl {
 
     // Training and Evaluation
     // Coarse methods
-    void fit(model net, const vector<Tensor *> &in, const vector<Tensor *> &out, int batch, int epochs){
-        net->fit(in, out, batch, epochs);
+    void fit(model net, const vector<Tensor *> &in, const vector<Tensor *> &out, int batch, int epochs, int accumulation_steps){
+        net->fit(in, out, batch, epochs, accumulation_steps);
     }
-    void evaluate(model net, const vector<Tensor *> &in, const vector<Tensor *> &out){
-        net->evaluate(in, out);
+    void evaluate(model net, const vector<Tensor *> &in, const vector<Tensor *> &out, int bs){
+        net->evaluate(in, out, bs);
     }
-    vector<Tensor *>  predict(model m, const vector<Tensor *> &in)
+    vector<Tensor *>  predict(model m, const vector<Tensor *> &in, int bs)
     {
-      return m->predict(in);
+      return m->predict(in, bs);
+    }
+    void quantize(model m, const vector<Tensor *> &in, bool per_channel)
+    {
+      m->quantize(in, per_channel);
+    }
+    InferenceSession* inference_session(model m, int max_batch)
+    {
+      return new InferenceSession(m, max_batch);
+    }
+    BatchQueue* batch_queue(model m, int max_batch, int max_wait_us)
+    {
+      return new BatchQueue(m, max_batch, max_wait_us);
     }
 
     // Finer methods
@@ -236,9 +276,9 @@ namespace eddl {
         for (int k = 0; k < batch_size; k++) sind.push_back(rand() % num_samples);
         return sind;
     }
-    void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices){
+    void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices, int accumulation_steps){
         net->tr_batches++;
-        net->train_batch(in, out, indices);
+        net->train_batch(in, out, indices, 0, accumulation_steps);
     }
     void eval_batch(model net, vector<Tensor *> in, vector<Tensor *> out, vector<int> indices){
         net->train_batch(in, out, indices,1);
@@ -520,19 +560,10 @@ namespace eddl {
     layer Conv1D(layer parent, int filters, vector<int> kernel_size,
                vector<int> strides, string padding,  bool use_bias,
                int groups, vector<int> dilation_rate,string name){
+        if ((kernel_size.size() != 1) || (strides.size() != 1) || (dilation_rate.size() != 1))
+            msg("Kernel size, strides and dilation must have 1 dimension", "Conv1D");
 
-        vector<int> shape=parent->output->getShape();
-        shape.push_back(1);
-        LReshape *l=new LReshape(parent, shape, "", DEV_CPU, 0);
-
-        kernel_size.push_back(1);
-        strides.push_back(1);
-        LConv *lc=new LConv(l, filters, kernel_size, strides, padding, groups, dilation_rate, use_bias, name, DEV_CPU, 0);
-
-        vector<int> shape2=lc->output->getShape();
-        shape2.pop_back();
-        return new LReshape(lc,shape2, "", DEV_CPU, 0);
-
+        return new LConv1D(parent, filters, kernel_size, strides, padding, groups, dilation_rate, use_bias, name, DEV_CPU, 0);
     }
 
 
@@ -549,6 +580,14 @@ namespace eddl {
         return new LDense(parent, ndim, use_bias, name, DEV_CPU, 0);
     }
 
+    layer MultiHeadAttention(layer parent, int num_heads, int head_dim, bool causal, bool use_bias, string name){
+        return new LMultiHeadAttention({parent}, num_heads, head_dim, causal, use_bias, name, DEV_CPU, 0);
+    }
+
+    layer MultiHeadAttention(layer query, layer memory, int num_heads, int head_dim, bool use_bias, string name){
+        return new LMultiHeadAttention({query, memory}, num_heads, head_dim, false, use_bias, name, DEV_CPU, 0);
+    }
+
   layer Dropout(layer parent, float rate, bool iw, string name){
     return new LDropout(parent, rate, iw, name, DEV_CPU, 0);
     }
@@ -893,18 +932,10 @@ namespace eddl {
         return new LMaxPool(parent, pool_size, strides, padding, name, DEV_CPU, 0);
     }
     layer MaxPool1D(layer parent, vector<int> pool_size, vector<int> strides, string padding, string name){
+        if ((pool_size.size() != 1) || (strides.size() != 1))
+            msg("Pool size and strides must have 1 dimension", "MaxPool1D");
 
-        vector<int> shape=parent->output->getShape();
-        shape.push_back(1);
-        LReshape *l=new LReshape(parent, shape, "", DEV_CPU, 0);
-
-        pool_size.push_back(1);
-        strides.push_back(1);
-        LMaxPool *lp=new LMaxPool(l, pool_size, strides, padding, name, DEV_CPU, 0);
-
-        vector<int> shape2=lp->output->getShape();
-        shape2.pop_back();
-        return new LReshape(lp,shape2, "", DEV_CPU, 0);
+        return new LMaxPool1D(parent, pool_size, strides, padding, name, DEV_CPU, 0);
     }
 
     layer GlobalMaxPool(layer parent, string name){
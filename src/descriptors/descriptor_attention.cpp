@@ -0,0 +1,76 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include "eddl/descriptors/descriptors.h"
+#include <cmath>
+
+
+AttentionDescriptor::AttentionDescriptor(int heads, int head_dim, bool causal, int mem) {
+    if ((heads <= 0) || (head_dim <= 0)) msg("heads and head_dim must be > 0", "AttentionDescriptor::AttentionDescriptor");
+
+    this->heads = heads;
+    this->head_dim = head_dim;
+    this->causal = causal;
+    this->scale = 1.0f / std::sqrt((float)head_dim);
+    this->tile = 64;
+    this->mem_level = mem;
+
+    batch = lq = lk = 0;
+    Q = K = V = O = L = nullptr;
+    dQ = dK = dV = dO = nullptr;
+}
+
+AttentionDescriptor::~AttentionDescriptor() {
+    delete Q;
+    delete K;
+    delete V;
+    delete O;
+    delete L;
+    delete dQ;
+    delete dK;
+    delete dV;
+    delete dO;
+}
+
+void AttentionDescriptor::build(int batch, int lq, int lk, int dev) {
+    if (causal && (lq != lk)) msg("Causal attention needs equal query and key lengths", "AttentionDescriptor::build");
+
+    this->batch = batch;
+    this->lq = lq;
+    this->lk = lk;
+    int hd = heads * head_dim;
+
+    Q = new Tensor(vector<int>{batch * lq, hd}, dev);
+    K = new Tensor(vector<int>{batch * lk, hd}, dev);
+    V = new Tensor(vector<int>{batch * lk, hd}, dev);
+    O = new Tensor(vector<int>{batch * lq, hd}, dev);
+    L = new Tensor(vector<int>{batch, heads, lq}, dev);
+
+    dQ = new Tensor(vector<int>{batch * lq, hd}, dev);
+    dK = new Tensor(vector<int>{batch * lk, hd}, dev);
+    dV = new Tensor(vector<int>{batch * lk, hd}, dev);
+    dO = new Tensor(vector<int>{batch * lq, hd}, dev);
+}
+
+void AttentionDescriptor::resize(int b) {
+    if (b == batch) return;
+
+    batch = b;
+    Q->resize(b * lq);
+    K->resize(b * lk);
+    V->resize(b * lk);
+    O->resize(b * lq);
+    L->resize(b);
+
+    dQ->resize(b * lq);
+    dK->resize(b * lk);
+    dV->resize(b * lk);
+    dO->resize(b * lq);
+}
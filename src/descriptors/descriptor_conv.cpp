@@ -18,30 +18,36 @@
 #include "eddl/hardware/gpu/nn/gpu_nn.h"
 #endif
 
-ConvolDescriptor::ConvolDescriptor() {}
+ConvolDescriptor::ConvolDescriptor() {groups=1; dilation={1, 1};}
 
-ConvolDescriptor::ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem) {
+ConvolDescriptor::ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem, int groups, const vector<int> &dil) {
     ksize = vector<int>(ks.begin(), ks.end());
     stride = vector<int>(st.begin(), st.end());
     pad = vector<int>(p.begin(), p.end());
+    dilation = vector<int>(dil.begin(), dil.end());
     mem_level=mem;
+    this->groups=groups;
 
     this->padding = "custom";
 
     if (ksize.size() != 3) msg("Kernels must have 3 dimensions", "ConvolDescriptor::ConvolDescriptor");
     if (stride.size() != 2) msg("Strides must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor");
+    if (dilation.size() != 2) msg("Dilations must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor");
 }
 
-ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool ub, int mem) {
+ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool ub, int mem, int groups, const vector<int> &dil) {
     if (ks.size() != 2) { msg("Kernels must have 3 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
     if (st.size() != 2) { msg("Strides must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
+    if (dil.size() != 2) { msg("Dilations must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
 
     // Add filters to kernel_size
     ksize = vector<int>(ks);
     ksize.insert(ksize.begin(), 1, filters);
     stride = vector<int>(st.begin(), st.end());
+    dilation = vector<int>(dil.begin(), dil.end());
     use_bias=ub;
     mem_level=mem;
+    this->groups=groups;
 
     if (p=="same" || p =="none" || p =="valid" || p =="zeros" || p=="same,none" || p=="none,same") {
         this->padding=p;
@@ -55,46 +61,61 @@ ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vec
 
 void ConvolDescriptor::build(Tensor *A) {
 
-    if (A->ndim != 4) msg("Tensors are not 4D", "ConvolDescriptor::build");
+    // 3D tensors (batch x channels x length) are handled as images with a single row
+    if ((A->ndim != 4) && (A->ndim != 3)) msg("Tensors are not 3D or 4D", "ConvolDescriptor::build");
 
     I = A;
 
+    if ((groups < 1) || (A->shape[1] % groups) || (ksize[0] % groups))
+        msg("Channels and filters must be divisible by groups", "ConvolDescriptor::build");
+
     nk = ksize[0];
     kr = ksize[1];
     kc = ksize[2];
-    kz = A->shape[1];
+    kz = A->shape[1] / groups;
 
     sr = stride[0];
     sc = stride[1];
 
+    dr = dilation[0];
+    dc = dilation[1];
+    if ((dr < 1) || (dc < 1)) msg("Dilations must be positive", "ConvolDescriptor::build");
+
+    // Extent of the dilated kernel over the input
+    int ekr = (kr - 1) * dr + 1;
+    int ekc = (kc - 1) * dc + 1;
+
     iz = A->shape[1];
-    ir = A->shape[2];
-    ic = A->shape[3];
+    ir = (A->ndim == 4) ? A->shape[2] : 1;
+    ic = A->shape[A->ndim - 1];
+
+    if ((A->ndim == 3) && ((kr != 1) || (sr != 1) || (dr != 1)))
+        msg("1D convolutions must have a single kernel row", "ConvolDescriptor::build");
 
     if(this->padding=="custom"){  // Known padding
         // Compute output
         z = nk;
         vector<int>pr; pr.push_back(pad[0]);pr.push_back(pad[1]);
-        r = compute_output(pr, ir, kr, sr);
+        r = compute_output(pr, ir, kr, sr, dr);
 
         vector<int>pc; pc.push_back(pad[2]);pc.push_back(pad[3]);
-        c = compute_output(pc, ic, kc, sc);
+        c = compute_output(pc, ic, kc, sc, dc);
 
     }else{  // Common padding (same/zeros)
         // Compute output
         z = nk;
 
-        if (padding=="same,none") r = compute_output("same", ir, kr, sr);
-        else if (padding=="none,same")  r = compute_output("none", ir, kr, sr);
-        else r = compute_output(this->padding, ir, kr, sr);
+        if (padding=="same,none") r = compute_output("same", ir, kr, sr, dr);
+        else if (padding=="none,same")  r = compute_output("none", ir, kr, sr, dr);
+        else r = compute_output(this->padding, ir, kr, sr, dr);
 
-        if (padding=="same,none") c = compute_output("none", ic, kc, sc);
-        else if (padding=="none,same")  c = compute_output("same", ic, kc, sc);
-        else c = compute_output(this->padding, ic, kc, sc);
+        if (padding=="same,none") c = compute_output("none", ic, kc, sc, dc);
+        else if (padding=="none,same")  c = compute_output("same", ic, kc, sc, dc);
+        else c = compute_output(this->padding, ic, kc, sc, dc);
 
         // Compute padding
-        vector<int> padr = compute_padding(r, ir, kr, sr, this->padding,true);  // Order: [top, bottom]
-        vector<int> padc = compute_padding(c, ic, kc, sc, this->padding,false);  // Order: [left, right]
+        vector<int> padr = compute_padding(r, ir, ekr, sr, this->padding,true);  // Order: [top, bottom]
+        vector<int> padc = compute_padding(c, ic, ekc, sc, this->padding,false);  // Order: [left, right]
 
         // Set padding
         pad = {padr[0], padr[1], padc[0], padc[1]};  // top, bottom, left, right
@@ -107,8 +128,10 @@ void ConvolDescriptor::build(Tensor *A) {
         cout<<"rows="<<r<<" cols"<<c<<endl;
         msg("Invalid output shape", "ConvolDescriptor::build");
     }
+    if ((A->ndim == 3) && (padrt || padrb)) msg("1D convolutions can not pad rows", "ConvolDescriptor::build");
 
-    O = new Tensor(vector<int>{A->shape[0], z, r, c}, A->device);
+    if (A->ndim == 3) O = new Tensor(vector<int>{A->shape[0], z, c}, A->device);
+    else O = new Tensor(vector<int>{A->shape[0], z, r, c}, A->device);
 //    if (!mem_level) { D = new Tensor(O->shape, A->device); }
 
     // Params
@@ -119,14 +142,17 @@ void ConvolDescriptor::build(Tensor *A) {
     gbias = new Tensor(vector<int>{nk}, I->device);
 
     if (I->isCPU()) {
-        // mem for ptr, lowering im2col
-        ptrI=get_fmem(A->shape[0] * r * c * kr * kc * kz,"ConvolDescriptor::build");
+        // mem for ptr, lowering im2col (one lowering per group, depthwise does not need it)
+        if (is_depthwise()) ptrI=nullptr;
+        else ptrI=get_fmem(A->shape[0] * r * c * kr * kc * iz,"ConvolDescriptor::build");
         new(&matK) Eigen::Map<Eigen::MatrixXf>(K->ptr, kr * kc * kz, nk);
         new(&matgK) Eigen::Map<Eigen::MatrixXf>(gK->ptr, kr * kc * kz, nk);
         // convolution: matC=matA*matK
     }
 #ifdef cGPU
     else if (I->isGPU()) {
+        if (groups > 1) msg("Grouped convolutions are only available on CPU", "ConvolDescriptor::build");
+        if ((dr > 1) || (dc > 1)) msg("Dilated convolutions are only available on CPU", "ConvolDescriptor::build");
 
         if (mem_level>1) {
             // Lowering
@@ -166,9 +192,9 @@ void ConvolDescriptor::resize(int b)
     O->resize(b);
 //    if (!mem_level) D->resize(b);
 
-    if (I->isCPU()) {
+    if ((I->isCPU()) && (!is_depthwise())) {
         delete ptrI;
-        ptrI=get_fmem(b * r * c * kr * kc * kz, "ConvolDescriptor::build");
+        ptrI=get_fmem(b * r * c * kr * kc * iz, "ConvolDescriptor::build");
     }
 #ifdef cGPU
     else if (I->isGPU()) {
@@ -191,6 +217,11 @@ void ConvolDescriptor::enable_distributed() {
     acc_gbias->fill_(0.0);
 }
 
+bool ConvolDescriptor::is_depthwise() {
+    // One input channel per filter
+    return (groups > 1) && (groups == iz);
+}
+
 int ConvolDescriptor::compute_output(const string& padding, int input_size, int kerkel_size, int stride, int dilation_rate){
     if (padding=="same" || padding =="zeros") {
         return std::ceil((float)input_size/(float)stride);
@@ -17,6 +17,7 @@ PoolDescriptor::PoolDescriptor(const vector<int> &ks, const vector<int> &st, con
     stride = vector<int>(st.begin(), st.end());
     pad = vector<int>(p.begin(), p.end());
     mem_level=mem;
+    indX = indY = nullptr;
 
     this->padding = "custom";
 
@@ -33,6 +34,7 @@ PoolDescriptor::PoolDescriptor(const vector<int> &ks, const vector<int> &st, con
     ksize = ks;
     stride = st;
     mem_level=mem;
+    indX = indY = nullptr;
 
     if (p=="same" || p =="none" || p =="valid" || p =="zeros") {
         this->padding=p;
@@ -43,7 +45,8 @@ PoolDescriptor::PoolDescriptor(const vector<int> &ks, const vector<int> &st, con
 
 
 void PoolDescriptor::build(Tensor *A) {
-    if (A->ndim != 4) msg("Tensors are not 4D", "PoolDescriptor::build");
+    // 3D tensors (batch x channels x length) are handled as images with a single row
+    if ((A->ndim != 4) && (A->ndim != 3)) msg("Tensors are not 3D or 4D", "PoolDescriptor::build");
 
     I = A;
 
@@ -54,14 +57,17 @@ void PoolDescriptor::build(Tensor *A) {
     sc = stride[1];
 
     iz = A->shape[1];
-    ir = A->shape[2];
-    ic = A->shape[3];
+    ir = (A->ndim == 4) ? A->shape[2] : 1;
+    ic = A->shape[A->ndim - 1];
+
+    if ((A->ndim == 3) && ((kr != 1) || (sr != 1)))
+        msg("1D pooling must have a single kernel row", "PoolDescriptor::build");
 
     if(this->padding=="custom"){  // Known padding
         // Compute output
         z = iz;
-        r = compute_output(this->pad, ir, kr, sr);
-        c = compute_output(this->pad, ic, kc, sc);
+        r = compute_output(vector<int>{pad[0], pad[1]}, ir, kr, sr);
+        c = compute_output(vector<int>{pad[2], pad[3]}, ic, kc, sc);
 
     }else{  // Common padding (same/zeros)
         // Compute output
@@ -84,8 +90,12 @@ void PoolDescriptor::build(Tensor *A) {
         msg("Invalid output shape", "PoolDescriptor::build");
     }
 
-    O = new Tensor(vector<int>{A->shape[0], z, r, c}, A->device);
+    if ((A->ndim == 3) && (padrt || padrb)) msg("1D pooling can not pad rows", "PoolDescriptor::build");
+
+    if (A->ndim == 3) O = new Tensor(vector<int>{A->shape[0], z, c}, A->device);
+    else O = new Tensor(vector<int>{A->shape[0], z, r, c}, A->device);
 //    if (!mem_level) { D = new Tensor(O->shape, A->device); }
+    if (O->isCPU()) ind.resize(O->size);
 
 
     // Careful with the "size++" not "useless loop"
@@ -99,5 +109,6 @@ void PoolDescriptor::resize(int b) {
   if (b == O->shape[0]) return;
 
   O->resize(b);
+  if (O->isCPU()) ind.resize(O->size);
 //  if (!mem_level) { D->resize(b); }
 }
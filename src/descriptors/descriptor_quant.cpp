@@ -0,0 +1,124 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include "eddl/descriptors/descriptors.h"
+#include <cmath>
+#include <cfloat>
+
+
+QuantDescriptor::QuantDescriptor(int channels, int ksize, int groups) {
+    if ((groups < 1) || (channels % groups)) msg("channels must be a multiple of groups", "QuantDescriptor");
+
+    this->channels = channels;
+    this->ksize = ksize;
+    this->groups = groups;
+    kpad = (ksize + 3) & ~3;
+    per_channel = true;
+    calibrating = false;
+    quantized = false;
+
+    in_scale = out_scale = 1.0f;
+    in_zero = out_zero = 0;
+
+    reset_ranges();
+}
+
+void QuantDescriptor::reset_ranges() {
+    in_min = out_min = FLT_MAX;
+    in_max = out_max = -FLT_MAX;
+}
+
+void QuantDescriptor::observe(Tensor *in, Tensor *out) {
+    in_min = std::min(in_min, in->min());
+    in_max = std::max(in_max, in->max());
+    out_min = std::min(out_min, out->min());
+    out_max = std::max(out_max, out->max());
+}
+
+void QuantDescriptor::compute_params(float min, float max, float &scale, int &zero) {
+    // The range must contain 0 so that padding is exactly representable
+    min = std::min(min, 0.0f);
+    max = std::max(max, 0.0f);
+
+    scale = (max - min) / 255.0f;
+    if (scale == 0.0f) scale = 1.0f;
+
+    zero = (int)std::round(-min / scale);
+    zero = std::max(0, std::min(255, zero));
+}
+
+void QuantDescriptor::quantize(const float *W, int sk, int sn, bool per_channel) {
+    if (in_min > in_max) msg("Layer has not been calibrated", "QuantDescriptor::quantize");
+
+    this->per_channel = per_channel;
+    compute_params(in_min, in_max, in_scale, in_zero);
+    compute_params(out_min, out_max, out_scale, out_zero);
+
+    // Symmetric weights: max(|w|) -> 127
+    vector<float> amax(channels, 0.0f);
+    for (int n = 0; n < channels; n++)
+        for (int k = 0; k < ksize; k++)
+            amax[n] = std::max(amax[n], std::fabs(W[k * sk + n * sn]));
+
+    if (!per_channel) {
+        float m = 0.0f;
+        for (int n = 0; n < channels; n++) m = std::max(m, amax[n]);
+        for (int n = 0; n < channels; n++) amax[n] = m;
+    }
+
+    vector<int8_t> qW(channels * ksize);
+    w_scale.resize(channels);
+    w_sum.resize(channels);
+    for (int n = 0; n < channels; n++) {
+        float s = (amax[n] > 0.0f) ? amax[n] / 127.0f : 1.0f;
+        int sum = 0;
+        for (int k = 0; k < ksize; k++) {
+            int q = (int)std::round(W[k * sk + n * sn] / s);
+            q = std::max(-127, std::min(127, q));
+            qW[n * ksize + k] = (int8_t)q;
+            sum += q;
+        }
+        w_scale[n] = s;
+        w_sum[n] = sum;
+    }
+
+    pack(qW);
+
+    calibrating = false;
+    quantized = true;
+}
+
+int QuantDescriptor::blocks() {
+    return (channels / groups + QUANT_NB - 1) / QUANT_NB;
+}
+
+// Filter n of a group at lane n%QUANT_NB of block n/QUANT_NB, missing
+// filters and k >= ksize are zeros. qW is (channels x ksize)
+void QuantDescriptor::pack(const vector<int8_t> &qW) {
+    int ng = channels / groups;
+    int nb = blocks();
+
+    pW.assign((size_t)groups * nb * QUANT_NB * kpad, 0);
+    for (int g = 0; g < groups; g++)
+        for (int n = 0; n < ng; n++) {
+            int8_t *blk = pW.data() + (size_t)(g * nb + n / QUANT_NB) * QUANT_NB * kpad;
+            const int8_t *w = qW.data() + (size_t)(g * ng + n) * ksize;
+            for (int k = 0; k < ksize; k++)
+                blk[(k / 4) * 4 * QUANT_NB + (n % QUANT_NB) * 4 + (k % 4)] = w[k];
+        }
+}
+
+int8_t QuantDescriptor::weight(int n, int k) {
+    int ng = channels / groups;
+    int g = n / ng;
+    n %= ng;
+    const int8_t *blk = pW.data() + (size_t)(g * blocks() + n / QUANT_NB) * QUANT_NB * kpad;
+    return blk[(k / 4) * 4 * QUANT_NB + (n % QUANT_NB) * 4 + (k % 4)];
+}
@@ -0,0 +1,124 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cmath>
+#include <algorithm>
+
+#include "eddl/hardware/cpu/cpu_hw.h"
+
+// Elements per block, the live values of a block stay in cache while the
+// whole program runs over it
+#define EXPR_BLOCK 1024
+
+template <typename F>
+static inline void expr_binary(float *r, const float *a, const float *b, float v, int mode, int n, F f) {
+    if (mode == EXPR_VV) {
+        #pragma omp simd
+        for (int i = 0; i < n; i++) r[i] = f(a[i], b[i]);
+    }
+    else if (mode == EXPR_VS) {
+        #pragma omp simd
+        for (int i = 0; i < n; i++) r[i] = f(a[i], v);
+    }
+    else {
+        #pragma omp simd
+        for (int i = 0; i < n; i++) r[i] = f(v, a[i]);
+    }
+}
+
+template <typename F>
+static inline void expr_unary(float *r, const float *a, int n, F f) {
+    #pragma omp simd
+    for (int i = 0; i < n; i++) r[i] = f(a[i]);
+}
+
+// Runs the program over n elements starting at off. buf holds depth blocks,
+// st[k] points to the k-th live value (a block of buf or a loaded tensor)
+static double expr_block(ExprProgram *P, float *buf, const float **st, int off, int n) {
+    double sum = 0.0;
+    int k = 0;
+
+    for (const ExprOp &o : P->ops) {
+        float *r;
+        switch (o.op) {
+            case EXPR_LOAD:
+                st[k++] = P->T[o.arg]->ptr + off;
+                break;
+            case EXPR_CONST:
+                r = buf + (size_t)k * EXPR_BLOCK;
+                std::fill(r, r + n, o.val);
+                st[k++] = r;
+                break;
+            case EXPR_STORE:
+                k--;
+                if (o.arg < 0) {
+                    float s = 0.0f;
+                    #pragma omp simd reduction(+:s)
+                    for (int i = 0; i < n; i++) s += st[k][i];
+                    sum += s;
+                }
+                else if (st[k] != P->T[o.arg]->ptr + off)
+                    std::copy(st[k], st[k] + n, P->T[o.arg]->ptr + off);
+                break;
+            default:
+                if (o.op <= EXPR_DIV) {
+                    // binary, two operands on the stack only in VV mode
+                    int a = (o.arg == EXPR_VV) ? k - 2 : k - 1;
+                    r = buf + (size_t)a * EXPR_BLOCK;
+                    const float *x = st[a], *y = st[k - 1];
+                    if (o.op == EXPR_ADD) expr_binary(r, x, y, o.val, o.arg, n, [](float p, float q) { return p + q; });
+                    else if (o.op == EXPR_SUB) expr_binary(r, x, y, o.val, o.arg, n, [](float p, float q) { return p - q; });
+                    else if (o.op == EXPR_MUL) expr_binary(r, x, y, o.val, o.arg, n, [](float p, float q) { return p * q; });
+                    else expr_binary(r, x, y, o.val, o.arg, n, [](float p, float q) { return p / q; });
+                    st[a] = r;
+                    k = a + 1;
+                }
+                else {
+                    r = buf + (size_t)(k - 1) * EXPR_BLOCK;
+                    const float *x = st[k - 1];
+                    float v = o.val;
+                    switch (o.op) {
+                        case EXPR_NEG: expr_unary(r, x, n, [](float p) { return -p; }); break;
+                        case EXPR_SQR: expr_unary(r, x, n, [](float p) { return p * p; }); break;
+                        case EXPR_SQRT: expr_unary(r, x, n, [](float p) { return ::sqrtf(p); }); break;
+                        case EXPR_EXP: expr_unary(r, x, n, [](float p) { return ::expf(p); }); break;
+                        case EXPR_LOG: expr_unary(r, x, n, [](float p) { return ::logf(p); }); break;
+                        case EXPR_ABS: expr_unary(r, x, n, [](float p) { return ::fabsf(p); }); break;
+                        case EXPR_SIGN: expr_unary(r, x, n, [](float p) { return (float)((p > 0.0f) - (p < 0.0f)); }); break;
+                        case EXPR_POW: expr_unary(r, x, n, [v](float p) { return ::powf(p, v); }); break;
+                        case EXPR_MAX: expr_unary(r, x, n, [v](float p) { return std::max(p, v); }); break;
+                        case EXPR_MIN: expr_unary(r, x, n, [v](float p) { return std::min(p, v); }); break;
+                    }
+                    st[k - 1] = r;
+                }
+        }
+    }
+
+    return sum;
+}
+
+float cpu_eval(ExprProgram *P) {
+    int nblocks = (P->size + EXPR_BLOCK - 1) / EXPR_BLOCK;
+    double sum = 0.0;
+
+    #pragma omp parallel if(nblocks>1) reduction(+:sum)
+    {
+        vector<float> buf((size_t)P->depth * EXPR_BLOCK);
+        vector<const float *> st(P->depth);
+
+        #pragma omp for schedule(static)
+        for (int b = 0; b < nblocks; b++) {
+            int off = b * EXPR_BLOCK;
+            sum += expr_block(P, buf.data(), st.data(), off, std::min(EXPR_BLOCK, P->size - off));
+        }
+    }
+
+    return (float)sum;
+}
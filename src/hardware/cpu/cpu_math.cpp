@@ -8,6 +8,11 @@
 */
 
 
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+
 #include "eddl/hardware/cpu/cpu_hw.h"
 
 // CPU: Math (in-place) ********************************************
@@ -148,6 +153,18 @@ void cpu_round_(Tensor *A){
   for (int i = 0; i < A->size; ++i) A->ptr[i] = ::roundf(A->ptr[i]);
 }
 
+void cpu_round_bfloat16_(Tensor *A){
+  #pragma omp parallel for
+  for (int i = 0; i < A->size; ++i) {
+    uint32_t bits;
+    std::memcpy(&bits, &A->ptr[i], sizeof(bits));
+    if ((bits & 0x7fffffff) > 0x7f800000) continue;  // NaN
+    bits += 0x7fff + ((bits >> 16) & 1);  // Round to nearest, ties to even
+    bits &= 0xffff0000;
+    std::memcpy(&A->ptr[i], &bits, sizeof(bits));
+  }
+}
+
 void cpu_rsqrt_(Tensor *A){
   #pragma omp parallel for
   for (int i = 0; i < A->size; ++i) A->ptr[i] = 1.0f/::sqrtf(A->ptr[i]);
@@ -232,25 +249,101 @@ void cpu_inc(Tensor *A, Tensor *B) {
 }
 
 void cpu_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC) {
-  if (!tB) {
+  cpu_gemm(1.0f, A, tA, B, tB, incC ? 1.0f : 0.0f, C, nullptr, GEMM_ACT_NONE, 0.0f);
+}
+
+// c = alpha*b*a + beta*c, straight into c (no temporary)
+template<typename MB, typename MA, typename MC>
+static inline void gemm_panel(float alpha, const MB &b, const MA &a, float beta, MC c) {
+  if (beta == 0.0f) c.noalias() = alpha * (b * a);
+  else {
+    if (beta != 1.0f) c *= beta;
+    c.noalias() += alpha * (b * a);
+  }
+}
+
+void cpu_gemm(float alpha, Tensor *A, int tA, Tensor *B, int tB, float beta, Tensor *C, Tensor *bias, int act, float act_param) {
+  // Row-major tensors seen as column-major matrices are transposed: C^T = op(B)^T * op(A)^T
+  Eigen::Map<Eigen::MatrixXf> mA(A->ptr, A->shape[1], A->shape[0]);
+  Eigen::Map<Eigen::MatrixXf> mB(B->ptr, B->shape[1], B->shape[0]);
+  Eigen::Map<Eigen::MatrixXf> mC(C->ptr, C->shape[1], C->shape[0]);
+  int m = C->shape[0];
+  int n = C->shape[1];
+
+  // With an epilogue, C is computed by panels of rows that are finished while they are in cache
+  bool epilogue = (bias != nullptr) || (act != GEMM_ACT_NONE);
+  int panel = epilogue ? std::min(m, std::max(16, 16384 / n)) : m;
+
+  #pragma omp parallel for if (panel < m)
+  for (int i0 = 0; i0 < m; i0 += panel) {
+    int rows = std::min(panel, m - i0);
+    auto c = mC.middleCols(i0, rows);
+
     if (!tA) {
-      if (!incC) *(C->ptr2) = *(B->ptr2) * (*(A->ptr2));
-      else *(C->ptr2) += *(B->ptr2) * (*(A->ptr2));
+      if (!tB) gemm_panel(alpha, mB, mA.middleCols(i0, rows), beta, c);
+      else gemm_panel(alpha, mB.transpose(), mA.middleCols(i0, rows), beta, c);
     } else {
-      if (!incC) *(C->ptr2) = *(B->ptr2) * ((*(A->ptr2)).transpose());
-      else *(C->ptr2) += *(B->ptr2) * ((*(A->ptr2)).transpose());
+      if (!tB) gemm_panel(alpha, mB, mA.middleRows(i0, rows).transpose(), beta, c);
+      else gemm_panel(alpha, mB.transpose(), mA.middleRows(i0, rows).transpose(), beta, c);
+    }
+
+    if (bias != nullptr) {
+      for (int i = i0; i < i0 + rows; i++) {
+        float *row = C->ptr + (size_t)i * n;
+        #pragma omp simd
+        for (int j = 0; j < n; j++) row[j] += bias->ptr[j];
+      }
     }
-  } else {
+    if (act != GEMM_ACT_NONE) cpu_act_epilogue(C->ptr + (size_t)i0 * n, rows * n, act, act_param);
+  }
+}
+
+void cpu_batched_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC) {
+  // The last two dims are the matrices, the leading ones are a (strided) batch of them
+  int ar = A->shape[A->ndim - 2], ac = A->shape[A->ndim - 1];
+  int br = B->shape[B->ndim - 2], bc = B->shape[B->ndim - 1];
+  int cr = C->shape[C->ndim - 2], cc = C->shape[C->ndim - 1];
+  int nb = C->size / (cr * cc);
+
+  #pragma omp parallel for
+  for (int i = 0; i < nb; i++) {
+    // Column-major maps of row-major matrices are their transposes: C^T = op(B)^T * op(A)^T
+    Eigen::Map<Eigen::MatrixXf> mA(A->ptr + (size_t)i * ar * ac, ac, ar);
+    Eigen::Map<Eigen::MatrixXf> mB(B->ptr + (size_t)i * br * bc, bc, br);
+    Eigen::Map<Eigen::MatrixXf> mC(C->ptr + (size_t)i * cr * cc, cc, cr);
+    float beta = incC ? 1.0f : 0.0f;
+
     if (!tA) {
-      if (!incC) *(C->ptr2) = (*(B->ptr2)).transpose() * (*(A->ptr2));
-      else *(C->ptr2) += (*(B->ptr2)).transpose() * (*(A->ptr2));
+      if (!tB) gemm_panel(1.0f, mB, mA, beta, mC);
+      else gemm_panel(1.0f, mB.transpose(), mA, beta, mC);
     } else {
-      if (!incC) *(C->ptr2) = (*(B->ptr2)).transpose() * ((*(A->ptr2)).transpose());
-      else *(C->ptr2) += (*(B->ptr2)).transpose() * ((*(A->ptr2)).transpose());
+      if (!tB) gemm_panel(1.0f, mB, mA.transpose(), beta, mC);
+      else gemm_panel(1.0f, mB.transpose(), mA.transpose(), beta, mC);
     }
   }
 }
 
+void cpu_act_epilogue(float *ptr, int size, int act, float act_param) {
+  switch (act) {
+    case GEMM_ACT_RELU:
+      #pragma omp simd
+      for (int i = 0; i < size; i++) ptr[i] = (ptr[i] > 0.0f) ? ptr[i] : 0.0f;
+      break;
+    case GEMM_ACT_LEAKY_RELU:
+      #pragma omp simd
+      for (int i = 0; i < size; i++) ptr[i] = (ptr[i] > 0.0f) ? ptr[i] : act_param * ptr[i];
+      break;
+    case GEMM_ACT_SIGMOID:
+      for (int i = 0; i < size; i++) ptr[i] = 1.0f / (1.0f + std::exp(-ptr[i]));
+      break;
+    case GEMM_ACT_TANH:
+      for (int i = 0; i < size; i++) ptr[i] = std::tanh(ptr[i]);
+      break;
+    default:
+      break;
+  }
+}
+
 void cpu_el_div(Tensor *A, Tensor *B, Tensor *C, int incC) {
   #pragma omp parallel for
   for (int i = 0; i < A->size; i++)
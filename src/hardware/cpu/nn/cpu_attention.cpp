@@ -0,0 +1,159 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+typedef Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMatrix;
+typedef Eigen::Map<RowMatrix, 0, Eigen::OuterStride<> > HeadMap;
+
+// n rows of head h, starting at row r of a (batch*length) x (heads*head_dim) tensor
+static inline HeadMap head_rows(Tensor *T, int r, int n, int h, int dh)
+{
+  return HeadMap(T->ptr + (size_t)r * T->shape[1] + h * dh, n, dh, Eigen::OuterStride<>(T->shape[1]));
+}
+
+// Scores of keys after the query position are removed
+template<typename M>
+static inline void causal_mask(M s, int q0, int k0)
+{
+  const float ninf=-std::numeric_limits<float>::infinity();
+  for(int i=0;i<s.rows();i++)
+    for(int j=std::max(0,q0+i-k0+1);j<s.cols();j++)
+      s(i,j)=ninf;
+}
+
+
+// Every task is a tile of query rows of one head. Key/value tiles are streamed
+// and the softmax is rescaled as new row maxima appear (online softmax).
+void cpu_attention(AttentionDescriptor *D)
+{
+  const int T=D->tile;
+  const int dh=D->head_dim;
+  const int nqt=(D->lq+T-1)/T;
+  const int ntask=D->batch*D->heads*nqt;
+  const float ninf=-std::numeric_limits<float>::infinity();
+
+  #pragma omp parallel
+  {
+    RowMatrix S(T,T), acc(T,dh);
+    Eigen::VectorXf m(T), l(T);
+
+    #pragma omp for schedule(dynamic)
+    for(int t=0;t<ntask;t++) {
+      int b=t/(D->heads*nqt);
+      int h=(t/nqt)%D->heads;
+      int q0=(t%nqt)*T;
+      int nq=std::min(T,D->lq-q0);
+
+      HeadMap q=head_rows(D->Q,b*D->lq+q0,nq,h,dh);
+      acc.topRows(nq).setZero();
+      m.head(nq).setConstant(ninf);
+      l.head(nq).setZero();
+
+      // With the causal mask the first tile always has a visible key, so m is finite after it
+      int kend=D->causal ? q0+nq : D->lk;
+      for(int k0=0;k0<kend;k0+=T) {
+        int nk=std::min(T,kend-k0);
+        HeadMap k=head_rows(D->K,b*D->lk+k0,nk,h,dh);
+        HeadMap v=head_rows(D->V,b*D->lk+k0,nk,h,dh);
+
+        auto s=S.topLeftCorner(nq,nk);
+        s.noalias()=D->scale*(q*k.transpose());
+        if ((D->causal)&&(k0+nk>q0+1)) causal_mask(s,q0,k0);
+
+        for(int i=0;i<nq;i++) {
+          float mnew=std::max(m[i],s.row(i).maxCoeff());
+          float alpha=std::exp(m[i]-mnew);
+          s.row(i)=(s.row(i).array()-mnew).exp();
+          l[i]=l[i]*alpha+s.row(i).sum();
+          acc.row(i)*=alpha;
+          m[i]=mnew;
+        }
+        acc.topRows(nq).noalias()+=s*v;
+      }
+
+      HeadMap o=head_rows(D->O,b*D->lq+q0,nq,h,dh);
+      float *L=D->L->ptr+((size_t)b*D->heads+h)*D->lq+q0;
+      for(int i=0;i<nq;i++) {
+        o.row(i)=acc.row(i)/l[i];
+        L[i]=m[i]+std::log(l[i]);
+      }
+    }
+  }
+}
+
+
+// Every task is one head of one sample. The probabilities of each tile are
+// recomputed from the stored log-sum-exp instead of being kept from forward.
+void cpu_attention_back(AttentionDescriptor *D)
+{
+  const int T=D->tile;
+  const int dh=D->head_dim;
+  const int ntask=D->batch*D->heads;
+
+  #pragma omp parallel
+  {
+    RowMatrix S(T,T), dP(T,T), dk(T,dh), dv(T,dh);
+    Eigen::VectorXf rowdot(D->lq);
+
+    #pragma omp for schedule(dynamic)
+    for(int t=0;t<ntask;t++) {
+      int b=t/D->heads;
+      int h=t%D->heads;
+      const float *L=D->L->ptr+((size_t)b*D->heads+h)*D->lq;
+
+      // rowdot_i = dO_i . O_i
+      HeadMap dO=head_rows(D->dO,b*D->lq,D->lq,h,dh);
+      HeadMap O=head_rows(D->O,b*D->lq,D->lq,h,dh);
+      rowdot=(dO.array()*O.array()).rowwise().sum();
+      head_rows(D->dQ,b*D->lq,D->lq,h,dh).setZero();
+
+      for(int k0=0;k0<D->lk;k0+=T) {
+        int nk=std::min(T,D->lk-k0);
+        HeadMap k=head_rows(D->K,b*D->lk+k0,nk,h,dh);
+        HeadMap v=head_rows(D->V,b*D->lk+k0,nk,h,dh);
+        dk.topRows(nk).setZero();
+        dv.topRows(nk).setZero();
+
+        // Causal: queries before k0 see none of these keys
+        for(int q0=D->causal ? k0 : 0;q0<D->lq;q0+=T) {
+          int nq=std::min(T,D->lq-q0);
+          HeadMap q=head_rows(D->Q,b*D->lq+q0,nq,h,dh);
+          HeadMap dq=head_rows(D->dQ,b*D->lq+q0,nq,h,dh);
+          HeadMap dout=head_rows(D->dO,b*D->lq+q0,nq,h,dh);
+          Eigen::Map<const Eigen::VectorXf> lse(L+q0,nq);
+
+          // P = exp(S - lse)
+          auto p=S.topLeftCorner(nq,nk);
+          p.noalias()=D->scale*(q*k.transpose());
+          if ((D->causal)&&(k0+nk>q0+1)) causal_mask(p,q0,k0);
+          p=(p.array().colwise()-lse.array()).exp();
+
+          dv.topRows(nk).noalias()+=p.transpose()*dout;
+
+          // dS = P .* (dO*V^T - rowdot)
+          auto ds=dP.topLeftCorner(nq,nk);
+          ds.noalias()=dout*v.transpose();
+          ds=p.array()*(ds.array().colwise()-rowdot.segment(q0,nq).array());
+
+          dq.noalias()+=D->scale*(ds*k);
+          dk.topRows(nk).noalias()+=D->scale*(ds.transpose()*q);
+        }
+
+        head_rows(D->dK,b*D->lk+k0,nk,h,dh)=dk.topRows(nk);
+        head_rows(D->dV,b*D->lk+k0,nk,h,dh)=dv.topRows(nk);
+      }
+    }
+  }
+}
@@ -11,6 +11,7 @@
 #include <cstdio>      /* printf, scanf, NULL */
 #include <cstdlib>     /* malloc, free, rand */
 #include <iostream>
+#include <cmath>
 
 #include "eddl/hardware/cpu/nn/cpu_nn.h"
 
@@ -105,3 +106,117 @@ void cpu_permute_batch_first(Tensor *A,Tensor *B)
   }
 
 }
+
+
+// Row-wise normalization over the native layout (LayerNorm, GroupNorm)
+// A is seen as {rows, n}. gamma/beta hold n/inner values, element j of a
+// row uses gamma[j/inner] (inner=1 per-element, inner=H*W per-channel)
+void cpu_layernorm(Tensor *A, Tensor *B, Tensor *opa, Tensor *mean, Tensor *sd, Tensor *gamma, Tensor *beta, int rows, float epsilon)
+{
+  int n=A->size/rows;
+  int inner=(gamma!=nullptr)?n/gamma->size:1;
+
+  #pragma omp parallel for
+  for(int r=0;r<rows;r++) {
+    const float *x=A->ptr+(size_t)r*n;
+    float *xh=opa->ptr+(size_t)r*n;
+    float *y=B->ptr+(size_t)r*n;
+
+    float s=0.0f;
+    #pragma omp simd reduction(+:s)
+    for(int j=0;j<n;j++) s+=x[j];
+    float mu=s/n;
+
+    float v=0.0f;
+    #pragma omp simd reduction(+:v)
+    for(int j=0;j<n;j++) v+=(x[j]-mu)*(x[j]-mu);
+    float is=1.0f/::sqrtf(v/n+epsilon);
+
+    mean->ptr[r]=mu;
+    sd->ptr[r]=1.0f/is;
+
+    if (gamma==nullptr) {
+      #pragma omp simd
+      for(int j=0;j<n;j++) y[j]=xh[j]=(x[j]-mu)*is;
+    }
+    else {
+      for(int k=0,j=0;k<gamma->size;k++) {
+        float g=gamma->ptr[k];
+        float b=beta->ptr[k];
+        for(int i=0;i<inner;i++,j++) {
+          xh[j]=(x[j]-mu)*is;
+          y[j]=g*xh[j]+b;
+        }
+      }
+    }
+  }
+}
+
+// D is dE/dY, the result is accumulated into PD. Gradients of gamma and beta
+// are averaged over all the elements sharing each of them
+void cpu_layernorm_back(Tensor *D, Tensor *opa, Tensor *sd, Tensor *gamma, Tensor *ggamma, Tensor *gbeta, Tensor *PD, int rows)
+{
+  int n=D->size/rows;
+  int inner=(gamma!=nullptr)?n/gamma->size:1;
+
+  if (gamma!=nullptr) {
+    int gs=gamma->size;
+    float den=(float)rows*inner;
+
+    #pragma omp parallel for
+    for(int k=0;k<gs;k++) {
+      float sg=0.0f,sb=0.0f;
+      for(int r=0;r<rows;r++) {
+        const float *d=D->ptr+(size_t)r*n+(size_t)k*inner;
+        const float *xh=opa->ptr+(size_t)r*n+(size_t)k*inner;
+        for(int i=0;i<inner;i++) {
+          sg+=d[i]*xh[i];
+          sb+=d[i];
+        }
+      }
+      ggamma->ptr[k]+=sg/den;
+      gbeta->ptr[k]+=sb/den;
+    }
+  }
+
+  #pragma omp parallel for
+  for(int r=0;r<rows;r++) {
+    const float *d=D->ptr+(size_t)r*n;
+    const float *xh=opa->ptr+(size_t)r*n;
+    float *pd=PD->ptr+(size_t)r*n;
+
+    // dX = (g - mean(g) - xhat*mean(g*xhat)) / sd, with g = gamma*dY
+    float a=0.0f,c=0.0f;
+    if (gamma==nullptr) {
+      #pragma omp simd reduction(+:a,c)
+      for(int j=0;j<n;j++) {
+        a+=d[j];
+        c+=d[j]*xh[j];
+      }
+    }
+    else {
+      for(int k=0,j=0;k<gamma->size;k++) {
+        float g=gamma->ptr[k];
+        for(int i=0;i<inner;i++,j++) {
+          a+=g*d[j];
+          c+=g*d[j]*xh[j];
+        }
+      }
+    }
+    a/=n;
+    c/=n;
+    float is=1.0f/sd->ptr[r];
+
+    if (gamma==nullptr) {
+      #pragma omp simd
+      for(int j=0;j<n;j++) pd[j]+=(d[j]-a-xh[j]*c)*is;
+    }
+    else {
+      for(int k=0,j=0;k<gamma->size;k++) {
+        float g=gamma->ptr[k];
+        for(int i=0;i<inner;i++,j++)
+          pd[j]+=(g*d[j]-a-xh[j]*c)*is;
+      }
+    }
+  }
+}
@@ -10,7 +10,9 @@
 #include <cstdio>      /* printf, scanf, NULL */
 #include <cstdlib>     /* malloc, free, rand */
 #include <iostream>
+#include <algorithm>
 
+#include "eddl/hardware/cpu/cpu_hw.h"
 #include "eddl/hardware/cpu/nn/cpu_nn.h"
 
 
@@ -39,15 +41,53 @@ void add_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsi
 }
 
 
-void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im)
+// Range of output columns [x0,x1) whose input column x*sc-padcl+j*dc is inside the image
+static inline void valid_cols(ConvolDescriptor *D, int j, int &x0, int &x1)
 {
+  int lo=D->padcl-j*D->dc;
+  int hi=D->ic-1+D->padcl-j*D->dc;
+  x0=(lo>0) ? std::min(D->c, (lo+D->sc-1)/D->sc) : 0;
+  x1=(hi>=0) ? std::min(D->c, hi/D->sc+1) : 0;
+  x1=std::max(x0,x1);
+}
+
+// Lowering of 1D inputs (a single row): every (channel, tap) column is a
+// contiguous run of output positions, so the bounds are checked once per run
+static void im2col1D(int b,ConvolDescriptor *D,float *ptrI,float *img,int col2im,int zoff)
+{
+  for(int i=0;i<D->kz*D->kc;i++) {
+    int j=i%D->kc;
+    int off=j*D->dc-D->padcl;
+    float *col=ptrI+i*D->c;
+    float *row=img+(b*D->iz+zoff+i/D->kc)*D->ic;
+
+    int x0,x1;
+    valid_cols(D,j,x0,x1);
+    if (col2im) {
+      #pragma omp simd
+      for(int x=x0;x<x1;x++) row[x*D->sc+off]+=col[x];
+    }
+    else {
+      std::fill(col,col+x0,0.0f);
+      std::fill(col+x1,col+D->c,0.0f);
+      #pragma omp simd
+      for(int x=x0;x<x1;x++) col[x]=row[x*D->sc+off];
+    }
+  }
+}
+
+// Lowering of the image img (D->I or D->ID shaped), or its inverse (col2im) adding into img
+static void im2col(int b,ConvolDescriptor *D,float *ptrI,float *img,int col2im,int zoff)
+{
+  if ((D->ir==1)&&(D->kr==1)&&(D->r==1)) {
+    im2col1D(b,D,ptrI,img,col2im,zoff);
+    return;
+  }
+
   int i,j,k;
   int pz,py,px,y,x;
   int ksize=D->kr*D->kc;
-  int kr2=D->kr/2;
-  int kc2=D->kc/2;
-
-  if (kc2==0) kc2=-1;
+  int ox=0;
 
   int orsize=D->r*D->c;
 
@@ -59,65 +99,206 @@ void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im)
   px=-D->padcl;
 
 
-  for(j=0;j<D->matI.rows();j++) {
+  for(j=0;j<orsize;j++) {
     k=j;
 
-    for(i=0;i<D->matI.cols();i++,k+=orsize) {
-      pz=i/ksize;
-      y=py+(i%ksize)/D->kc;
-      x=px+(i%D->kc);
+    for(i=0;i<D->kz*ksize;i++,k+=orsize) {
+      pz=zoff+i/ksize;
+      y=py+((i%ksize)/D->kc)*D->dr;
+      x=px+(i%D->kc)*D->dc;
 
-      if(col2im)
-      add_pixel(b,x,y,pz,D,isize,irsize,ptrI[k]);
+      if ((x<0)||(y<0)||(x>=D->ic)||(y>=D->ir)) {  // padding
+        if (!col2im) ptrI[k]=0.0;
+      }
+      else if(col2im)
+      img[(b*isize)+(pz*irsize)+(y*D->ic)+x]+=ptrI[k];
       else
-      ptrI[k]=get_pixel(b,x,y,pz,D,isize,irsize);
+      ptrI[k]=img[(b*isize)+(pz*irsize)+(y*D->ic)+x];
 
     }
     px+=D->sc;
-    if (px>=D->ic+D->padcl-kc2-1) {
+    if (++ox==D->c) { // next output row
+      ox=0;
       px=-D->padcl;
       py+=D->sr;
     }
   }
 }
 
+void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im,int zoff)
+{
+  im2col(b,D,ptrI,col2im ? D->ID->ptr : D->I->ptr,col2im,zoff);
+}
 
-void cpu_conv2D(ConvolDescriptor *D)
+
+// Bias and fused activation of nk output maps starting at filter n0, done while they are in cache
+static inline void conv_epilogue(ConvolDescriptor *D,float *ptrO,int n0,int nk)
 {
-  int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
+  const int orsize=D->r*D->c;
 
-  float *ptrO=D->O->ptr;
-  float *ptrI=D->ptrI;
+  if (D->use_bias) {
+    for(int n=0;n<nk;n++) {
+      float *p=ptrO+n*orsize;
+      const float v=D->bias->ptr[n0+n];
+      #pragma omp simd
+      for(int i=0;i<orsize;i++) p[i]+=v;
+    }
+  }
+  if (D->act!=GEMM_ACT_NONE) cpu_act_epilogue(ptrO,nk*orsize,D->act,D->act_param);
+}
 
-  // Map memory to Eigen
-  new(&D->matK) Eigen::Map<Eigen::MatrixXf>(D->K->ptr, D->kr * D->kc * D->kz, D->nk);
-  new(&D->matI) Eigen::Map<Eigen::MatrixXf>(D->ptrI, D->r*D->c,D->kz*D->kr*D->kc);
+// Direct depthwise convolution (groups == input channels). Each filter
+// sees a single input channel, so there is no lowering: the inner loops
+// run along the output columns, and dilated taps are just strided reads.
+// KS>0 fixes the kernel size at compile time.
+template<int KS>
+static void cpu_depthwise_conv2D(ConvolDescriptor *D)
+{
+  const int kr=KS ? KS : D->kr;
+  const int kc=KS ? KS : D->kc;
+  const int mult=D->nk/D->groups;  // filters per input channel
+  const int irsize=D->ir*D->ic;
+  const int orsize=D->r*D->c;
+  const int off=-D->padcl;
+
+  #pragma omp parallel for collapse(2)
+  for(int b=0;b<D->I->shape[0];b++)
+  for(int n=0;n<D->nk;n++) {
+    const float *ptrI=D->I->ptr+(b*D->iz+n/mult)*irsize;
+    const float *ptrK=D->K->ptr+n*kr*kc;
+    float *ptrO=D->O->ptr+(b*D->z+n)*orsize;
+
+    std::fill(ptrO,ptrO+orsize,0.0f);
+    for(int y=0;y<D->r;y++) {
+      float *orow=ptrO+y*D->c;
+      for(int i=0;i<kr;i++) {
+        int iy=y*D->sr-D->padrt+i*D->dr;
+        if ((iy<0)||(iy>=D->ir)) continue;
+        const float *irow=ptrI+iy*D->ic;
+        for(int j=0;j<kc;j++) {
+          int x0,x1;
+          valid_cols(D,j,x0,x1);
+          const float w=ptrK[i*kc+j];
+          #pragma omp simd
+          for(int x=x0;x<x1;x++) orow[x]+=w*irow[x*D->sc+off+j*D->dc];
+        }
+      }
+    }
+    conv_epilogue(D,ptrO,n,1);
+  }
+}
 
+template<int KS>
+static void cpu_depthwise_conv2D_grad(ConvolDescriptor *D)
+{
+  const int kr=KS ? KS : D->kr;
+  const int kc=KS ? KS : D->kc;
+  const int mult=D->nk/D->groups;
+  const int irsize=D->ir*D->ic;
+  const int orsize=D->r*D->c;
+  const int off=-D->padcl;
+
+  // Every filter owns its gradient, no reduction among threads
   #pragma omp parallel for
-  for(int b=0;b<D->I->shape[0];b++){
+  for(int n=0;n<D->nk;n++) {
+    float *ptrgK=D->gK->ptr+n*kr*kc;
+    for(int b=0;b<D->I->shape[0];b++) {
+      const float *ptrI=D->I->ptr+(b*D->iz+n/mult)*irsize;
+      const float *ptrD=D->D->ptr+(b*D->z+n)*orsize;
+      for(int y=0;y<D->r;y++) {
+        const float *drow=ptrD+y*D->c;
+        for(int i=0;i<kr;i++) {
+          int iy=y*D->sr-D->padrt+i*D->dr;
+          if ((iy<0)||(iy>=D->ir)) continue;
+          const float *irow=ptrI+iy*D->ic;
+          for(int j=0;j<kc;j++) {
+            int x0,x1;
+            valid_cols(D,j,x0,x1);
+            float acc=0.0f;
+            #pragma omp simd reduction(+:acc)
+            for(int x=x0;x<x1;x++) acc+=drow[x]*irow[x*D->sc+off+j*D->dc];
+            ptrgK[i*kc+j]+=acc;
+          }
+        }
+      }
+    }
+  }
+}
 
-    float *ptrO=D->O->ptr+(b*osize);
-    float *ptrI=D->ptrI+(b*isize);
+template<int KS>
+static void cpu_depthwise_conv2D_back(ConvolDescriptor *D)
+{
+  const int kr=KS ? KS : D->kr;
+  const int kc=KS ? KS : D->kc;
+  const int mult=D->nk/D->groups;
+  const int irsize=D->ir*D->ic;
+  const int orsize=D->r*D->c;
+  const int off=-D->padcl;
+
+  // Threads own an input channel (and all the filters reading it)
+  #pragma omp parallel for collapse(2)
+  for(int b=0;b<D->I->shape[0];b++)
+  for(int g=0;g<D->groups;g++) {
+    float *ptrID=D->ID->ptr+(b*D->iz+g)*irsize;
+    for(int n=g*mult;n<(g+1)*mult;n++) {
+      const float *ptrK=D->K->ptr+n*kr*kc;
+      const float *ptrD=D->D->ptr+(b*D->z+n)*orsize;
+      for(int y=0;y<D->r;y++) {
+        const float *drow=ptrD+y*D->c;
+        for(int i=0;i<kr;i++) {
+          int iy=y*D->sr-D->padrt+i*D->dr;
+          if ((iy<0)||(iy>=D->ir)) continue;
+          float *irow=ptrID+iy*D->ic;
+          for(int j=0;j<kc;j++) {
+            int x0,x1;
+            valid_cols(D,j,x0,x1);
+            const float w=ptrK[i*kc+j];
+            #pragma omp simd
+            for(int x=x0;x<x1;x++) irow[x*D->sc+off+j*D->dc]+=w*drow[x];
+          }
+        }
+      }
+    }
+  }
+}
 
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matO=Eigen::Map<Eigen::MatrixXf>(ptrO,D->r*D->c,D->z);
 
-    im2col(b,D,ptrI,0);
+void cpu_conv2D(ConvolDescriptor *D)
+{
+  int osize=D->z*D->r*D->c;
 
-    matO=matI*D->matK;
-  }// batch
+  if (D->is_depthwise()) {
+    if ((D->kr==3)&&(D->kc==3)) cpu_depthwise_conv2D<3>(D);
+    else if ((D->kr==5)&&(D->kc==5)) cpu_depthwise_conv2D<5>(D);
+    else cpu_depthwise_conv2D<0>(D);
+  }
+  else {
+    int ksize=D->kz*D->kr*D->kc;         // lowering cols of a group
+    int gsize=D->r*D->c*ksize;           // lowering of a group
+    int isize=gsize*D->groups;           // lowering of a sample
+    int nkg=D->nk/D->groups;             // filters of a group
+
+    // Map memory to Eigen
+    new(&D->matK) Eigen::Map<Eigen::MatrixXf>(D->K->ptr, D->kr * D->kc * D->kz, D->nk);
+    new(&D->matI) Eigen::Map<Eigen::MatrixXf>(D->ptrI, D->r*D->c,D->kz*D->kr*D->kc);
+
+    Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr,ksize,D->nk);
 
-  //bias
-  if (D->use_bias) {
     #pragma omp parallel for
-    for(int b=0;b<D->O->shape[0];b++) {
-      float *ptrO=D->O->ptr+(b*osize);
-      for(int z=0;z<D->O->shape[1];z++)
-      for(int r=0;r<D->O->shape[2];r++)
-      for(int c=0;c<D->O->shape[3];c++,ptrO++)
-      (*ptrO)+=D->bias->ptr[z];
-    }
+    for(int b=0;b<D->I->shape[0];b++){
+      for(int g=0;g<D->groups;g++) {
+        float *ptrO=D->O->ptr+(b*osize)+(g*nkg*D->r*D->c);
+        float *ptrI=D->ptrI+(b*isize)+(g*gsize);
+
+        Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,ksize);
+        Eigen::Map<Eigen::MatrixXf> matO=Eigen::Map<Eigen::MatrixXf>(ptrO,D->r*D->c,nkg);
+
+        im2col(b,D,ptrI,0,g*D->kz);
+
+        matO.noalias()=matI*matK.middleCols(g*nkg,nkg);
+        conv_epilogue(D,ptrO,g*nkg,nkg);
+      }
+    }// batch
   }
 
 }
@@ -126,22 +307,36 @@ void cpu_conv2D_grad(ConvolDescriptor *D)
 {
   //return;
   int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
 
-  // Map memory to Eigen
-  new(&D->matgK) Eigen::Map<Eigen::MatrixXf>(D->gK->ptr, D->kr * D->kc * D->kz, D->nk);
+  if (D->is_depthwise()) {
+    if ((D->kr==3)&&(D->kc==3)) cpu_depthwise_conv2D_grad<3>(D);
+    else if ((D->kr==5)&&(D->kc==5)) cpu_depthwise_conv2D_grad<5>(D);
+    else cpu_depthwise_conv2D_grad<0>(D);
+  }
+  else {
+    int ksize=D->kz*D->kr*D->kc;
+    int gsize=D->r*D->c*ksize;
+    int isize=gsize*D->groups;
+    int nkg=D->nk/D->groups;
 
-  //#pragma omp parallel for
-  for(int b=0;b<D->I->shape[0];b++){
+    // Map memory to Eigen
+    new(&D->matgK) Eigen::Map<Eigen::MatrixXf>(D->gK->ptr, D->kr * D->kc * D->kz, D->nk);
 
-    float *ptrD=D->D->ptr+(b*osize);
-    float *ptrI=D->ptrI+(b*isize);
+    Eigen::Map<Eigen::MatrixXf> matgK=Eigen::Map<Eigen::MatrixXf>(D->gK->ptr,ksize,D->nk);
 
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,D->z);
+    //#pragma omp parallel for
+    for(int b=0;b<D->I->shape[0];b++){
+      for(int g=0;g<D->groups;g++) {
+        float *ptrD=D->D->ptr+(b*osize)+(g*nkg*D->r*D->c);
+        float *ptrI=D->ptrI+(b*isize)+(g*gsize);
 
-    D->matgK+=matI.transpose()*matD;
-  }// batch
+        Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,ksize);
+        Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,nkg);
+
+        matgK.middleCols(g*nkg,nkg).noalias()+=matI.transpose()*matD;
+      }
+    }// batch
+  }
 
   //bias
 
@@ -149,9 +344,9 @@ void cpu_conv2D_grad(ConvolDescriptor *D)
   if (D->use_bias) {
     for(int b=0;b<D->D->shape[0];b++) {
       float *ptrD=D->D->ptr+(b*osize);
-      for(int z=0;z<D->D->shape[1];z++)
-      for(int r=0;r<D->D->shape[2];r++)
-      for(int c=0;c<D->D->shape[3];c++,ptrD++)
+      for(int z=0;z<D->z;z++)
+      for(int r=0;r<D->r;r++)
+      for(int c=0;c<D->c;c++,ptrD++)
       D->gbias->ptr[z]+=(*ptrD);
 
     }
@@ -160,28 +355,121 @@ void cpu_conv2D_grad(ConvolDescriptor *D)
 
 void cpu_conv2D_back(ConvolDescriptor *D)
 {
-  int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
+  if (D->is_depthwise()) {
+    if ((D->kr==3)&&(D->kc==3)) cpu_depthwise_conv2D_back<3>(D);
+    else if ((D->kr==5)&&(D->kc==5)) cpu_depthwise_conv2D_back<5>(D);
+    else cpu_depthwise_conv2D_back<0>(D);
+    return;
+  }
 
-  float *ptrD=D->D->ptr;
-  float *ptrI=D->ptrI;
+  int osize=D->z*D->r*D->c;
+  int ksize=D->kz*D->kr*D->kc;
+  int gsize=D->r*D->c*ksize;
+  int isize=gsize*D->groups;
+  int nkg=D->nk/D->groups;
 
   // Map memory to Eigen
   new(&D->matK) Eigen::Map<Eigen::MatrixXf>(D->K->ptr, D->kr * D->kc * D->kz, D->nk);
-  new (&(D->matI)) Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
+  new (&(D->matI)) Eigen::Map<Eigen::MatrixXf>(D->ptrI,D->r*D->c,D->kz*D->kr*D->kc);
+
+  Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr,ksize,D->nk);
 
   #pragma omp parallel for
   for(int b=0;b<D->I->shape[0];b++){
+    for(int g=0;g<D->groups;g++) {
+      float *ptrD=D->D->ptr+(b*osize)+(g*nkg*D->r*D->c);
+      float *ptrI=D->ptrI+(b*isize)+(g*gsize);
 
-    float *ptrD=D->D->ptr+(b*osize);
+      Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,ksize);
+      Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,nkg);
+
+      matI.noalias()=matD*matK.middleCols(g*nkg,nkg).transpose();
+
+      im2col(b,D,ptrI,1,g*D->kz);
+    }
+  }// batch
+}
+
+
+// Transposed convolution (A -> B) as the adjoint of the direct convolution D,
+// which is built over B: A has the shape of D->O, and its forward is the GEMM
+// + col2im of cpu_conv2D_back
+void cpu_convT2D(ConvolDescriptor *D, Tensor *A, Tensor *B)
+{
+  int asize=D->z*D->r*D->c;
+  int bsize=D->iz*D->ir*D->ic;
+  int ksize=D->kz*D->kr*D->kc;
+  int isize=D->r*D->c*ksize;
+
+  Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr,ksize,D->nk);
+
+  #pragma omp parallel for
+  for(int b=0;b<A->shape[0];b++){
     float *ptrI=D->ptrI+(b*isize);
+    float *ptrB=B->ptr+(b*bsize);
+
+    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,ksize);
+    Eigen::Map<Eigen::MatrixXf> matA=Eigen::Map<Eigen::MatrixXf>(A->ptr+(b*asize),D->r*D->c,D->nk);
 
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,D->z);
+    matI.noalias()=matA*matK.transpose();
+
+    std::fill(ptrB,ptrB+bsize,0.0f);
+    im2col(b,D,ptrI,B->ptr,1,0);
+
+    //bias
+    if (D->use_bias) {
+      for(int z=0;z<D->iz;z++)
+      for(int i=0;i<D->ir*D->ic;i++,ptrB++)
+      (*ptrB)+=D->bias->ptr[z];
+    }
+  }// batch
+}
+
+void cpu_convT2D_grad(ConvolDescriptor *D, Tensor *A, Tensor *DB)
+{
+  int asize=D->z*D->r*D->c;
+  int ksize=D->kz*D->kr*D->kc;
+  int isize=D->r*D->c*ksize;
+
+  Eigen::Map<Eigen::MatrixXf> matgK=Eigen::Map<Eigen::MatrixXf>(D->gK->ptr,ksize,D->nk);
+
+  // The lowering of DB is left in ptrI by cpu_convT2D_back
+  for(int b=0;b<A->shape[0];b++){
+    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(D->ptrI+(b*isize),D->r*D->c,ksize);
+    Eigen::Map<Eigen::MatrixXf> matA=Eigen::Map<Eigen::MatrixXf>(A->ptr+(b*asize),D->r*D->c,D->nk);
+
+    matgK.noalias()+=matI.transpose()*matA;
+  }// batch
+
+  //bias
+  if (D->use_bias) {
+    for(int b=0;b<DB->shape[0];b++) {
+      float *ptrD=DB->ptr+(b*D->iz*D->ir*D->ic);
+      for(int z=0;z<D->iz;z++)
+      for(int i=0;i<D->ir*D->ic;i++,ptrD++)
+      D->gbias->ptr[z]+=(*ptrD);
+    }
+  }
+}
+
+void cpu_convT2D_back(ConvolDescriptor *D, Tensor *DB, Tensor *DA)
+{
+  int asize=D->z*D->r*D->c;
+  int ksize=D->kz*D->kr*D->kc;
+  int isize=D->r*D->c*ksize;
+
+  Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr,ksize,D->nk);
+
+  // The direct convolution of DB
+  #pragma omp parallel for
+  for(int b=0;b<DB->shape[0];b++){
+    float *ptrI=D->ptrI+(b*isize);
 
-    matI=matD*D->matK.transpose();
+    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,ksize);
+    Eigen::Map<Eigen::MatrixXf> matDA=Eigen::Map<Eigen::MatrixXf>(DA->ptr+(b*asize),D->r*D->c,D->nk);
 
-    im2col(b,D,ptrI,1);
+    im2col(b,D,ptrI,DB->ptr,0,0);
 
+    matDA.noalias()+=matI*matK;
   }// batch
 }
@@ -0,0 +1,89 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cmath>
+#include <algorithm>
+
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+// Row-sparse gradients (see Layer::sparse_rows), only the listed rows of
+// the 2D parameter, gradient and state tensors are read or written
+
+void cpu_zero_rows(Tensor *A, const vector<int> &rows){
+    int s = A->size / A->shape[0];
+
+    #pragma omp parallel for
+    for (int k = 0; k < (int)rows.size(); k++)
+        std::fill(A->ptr + (size_t)rows[k] * s, A->ptr + (size_t)(rows[k] + 1) * s, 0.0f);
+}
+
+// Each id is unique, so rows are accumulated without races
+void cpu_inc_rows(Tensor *D, Tensor *G, const vector<int> &ids, const vector<int> &start, const vector<int> &order, bool mask_zeros){
+    int s = G->size / G->shape[0];
+
+    #pragma omp parallel for
+    for (int k = 0; k < (int)ids.size(); k++) {
+        if ((mask_zeros) && (ids[k] == 0)) continue;
+        float *g = G->ptr + (size_t)ids[k] * s;
+        for (int p = start[k]; p < start[k + 1]; p++) {
+            const float *d = D->ptr + (size_t)order[p] * s;
+            for (int j = 0; j < s; j++) g[j] += d[j];
+        }
+    }
+}
+
+// Same update as SGD::update_layer restricted to the listed rows
+void cpu_sgd_rows(Tensor *W, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu){
+    int s = W->size / W->shape[0];
+
+    #pragma omp parallel for
+    for (int k = 0; k < (int)rows.size(); k++) {
+        size_t o = (size_t)rows[k] * s;
+        float *w = W->ptr + o, *g = G->ptr + o, *m = M->ptr + o;
+        for (int j = 0; j < s; j++) {
+            m[j] = lr * g[j] + mu * m[j];
+            w[j] -= m[j];
+        }
+    }
+}
+
+// Lazy Adam: moments of rows without gradient are not decayed
+void cpu_adam_rows(Tensor *W, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1, float beta_2, float epsilon, int t){
+    int s = W->size / W->shape[0];
+    float c1 = 1.0f - ::powf(beta_1, t);
+    float c2 = 1.0f - ::powf(beta_2, t);
+
+    #pragma omp parallel for
+    for (int k = 0; k < (int)rows.size(); k++) {
+        size_t o = (size_t)rows[k] * s;
+        float *w = W->ptr + o, *g = G->ptr + o, *m = M->ptr + o, *v = V->ptr + o;
+        for (int j = 0; j < s; j++) {
+            m[j] = beta_1 * m[j] + (1.0f - beta_1) * g[j];
+            v[j] = beta_2 * v[j] + (1.0f - beta_2) * g[j] * g[j];
+            w[j] -= lr * (m[j] / c1) / ::sqrtf(v[j] / c2 + epsilon);
+        }
+    }
+}
+
+// Same update as RMSProp::update_layer restricted to the listed rows
+void cpu_rmsprop_rows(Tensor *W, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon){
+    int s = W->size / W->shape[0];
+
+    #pragma omp parallel for
+    for (int k = 0; k < (int)rows.size(); k++) {
+        size_t o = (size_t)rows[k] * s;
+        float *w = W->ptr + o, *g = G->ptr + o, *g1 = G1->ptr + o;
+        for (int j = 0; j < s; j++) {
+            float a = (1.0f - rho) * g[j] * g[j] + rho * g1[j] * g1[j];
+            w[j] -= lr * g[j] / ::sqrtf(a + epsilon);
+            g1[j] = g[j];
+        }
+    }
+}
@@ -13,125 +13,219 @@
 #include <cstdlib>     /* malloc, free, rand */
 #include <iostream>
 #include <limits>       // std::numeric_limits
+#include <algorithm>
 
 #include "eddl/hardware/cpu/nn/cpu_nn.h"
 
 
-void cpu_mpool2D(PoolDescriptor *D){
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size;  // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
-
-                    // Get max value in window
-                    float max = std::numeric_limits<float>::min();
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-
-                            // Get value W[ki,kj] value in window
-                            float v = get_pixel(b,j+kj,i+ki, k, D, isize, irsize);
-                            if (v>max) {
-                                max = v;
-                                D->indX->ptr[p] = j+kj;
-                                D->indY->ptr[p] = i+ki;
-                            }
-
-                        } // kernel cols
-                    }  // kernel rows
-
-                    // Set output value
-                    D->O->ptr[p] = max;
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+// Window of output (y,x) clipped to the input plane, so the taps need no bounds checks
+static inline void pool_window(PoolDescriptor *D, int y, int x, int &r0, int &r1, int &c0, int &c1) {
+    int i = y*D->sr - D->padrt;
+    int j = x*D->sc - D->padcl;
+    r0 = std::max(i, 0); r1 = std::min(i + D->kr, D->ir);
+    c0 = std::max(j, 0); c1 = std::min(j + D->kc, D->ic);
 }
 
-void cpu_mpool2D_back(PoolDescriptor *D){
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches (ob=ib)
-        int p=b*D->size; // Kernel's index (opt. shared variable)
+// A single window covering the whole plane (GlobalMaxPool, GlobalAveragePool)
+static inline bool pool_is_global(PoolDescriptor *D) {
+    return (D->r == 1) && (D->c == 1) && (D->kr == D->ir) && (D->kc == D->ic) && !(D->padrt || D->padrb || D->padcl || D->padcr);
+}
 
-        for(int k=0; k<D->iz; k++) { // Depth: front-back (oz=iz)
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
+// Max of one channel plane, padding is left out of the windows. The argmax is
+// kept as an int32 offset in the input plane, -1 (and a 0 output) for a window
+// that lies entirely in the padding. KS>0 fixes a KSxKS kernel at
+// compile time for the windows that are fully inside the plane.
+template<int KS>
+static void mpool2D_plane(PoolDescriptor *D, const float *ptrI, float *ptrO, int *ind) {
+    const int kr = KS ? KS : D->kr;
+    const int kc = KS ? KS : D->kc;
+
+    for(int y=0, p=0; y<D->r; y++) {
+        for(int x=0; x<D->c; x++, p++) {
+            int r0, r1, c0, c1;
+            pool_window(D, y, x, r0, r1, c0, c1);
+
+            if ((r0 >= r1) || (c0 >= c1)) {
+                ptrO[p] = 0.0f;
+                ind[p] = -1;
+                continue;
+            }
+
+            float max = std::numeric_limits<float>::lowest();
+            int arg = r0*D->ic + c0;
+            if (KS && (r1 - r0 == kr) && (c1 - c0 == kc)) {
+                for(int ki=0; ki<kr; ki++) {
+                    const float *row = ptrI + (r0 + ki)*D->ic + c0;
+                    for(int kj=0; kj<kc; kj++)
+                        if (row[kj] > max) { max = row[kj]; arg = (r0 + ki)*D->ic + c0 + kj; }
+                }
+            }
+            else {
+                for(int i=r0; i<r1; i++)
+                    for(int j=c0; j<c1; j++)
+                        if (ptrI[i*D->ic + j] > max) { max = ptrI[i*D->ic + j]; arg = i*D->ic + j; }
+            }
+            ptrO[p] = max;
+            ind[p] = arg;
+        }
+    }
+}
 
-                    int x = D->indX->ptr[p];  // previous: j+kj
-                    int y = D->indY->ptr[p];  // previous: i+ki
-                    add_pixel(b, x, y, k, D, isize, irsize, D->D->ptr[p]);  // Set input's delta
+void cpu_mpool2D(PoolDescriptor *D){
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const bool global = pool_is_global(D);
+
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            const float *ptrI = D->I->ptr + (size_t)(b*D->iz + k)*irsize;
+            float *ptrO = D->O->ptr + (size_t)(b*D->z + k)*orsize;
+            int *ind = D->ind.data() + (size_t)(b*D->z + k)*orsize;
+
+            if (global) {
+                const float *m = std::max_element(ptrI, ptrI + irsize);
+                ptrO[0] = *m;
+                ind[0] = (int)(m - ptrI);
+            }
+            else if ((D->kr == 2) && (D->kc == 2)) mpool2D_plane<2>(D, ptrI, ptrO, ind);
+            else if ((D->kr == 3) && (D->kc == 3)) mpool2D_plane<3>(D, ptrI, ptrO, ind);
+            else mpool2D_plane<0>(D, ptrI, ptrO, ind);
+        }
+    }
+}
 
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+void cpu_mpool2D_back(PoolDescriptor *D){
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            float *ptrID = D->ID->ptr + (size_t)(b*D->iz + k)*irsize;
+            const float *ptrD = D->D->ptr + (size_t)(b*D->z + k)*orsize;
+            const int *ind = D->ind.data() + (size_t)(b*D->z + k)*orsize;
+
+            for(int p=0; p<orsize; p++)
+                if (ind[p] >= 0) ptrID[ind[p]] += ptrD[p];
+        }
+    }
 }
 
-void cpu_avgpool2D(PoolDescriptor *D){
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-    int ksize = D->kr*D->kc;
+// Sliding window over (batch x channels x length) tensors. The padded
+// positions are left out of the window instead of read as zeros.
+void cpu_mpool1D(PoolDescriptor *D){
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            const float *ptrI = D->I->ptr + (b*D->iz + k)*D->ic;
+            float *ptrO = D->O->ptr + (b*D->z + k)*D->c;
+            int *ind = D->ind.data() + (size_t)(b*D->z + k)*D->c;
+
+            for(int x=0; x<D->c; x++) {
+                int j0 = x*D->sc - D->padcl;
+                int lo = std::max(j0, 0);
+                int hi = std::min(j0 + D->kc, D->ic);
+                if (lo >= hi) {  // window in the padding
+                    ptrO[x] = 0.0f;
+                    ind[x] = -1;
+                    continue;
+                }
+
+                float max = std::numeric_limits<float>::lowest();
+                int arg = lo;
+                for(int j=lo; j<hi; j++) {
+                    if (ptrI[j] > max) {
+                        max = ptrI[j];
+                        arg = j;
+                    }
+                }
+                ptrO[x] = max;
+                ind[x] = arg;
+            }
+        }
+    }
+}
 
-    #pragma omp parallel for default(none) shared(D, isize, irsize, ksize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size; // Kernel's index (opt. shared variable)
+void cpu_mpool1D_back(PoolDescriptor *D){
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            float *ptrID = D->ID->ptr + (b*D->iz + k)*D->ic;
+            const float *ptrD = D->D->ptr + (b*D->z + k)*D->c;
+            const int *ind = D->ind.data() + (size_t)(b*D->z + k)*D->c;
+
+            for(int x=0; x<D->c; x++)
+                if (ind[x] >= 0) ptrID[ind[x]] += ptrD[x];
+        }
+    }
+}
 
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
+// The divisor is always the kernel size, padded positions count as zeros
+void cpu_avgpool2D(PoolDescriptor *D){
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const float inv = 1.0f/(float)(D->kr*D->kc);
+    const bool global = pool_is_global(D);
+
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            const float *ptrI = D->I->ptr + (size_t)(b*D->iz + k)*irsize;
+            float *ptrO = D->O->ptr + (size_t)(b*D->z + k)*orsize;
+
+            if (global) {
+                float sum = 0.0f;
+                #pragma omp simd reduction(+:sum)
+                for(int i=0; i<irsize; i++) sum += ptrI[i];
+                ptrO[0] = sum*inv;
+                continue;
+            }
+
+            for(int y=0, p=0; y<D->r; y++) {
+                for(int x=0; x<D->c; x++, p++) {
+                    int r0, r1, c0, c1;
+                    pool_window(D, y, x, r0, r1, c0, c1);
 
-                    // Sum values window
                     float sum = 0.0f;
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-
-                            // Get value W[ki,kj] value in window
-                            float v = get_pixel(b,j+kj,i+ki, k, D, isize, irsize);
-                            sum += v;
-
-                        } // kernel cols
-                    }  // kernel rows
-
-                    // Set output value
-                    D->O->ptr[p]= sum/(float)ksize;
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+                    for(int i=r0; i<r1; i++)
+                        for(int j=c0; j<c1; j++) sum += ptrI[i*D->ic + j];
+                    ptrO[p] = sum*inv;
+                }
+            }
+        }
+    }
 }
 
 void cpu_avgpool2D_back(PoolDescriptor *D){
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-    int ksize = D->kr*D->kc;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize, ksize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size; // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc,p++) { // cols: left-right
-
-                    // Walk kernel window to equally distribute the delta among all the elements
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-                            add_pixel(b, j + kj, i + ki, k, D, isize, irsize, D->D->ptr[p]/(float)ksize);
-                        } // kernel cols
-                    }  // kernel rows
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const float inv = 1.0f/(float)(D->kr*D->kc);
+    const bool global = pool_is_global(D);
+
+    #pragma omp parallel for collapse(2)
+    for(int b=0; b<D->I->shape[0]; b++){
+        for(int k=0; k<D->iz; k++) {
+            float *ptrID = D->ID->ptr + (size_t)(b*D->iz + k)*irsize;
+            const float *ptrD = D->D->ptr + (size_t)(b*D->z + k)*orsize;
+
+            if (global) {
+                const float v = ptrD[0]*inv;
+                #pragma omp simd
+                for(int i=0; i<irsize; i++) ptrID[i] += v;
+                continue;
+            }
+
+            for(int y=0, p=0; y<D->r; y++) {
+                for(int x=0; x<D->c; x++, p++) {
+                    int r0, r1, c0, c1;
+                    pool_window(D, y, x, r0, r1, c0, c1);
+
+                    const float v = ptrD[p]*inv;
+                    for(int i=r0; i<r1; i++)
+                        for(int j=c0; j<c1; j++) ptrID[i*D->ic + j] += v;
+                }
+            }
+        }
+    }
 }
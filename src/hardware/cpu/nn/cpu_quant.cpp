@@ -0,0 +1,335 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define INT8_X86
+#endif
+
+#include "eddl/hardware/cpu/cpu_hw.h"
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+
+// Register blocking: MR rows of A times NR blocks of QUANT_NB filters
+#define INT8_MR 4
+#define INT8_NR 2
+// Cache blocking: rows of A per tile, and bytes of packed weights per tile (L2)
+#define INT8_MC 64
+#define INT8_WC (192 * 1024)
+
+
+static inline uint8_t quantize_u8(float x, float inv_scale, int zero) {
+    int q = (int)std::nearbyint(x * inv_scale) + zero;
+    return (uint8_t)(q < 0 ? 0 : (q > 255 ? 255 : q));
+}
+
+static inline int32_t load4(const uint8_t *p) {
+    int32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// q[i] = quantize_u8(a[i]); cvtps rounds to nearest even, as nearbyint
+static void quantize_run(const float *a, long n, float inv_scale, int zero, uint8_t *q) {
+    long i = 0;
+#ifdef INT8_X86
+    __m128 s = _mm_set1_ps(inv_scale);
+    __m128 lo = _mm_set1_ps((float)-zero);
+    __m128 hi = _mm_set1_ps((float)(255 - zero));
+    __m128i z = _mm_set1_epi32(zero);
+    for (; i + 16 <= n; i += 16) {
+        __m128i v[4];
+        for (int j = 0; j < 4; j++) {
+            __m128 x = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(a + i + 4 * j), s), lo), hi);
+            v[j] = _mm_add_epi32(_mm_cvtps_epi32(x), z);
+        }
+        _mm_storeu_si128((__m128i *)(q + i), _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3])));
+    }
+#endif
+    for (; i < n; i++) q[i] = quantize_u8(a[i], inv_scale, zero);
+}
+
+
+// Micro-kernels: acc[r][j] = A[r] . filter j, for mr rows and nr blocks of
+// packed weights (blocks are bs bytes apart), over k4 groups of 4 k
+
+static void kernel_scalar(const uint8_t *A, int lda, int mr, const int8_t *W, size_t bs, int nr, int k4, int32_t acc[INT8_MR][INT8_NR * QUANT_NB]) {
+    for (int r = 0; r < mr; r++)
+        for (int j = 0; j < nr * QUANT_NB; j++) {
+            const uint8_t *a = A + (size_t)r * lda;
+            const int8_t *w = W + (j / QUANT_NB) * bs + (j % QUANT_NB) * 4;
+            int32_t s = 0;
+            for (int k = 0; k < k4; k++, a += 4, w += 4 * QUANT_NB)
+                s += a[0] * w[0] + a[1] * w[1] + a[2] * w[2] + a[3] * w[3];
+            acc[r][j] = s;
+        }
+}
+
+#ifdef INT8_X86
+
+// vpdpbusd: 16 filters x 4 k per instruction
+template<int MR, int NR>
+__attribute__((target("avx512f,avx512bw,avx512vnni")))
+static void kernel_vnni(const uint8_t *A, int lda, const int8_t *W, size_t bs, int k4, int32_t acc[INT8_MR][INT8_NR * QUANT_NB]) {
+    __m512i c[MR][NR];
+    for (int r = 0; r < MR; r++)
+        for (int j = 0; j < NR; j++) c[r][j] = _mm512_setzero_si512();
+
+    for (int k = 0; k < k4; k++) {
+        __m512i w[NR];
+        for (int j = 0; j < NR; j++) w[j] = _mm512_loadu_si512(W + j * bs + k * 4 * QUANT_NB);
+        for (int r = 0; r < MR; r++) {
+            __m512i a = _mm512_set1_epi32(load4(A + (size_t)r * lda + k * 4));
+            for (int j = 0; j < NR; j++) c[r][j] = _mm512_dpbusd_epi32(c[r][j], a, w[j]);
+        }
+    }
+
+    for (int r = 0; r < MR; r++)
+        for (int j = 0; j < NR; j++) _mm512_storeu_si512(acc[r] + j * QUANT_NB, c[r][j]);
+}
+
+// vpmaddubsw would saturate (255 * 127 * 2 > 32767), so A and W are widened
+// to 16 bits and multiplied with vpmaddwd, which is exact. Each register
+// holds 4 filters x 4 k, added in pairs of k: c[r][q] ends with 2 partial
+// sums per filter
+template<int MR>
+__attribute__((target("avx2")))
+static void kernel_avx2(const uint8_t *A, int lda, const int8_t *W, int k4, int32_t acc[INT8_MR][INT8_NR * QUANT_NB]) {
+    __m256i c[MR][4];
+    for (int r = 0; r < MR; r++)
+        for (int q = 0; q < 4; q++) c[r][q] = _mm256_setzero_si256();
+
+    for (int k = 0; k < k4; k++) {
+        __m256i w[4];
+        for (int q = 0; q < 4; q++)
+            w[q] = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(W + k * 4 * QUANT_NB + q * 16)));
+        for (int r = 0; r < MR; r++) {
+            __m256i a = _mm256_cvtepu8_epi16(_mm_set1_epi32(load4(A + (size_t)r * lda + k * 4)));
+            for (int q = 0; q < 4; q++) c[r][q] = _mm256_add_epi32(c[r][q], _mm256_madd_epi16(a, w[q]));
+        }
+    }
+
+    // hadd leaves filters (0,1,4,5 | 2,3,6,7) of each pair of registers
+    const __m256i order = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+    for (int r = 0; r < MR; r++) {
+        __m256i lo = _mm256_permutevar8x32_epi32(_mm256_hadd_epi32(c[r][0], c[r][1]), order);
+        __m256i hi = _mm256_permutevar8x32_epi32(_mm256_hadd_epi32(c[r][2], c[r][3]), order);
+        _mm256_storeu_si256((__m256i *)(acc[r]), lo);
+        _mm256_storeu_si256((__m256i *)(acc[r] + 8), hi);
+    }
+}
+
+#endif
+
+static int int8_isa = -1;  // forced kernel, -1 for the best one
+
+static int int8_best_isa() {
+#ifdef INT8_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw")) return INT8_VNNI;
+    if (__builtin_cpu_supports("avx2")) return INT8_AVX2;
+#endif
+    return INT8_SCALAR;
+}
+
+int cpu_int8_isa() {
+    static const int best = int8_best_isa();
+    return (int8_isa < 0) ? best : int8_isa;
+}
+
+void cpu_set_int8_isa(int isa) {
+    if ((isa < -1) || (isa > int8_best_isa())) msg("Int8 kernel not supported by this CPU", "cpu_set_int8_isa");
+    int8_isa = isa;
+}
+
+static void micro_kernel(int isa, const uint8_t *A, int lda, int mr, const int8_t *W, size_t bs, int nr, int k4, int32_t acc[INT8_MR][INT8_NR * QUANT_NB]) {
+#ifdef INT8_X86
+    if (isa == INT8_VNNI) {
+        if (nr == INT8_NR) {
+            switch (mr) {
+                case 4: kernel_vnni<4, 2>(A, lda, W, bs, k4, acc); return;
+                case 3: kernel_vnni<3, 2>(A, lda, W, bs, k4, acc); return;
+                case 2: kernel_vnni<2, 2>(A, lda, W, bs, k4, acc); return;
+                default: kernel_vnni<1, 2>(A, lda, W, bs, k4, acc); return;
+            }
+        }
+        switch (mr) {
+            case 4: kernel_vnni<4, 1>(A, lda, W, bs, k4, acc); return;
+            case 3: kernel_vnni<3, 1>(A, lda, W, bs, k4, acc); return;
+            case 2: kernel_vnni<2, 1>(A, lda, W, bs, k4, acc); return;
+            default: kernel_vnni<1, 1>(A, lda, W, bs, k4, acc); return;
+        }
+    }
+    if (isa == INT8_AVX2) {
+        // One block at a time, 2 rows keep the accumulators in registers
+        int32_t part[INT8_MR][INT8_NR * QUANT_NB];
+        for (int j = 0; j < nr; j++)
+            for (int r = 0; r < mr; r += 2) {
+                if (mr - r >= 2) kernel_avx2<2>(A + (size_t)r * lda, lda, W + j * bs, k4, part);
+                else kernel_avx2<1>(A + (size_t)r * lda, lda, W + j * bs, k4, part);
+                for (int i = r; i < std::min(mr, r + 2); i++)
+                    memcpy(acc[i] + j * QUANT_NB, part[i - r], QUANT_NB * sizeof(int32_t));
+            }
+        return;
+    }
+#endif
+    kernel_scalar(A, lda, mr, W, bs, nr, k4, acc);
+}
+
+// Rows [m0, m1) of C[m*ldm + n*ldn] = dequant(A[m] . W[n]) + bias[n], for the
+// filters n of blocks [b0, b1) of group g (C and bias start at the first
+// filter of the group). The packed weights of a tile of blocks stay in L2
+// while the rows go through them
+static void gemm_u8s8(const uint8_t *A, int m0, int m1, QuantDescriptor *Q, int g, int b0, int b1, const float *bias, float *C, int ldm, int ldn) {
+    int isa = cpu_int8_isa();
+    int ng = Q->channels / Q->groups;
+    int k4 = Q->kpad / 4;
+    size_t bs = (size_t)QUANT_NB * Q->kpad;
+    const int8_t *Wg = Q->pW.data() + (size_t)g * Q->blocks() * bs;
+    int tile = std::max(INT8_NR, (int)(INT8_WC / bs) / INT8_NR * INT8_NR);
+
+    int32_t acc[INT8_MR][INT8_NR * QUANT_NB];
+    for (int t0 = b0; t0 < b1; t0 += tile) {
+        int t1 = std::min(b1, t0 + tile);
+        for (int m = m0; m < m1; m += INT8_MR) {
+            int mr = std::min(INT8_MR, m1 - m);
+            for (int b = t0; b < t1; b += INT8_NR) {
+                int nr = std::min(INT8_NR, t1 - b);
+                micro_kernel(isa, A + (size_t)m * Q->kpad, Q->kpad, mr, Wg + b * bs, bs, nr, k4, acc);
+
+                int n0 = b * QUANT_NB;
+                int nn = std::min(nr * QUANT_NB, ng - n0);
+                for (int r = 0; r < mr; r++)
+                    for (int j = 0; j < nn; j++) {
+                        int n = n0 + j;
+                        int c = g * ng + n;
+                        float v = Q->in_scale * Q->w_scale[c] * (float)(acc[r][j] - Q->in_zero * Q->w_sum[c]);
+                        if (bias != nullptr) v += bias[n];
+                        C[(size_t)(m + r) * ldm + (size_t)n * ldn] = v;
+                    }
+            }
+        }
+    }
+}
+
+// Lowering of the quantized channels img of a group straight into rows of
+// kpad, in the order of im2col. Padding is the zero point (0.0 quantized)
+static void im2row_u8(ConvolDescriptor *D, QuantDescriptor *Q, const uint8_t *img, uint8_t *qA) {
+    uint8_t zero = (uint8_t)Q->in_zero;
+
+    for (int y = 0, m = 0; y < D->r; y++)
+        for (int x = 0; x < D->c; x++, m++) {
+            uint8_t *q = qA + (size_t)m * Q->kpad;
+            int py = y * D->sr - D->padrt;
+            int px = x * D->sc - D->padcl;
+            bool inside = (D->dc == 1) && (px >= 0) && (px + D->kc <= D->ic);
+
+            for (int z = 0; z < D->kz; z++)
+                for (int ky = 0; ky < D->kr; ky++, q += D->kc) {
+                    int iy = py + ky * D->dr;
+                    if ((iy < 0) || (iy >= D->ir)) {
+                        memset(q, zero, D->kc);
+                        continue;
+                    }
+                    const uint8_t *row = img + ((size_t)z * D->ir + iy) * D->ic;
+                    if (inside) {
+                        memcpy(q, row + px, D->kc);
+                        continue;
+                    }
+                    for (int kx = 0; kx < D->kc; kx++) {
+                        int ix = px + kx * D->dc;
+                        q[kx] = ((ix >= 0) && (ix < D->ic)) ? row[ix] : zero;
+                    }
+                }
+            memset(q, 0, Q->kpad - Q->ksize);
+        }
+}
+
+
+void cpu_dense_int8(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *B) {
+    int M = A->shape[0];
+    int K = Q->ksize;
+    int nb = Q->blocks();
+    float inv_scale = 1.0f / Q->in_scale;
+
+    if (Q->qI.size() < (size_t)M * Q->kpad) Q->qI.resize((size_t)M * Q->kpad);
+    uint8_t *qA = Q->qI.data();
+
+    #pragma omp parallel for
+    for (int m = 0; m < M; m++) {
+        uint8_t *q = qA + (size_t)m * Q->kpad;
+        quantize_run(A->ptr + (size_t)m * K, K, inv_scale, Q->in_zero, q);
+        memset(q + K, 0, Q->kpad - K);
+    }
+
+    // Tiles of rows and, with few rows (e.g. batch 1), of filters
+    int nmt = (M + INT8_MC - 1) / INT8_MC;
+    int nbt = (nmt >= 8) ? nb : INT8_NR * 4;  // blocks of a tile
+    int nnt = (nb + nbt - 1) / nbt;
+    const float *pb = (bias != nullptr) ? bias->ptr : nullptr;
+
+    #pragma omp parallel for collapse(2)
+    for (int mt = 0; mt < nmt; mt++)
+        for (int nt = 0; nt < nnt; nt++)
+            gemm_u8s8(qA, mt * INT8_MC, std::min(M, (mt + 1) * INT8_MC), Q, 0, nt * nbt, std::min(nb, (nt + 1) * nbt), pb, B->ptr, Q->channels, 1);
+}
+
+
+// The input is quantized once and lowered in uint8, ptrI is not used
+void cpu_conv2D_int8(ConvolDescriptor *D, QuantDescriptor *Q) {
+    int M = D->r * D->c;
+    int G = Q->groups;
+    int ng = Q->channels / G;
+    int osize = D->z * M;
+    int batch = D->I->shape[0];
+    size_t qsize = (size_t)M * Q->kpad;            // lowering of a group
+    size_t gsize = (size_t)D->kz * D->ir * D->ic;  // channels of a group
+    size_t isize = gsize * G;                      // image of a sample
+    float inv_scale = 1.0f / Q->in_scale;
+    const float *bias = D->use_bias ? D->bias->ptr : nullptr;
+
+    // qI: lowerings [batch][G] and then images [batch]
+    size_t lsize = (size_t)batch * G * qsize;
+    if (Q->qI.size() < lsize + batch * isize) Q->qI.resize(lsize + batch * isize);
+    uint8_t *qX = Q->qI.data() + lsize;
+
+    #pragma omp parallel for
+    for (int b = 0; b < batch; b++)
+        quantize_run(D->I->ptr + (size_t)b * isize, isize, inv_scale, Q->in_zero, qX + (size_t)b * isize);
+
+    #pragma omp parallel for collapse(2)
+    for (int b = 0; b < batch; b++)
+        for (int g = 0; g < G; g++)
+            im2row_u8(D, Q, qX + (size_t)b * isize + (size_t)g * gsize, Q->qI.data() + (size_t)(b * G + g) * qsize);
+
+    // Output is channel-major: O[b][n][m]
+    int nmt = (M + INT8_MC - 1) / INT8_MC;
+    #pragma omp parallel for collapse(3)
+    for (int b = 0; b < batch; b++)
+        for (int g = 0; g < G; g++)
+            for (int mt = 0; mt < nmt; mt++) {
+                const uint8_t *qA = Q->qI.data() + (size_t)(b * G + g) * qsize;
+                float *ptrO = D->O->ptr + (size_t)b * osize + (size_t)g * ng * M;
+                gemm_u8s8(qA, mt * INT8_MC, std::min(M, (mt + 1) * INT8_MC), Q, g, 0, Q->blocks(),
+                          (bias != nullptr) ? bias + g * ng : nullptr, ptrO, 1, M);
+            }
+
+    if (D->act != GEMM_ACT_NONE) {
+        #pragma omp parallel for
+        for (int b = 0; b < batch; b++) cpu_act_epilogue(D->O->ptr + (size_t)b * osize, osize, D->act, D->act_param);
+    }
+}
@@ -25,12 +25,11 @@ LConv::LConv(Layer *parent, const vector<int> &ks, const vector<int> &st,
              const vector<int> &p, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(ks, st, p, mem), name, dev, mem) {}
 
 LConv::LConv(Layer *parent, int filters, const vector<int> &kernel_size, const vector<int> &strides, string padding,
-             int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(filters, kernel_size, strides, padding, use_bias, mem), name, dev, mem) {
-    // TODO: Implement (Fix initialization)
+             int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(filters, kernel_size, strides, padding, use_bias, mem, groups, dilation_rate), name, dev, mem) {
 };
 
 LConv::LConv(Layer *parent, ConvolDescriptor *D, string name, int dev, int mem) : LinLayer(name, dev, mem) {
-    if (parent->output->ndim != 4) msg("LConv only works over 4D tensors", "LConv::LConv");
+    if ((parent->output->ndim != 4) && (parent->output->ndim != 3)) msg("LConv only works over 3D or 4D tensors", "LConv::LConv");
 
     // Check dev with tensor dev
 
@@ -56,6 +55,7 @@ LConv::LConv(Layer *parent, ConvolDescriptor *D, string name, int dev, int mem)
     distributed_training = false;
     cd->acc_gK = nullptr;
     cd->acc_gbias = nullptr;
+    qd = nullptr;
 
     parent->addchild(this);
     addparent(parent);
@@ -84,7 +84,15 @@ void LConv::mem_delta(){
 }
 
 void LConv::forward() {
+    // Int8 path (inference only)
+    if ((qd != nullptr) && (qd->quantized) && (mode == TSMODE)) {
+        Conv2D_int8(this->cd, qd);
+        return;
+    }
+
     Conv2D(this->cd);
+
+    if ((qd != nullptr) && (qd->calibrating)) qd->observe(input, output);
 }
 
 void LConv::backward() {
@@ -97,7 +105,14 @@ void LConv::backward() {
     }
 
     // Regularizer
-    if (trainable) if(reg!= nullptr) {reg->apply(cd->K);}
+    if (trainable) if((reg!= nullptr) && (!hold_reg)) {reg->apply(cd->K);}
+}
+
+// matgK still maps the freed data, it is only used by Conv2D_grad
+void LConv::free_grads() {
+    Layer::free_grads();
+    cd->gK = nullptr;
+    cd->gbias = nullptr;
 }
 
 void LConv::update_weights(Tensor* w, Tensor* bias) {
@@ -125,7 +140,13 @@ void LConv::apply_accumulated_gradients() {
 
 Layer *LConv::share(int c, int bs, vector<Layer *> p) {
     // TODO: share ComvDescriptor
-    LConv *n = new LConv(p[0], cd->ksize, cd->stride, cd->pad,  name, dev,mem_level);
+    LConv *n = new LConv(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, cd->groups, cd->dilation), name, dev, mem_level);
+    share_params(n);
+
+    return n;
+}
+
+void LConv::share_params(LConv *n) {
     n->orig = this;
     n->isshared=true;
     n->trainable = trainable;
@@ -139,7 +160,7 @@ Layer *LConv::share(int c, int bs, vector<Layer *> p) {
 
     n->cd->K = cd->K;
     n->cd->bias = cd->bias;
-    n->cd->matK = cd->matK;
+    // matK is not copied (it maps the deleted kernels), Conv2D maps it onto K
 
     n->params.push_back(n->cd->K);
     n->params.push_back(n->cd->bias);
@@ -167,13 +188,11 @@ Layer *LConv::share(int c, int bs, vector<Layer *> p) {
 
     n->reg=reg;
     n->init=init;
-
-    return n;
 }
 
 Layer *LConv::clone(int c, int bs, vector<Layer *> p, int todev) {
 
-    LConv *n = new LConv(p[0], cd->ksize, cd->stride, cd->pad,  name, todev, this->mem_level);
+    LConv *n = new LConv(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, cd->groups, cd->dilation), name, todev, this->mem_level);
     n->trainable = trainable;
     
     n->orig = this;
@@ -207,3 +226,34 @@ void LConv::enable_distributed() {
     acc_gradients.push_back(cd->acc_gK);
     acc_gradients.push_back(cd->acc_gbias);
 }
+
+void LConv::enable_calibration() {
+    // Depthwise convolutions have no lowering (and a single k per filter and
+    // row), the direct float kernel is faster than an int8 GEMM
+    if (cd->is_depthwise()) {
+        cout << "Warning: " << name << " is depthwise, it is kept in float32\n";
+        return;
+    }
+
+    if (cd->K->ptr == nullptr) msg("The float32 weights were released by quantize", "LConv::enable_calibration");
+
+    // Grouped convolutions: kz input channels per group, one GEMM per group
+    if (qd == nullptr) qd = new QuantDescriptor(cd->nk, cd->kz * cd->kr * cd->kc, cd->groups);
+
+    qd->reset_ranges();
+    qd->quantized = false;
+    qd->calibrating = true;
+}
+
+void LConv::quantize(bool per_channel) {
+    if (qd == nullptr) return;
+
+    // K is (nk x kz x kr x kc), one contiguous row per filter
+    qd->quantize(cd->K->ptr, 1, qd->ksize, per_channel);
+}
+
+// The bias is kept, the int8 path adds it. matK still maps the freed data,
+// Conv2D is not called any more
+void LConv::free_float_weights() {
+    if ((qd != nullptr) && (qd->quantized)) cd->K->deleteData();
+}
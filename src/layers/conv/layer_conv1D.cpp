@@ -0,0 +1,59 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/layers/conv/layer_conv.h"
+
+using namespace std;
+
+
+int LConv1D::total_layers = 0;
+
+// constructors and clones
+
+LConv1D::LConv1D(Layer *parent, int filters, const vector<int> &kernel_size, const vector<int> &strides, string padding,
+                 int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem) :
+        LConv1D(parent, new ConvolDescriptor(filters, {1, kernel_size[0]}, {1, strides[0]}, padding, use_bias, mem, groups, {1, dilation_rate[0]}), name, dev, mem) {};
+
+LConv1D::LConv1D(Layer *parent, ConvolDescriptor *D, string name, int dev, int mem) : LConv(parent, D, name, dev, mem) {
+    if (input->ndim != 3) msg("LConv1D only works over 3D tensors", "LConv1D::LConv1D");
+
+    // Set default name
+    if(name.empty()) this->name = "conv1D" + to_string(++total_layers);
+}
+
+Layer *LConv1D::share(int c, int bs, vector<Layer *> p) {
+    LConv1D *n = new LConv1D(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, cd->groups, cd->dilation), name, dev, mem_level);
+    share_params(n);
+
+    return n;
+}
+
+Layer *LConv1D::clone(int c, int bs, vector<Layer *> p, int todev) {
+
+    LConv1D *n = new LConv1D(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, cd->groups, cd->dilation), name, todev, this->mem_level);
+    n->trainable = trainable;
+
+    n->orig = this;
+    n->cd->use_bias=cd->use_bias;
+
+    n->reg=reg;
+    n->init=init;
+
+
+    return n;
+}
+
+void LConv1D::reset_name_counter() {
+    total_layers = 0;
+}
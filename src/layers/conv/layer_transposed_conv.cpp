@@ -22,11 +22,154 @@ int LConvT::total_layers = 0;
 // ---- TRANSPOSED CONVOLUTION ----
 LConvT::LConvT(Layer *parent, int filters, const vector<int> &kernel_size,
     const vector<int> &output_padding, string padding, const vector<int> &dilation_rate,
-    const vector<int> &strides, bool use_bias, string name, int dev, int mem) : LConvT(parent, new ConvolDescriptor(filters, kernel_size, strides, padding,mem), name, dev, mem) {
-    // TODO: Implement (Fix initialization)
+    const vector<int> &strides, bool use_bias, string name, int dev, int mem) : LinLayer(name, dev, mem) {
+    if (parent->output->ndim != 4) msg("LConvT only works over 4D tensors", "LConvT::LConvT");
+    if ((kernel_size.size() != 2) || (strides.size() != 2) || (dilation_rate.size() != 2) || (output_padding.size() != 2))
+        msg("Kernel size, strides, dilation and output padding must have 2 dimensions", "LConvT::LConvT");
+
+    // Padding of the convolution from the output (size in*stride for "same") back to the input
+    vector<int> pad;
+    this->output_padding = output_padding;
+    for (int i = 0; i < 2; i++) {
+        if ((output_padding[i] < 0) || (output_padding[i] >= strides[i]))
+            msg("Output padding must be lower than the stride", "LConvT::LConvT");
+
+        int ek = (kernel_size[i] - 1) * dilation_rate[i] + 1;
+        if (padding == "same" || padding == "zeros") {
+            int p = std::max(ek - strides[i], 0);
+            pad.push_back(p / 2);
+            pad.push_back(p - p / 2);
+            this->output_padding[i] += std::max(strides[i] - ek, 0);
+        }
+        else if (padding == "valid" || padding == "none") {
+            pad.push_back(0);
+            pad.push_back(0);
+        }
+        else msg("Incorrect padding type", "LConvT::LConvT");
+    }
+
+    auto *D = new ConvolDescriptor({parent->output->shape[1], kernel_size[0], kernel_size[1]}, strides, pad, mem, 1, dilation_rate);
+    D->use_bias = use_bias;
+    setup(parent, filters, D);
 };
 
-LConvT::LConvT(Layer *parent, ConvolDescriptor *cd, string name, int dev, int mem) : LinLayer(name, dev, mem) {
-    // TODO: Implement (Fix initialization)
+LConvT::LConvT(Layer *parent, int filters, ConvolDescriptor *D, const vector<int> &output_padding, string name, int dev, int mem) : LinLayer(name, dev, mem) {
+    if (parent->output->ndim != 4) msg("LConvT only works over 4D tensors", "LConvT::LConvT");
+    if (D->padding != "custom") msg("The convolution must have a known padding", "LConvT::LConvT");
+
+    this->output_padding = output_padding;
+    setup(parent, filters, D);
+}
+
+void LConvT::setup(Layer *parent, int filters, ConvolDescriptor *D) {
+    // Set default name
     if(name.empty()) this->name = "convt" + to_string(++total_layers);
+
+    input = parent->output;
+    cd = D;
+
+    // The smallest output that the convolution maps back to the input, plus the output padding
+    int rows = (input->shape[2] - 1) * cd->stride[0] + (cd->ksize[1] - 1) * cd->dilation[0] + 1 - cd->pad[0] - cd->pad[1] + output_padding[0];
+    int cols = (input->shape[3] - 1) * cd->stride[1] + (cd->ksize[2] - 1) * cd->dilation[1] + 1 - cd->pad[2] - cd->pad[3] + output_padding[1];
+    output = new Tensor(vector<int>{input->shape[0], filters, rows, cols}, dev);
+
+    cd->build(output);
+    if ((cd->nk != input->shape[1]) || (cd->r != input->shape[2]) || (cd->c != input->shape[3]) || (cd->groups != 1))
+        msg("Incompatible transposed convolution", "LConvT::LConvT");
+
+    // The bias is added to the output channels
+    delete cd->bias;
+    delete cd->gbias;
+    cd->bias = new Tensor(vector<int>{filters}, output->device);
+    cd->gbias = new Tensor(vector<int>{filters}, output->device);
+
+    params.push_back(cd->K);
+    params.push_back(cd->bias);
+
+    gradients.push_back(cd->gK);
+    gradients.push_back(cd->gbias);
+
+    parent->addchild(this);
+    addparent(parent);
+}
+
+
+// virtual
+void LConvT::resize(int batch){
+    output->resize(batch);
+    cd->resize(batch);
+}
+
+void LConvT::forward() {
+    ConvT2D(cd, input, output);
+}
+
+void LConvT::backward() {
+    // backprop delta, also lowers the delta for the gradients
+    ConvT2D_back(cd, delta, parent[0]->delta);
+
+    //get gradients with provided delta
+    if (trainable) { ConvT2D_grad(cd, input, delta); }
+
+    // Regularizer
+    if (trainable) if((reg!= nullptr) && (!hold_reg)) {reg->apply(cd->K);}
+}
+
+void LConvT::free_grads() {
+    Layer::free_grads();
+    cd->gK = nullptr;
+    cd->gbias = nullptr;
+}
+
+Layer *LConvT::share(int c, int bs, vector<Layer *> p) {
+    LConvT *n = new LConvT(p[0], output->shape[1], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, 1, cd->dilation), output_padding, name, dev, mem_level);
+    n->orig = this;
+    n->isshared=true;
+    n->trainable = trainable;
+
+    n->cd->use_bias=cd->use_bias;
+
+    //share params and gradients
+    for (int i = 0; i < n->params.size(); i++) delete n->params[i];
+    for (int i = 0; i < n->gradients.size(); i++) delete n->gradients[i];
+
+    n->cd->K = cd->K;
+    n->cd->bias = cd->bias;
+    n->cd->gK = cd->gK;
+    n->cd->gbias = cd->gbias;
+
+    n->params = {n->cd->K, n->cd->bias};
+    n->gradients = {n->cd->gK, n->cd->gbias};
+
+    n->reg=reg;
+    n->init=init;
+
+    return n;
+}
+
+Layer *LConvT::clone(int c, int bs, vector<Layer *> p, int todev) {
+    LConvT *n = new LConvT(p[0], output->shape[1], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, 1, cd->dilation), output_padding, name, todev, this->mem_level);
+    n->trainable = trainable;
+
+    n->orig = this;
+    n->cd->use_bias=cd->use_bias;
+
+    n->reg=reg;
+    n->init=init;
+
+    return n;
+}
+
+
+string LConvT::plot(int c) {
+    string s;
+
+    if (c) s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=gray,shape=box]";
+    else s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=White,shape=box]";
+
+    return s;
+}
+
+void LConvT::reset_name_counter() {
+    total_layers = 0;
 }
@@ -28,13 +28,25 @@ LActivation::LActivation(Layer *parent, string act, vector<float> params, string
     input = parent->output;
     output = new Tensor(input->shape, dev);
     delta_bp = 0;
+    fused = false;
 
     parent->addchild(this);
     addparent(parent);
 }
 
+LActivation::~LActivation(){
+    // The output tensor belongs to the parent once fused
+    if (fused) output = nullptr;
+}
+
+void LActivation::resize(int batch){
+    if (!fused) Layer::resize(batch);
+}
+
 
 void LActivation::forward(){
+    // Already applied by the parent (see Net::fuse_activations)
+    if (fused) return;
 
     if (act == "relu"){
         ReLu(this->input, this->output);
@@ -0,0 +1,221 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/layers/core/layer_core.h"
+
+using namespace std;
+
+int LMultiHeadAttention::total_layers = 0;
+
+// 2D view (rows x last dim) over the data of T, refreshed if T was resized or reallocated
+static Tensor *view2D(Tensor *&v, Tensor *T) {
+    int cols = T->shape[T->ndim - 1];
+    int rows = T->size / cols;
+
+    if (v == nullptr) v = new Tensor(vector<int>{rows, cols}, T);
+    else if (v->shape[0] != rows) v->resize(rows, T);
+    else if (v->ptr != T->ptr) {
+        v->ptr = T->ptr;
+        if (v->isCPU()) new(v->ptr2) Eigen::Map<Eigen::MatrixXf>(T->ptr, cols, rows);
+    }
+    return v;
+}
+
+static void free_view(Tensor *v) {
+    if (v == nullptr) return;
+    v->ptr = nullptr;  // the data belongs to the viewed tensor
+    delete v;
+}
+
+// Named pointers to params = {Wq, Wk, Wv, Wo [, bq, bk, bv, bo]} and the same for gradients
+static void bind_params(LMultiHeadAttention *l) {
+    l->Wq = l->params[0]; l->Wk = l->params[1]; l->Wv = l->params[2]; l->Wo = l->params[3];
+    l->gWq = l->gradients[0]; l->gWk = l->gradients[1]; l->gWv = l->gradients[2]; l->gWo = l->gradients[3];
+
+    l->bq = l->bk = l->bv = l->bo = nullptr;
+    l->gbq = l->gbk = l->gbv = l->gbo = nullptr;
+    if (l->use_bias) {
+        l->bq = l->params[4]; l->bk = l->params[5]; l->bv = l->params[6]; l->bo = l->params[7];
+        l->gbq = l->gradients[4]; l->gbk = l->gradients[5]; l->gbv = l->gradients[6]; l->gbo = l->gradients[7];
+    }
+}
+
+LMultiHeadAttention::LMultiHeadAttention(vector<Layer *> parent, int num_heads, int head_dim, bool causal, bool use_bias,
+                                         string name, int dev, int mem) : MLayer(name, dev, mem) {
+    if ((parent.size() != 1) && (parent.size() != 2)) msg("LMultiHeadAttention needs one (self-attention) or two layers", "LMultiHeadAttention::LMultiHeadAttention");
+
+    Tensor *q = parent[0]->output;
+    Tensor *kv = parent.back()->output;
+    if ((q->ndim != 3) || (kv->ndim != 3)) msg("LMultiHeadAttention only works over 3D tensors (batch x length x features)", "LMultiHeadAttention::LMultiHeadAttention");
+    if (q->shape[0] != kv->shape[0]) msg("Incompatible batch sizes", "LMultiHeadAttention::LMultiHeadAttention");
+
+    if(name.empty()) this->name = "mha" + to_string(++total_layers);
+    this->num_heads = num_heads;
+    this->head_dim = head_dim;
+    this->use_bias = use_bias;
+
+    int dq = q->shape[2];
+    int dkv = kv->shape[2];
+    int hd = num_heads * head_dim;
+
+    input = q;
+    output = new Tensor(q->shape, dev);
+
+    ad = new AttentionDescriptor(num_heads, head_dim, causal, mem);
+    ad->build(q->shape[0], q->shape[1], kv->shape[1], dev);
+
+    params.push_back(new Tensor(vector<int>{dq, hd}, dev));
+    params.push_back(new Tensor(vector<int>{dkv, hd}, dev));
+    params.push_back(new Tensor(vector<int>{dkv, hd}, dev));
+    params.push_back(new Tensor(vector<int>{hd, dq}, dev));
+    for (int i = 0; i < 4; i++) gradients.push_back(new Tensor(params[i]->shape, dev));
+    if (use_bias) {
+        params.push_back(new Tensor(vector<int>{hd}, dev));
+        params.push_back(new Tensor(vector<int>{hd}, dev));
+        params.push_back(new Tensor(vector<int>{hd}, dev));
+        params.push_back(new Tensor(vector<int>{dq}, dev));
+        for (int i = 4; i < 8; i++) gradients.push_back(new Tensor(params[i]->shape, dev));
+    }
+    bind_params(this);
+
+    xq = xkv = out2 = dout2 = dxq = dxkv = nullptr;
+
+    for (int i = 0; i < (int)parent.size(); ++i) {
+        parent[i]->addchild(this);
+        addparent(parent[i]);
+    }
+}
+
+LMultiHeadAttention::~LMultiHeadAttention() {
+    delete ad;
+
+    free_view(xq);
+    free_view(xkv);
+    free_view(out2);
+    free_view(dout2);
+    free_view(dxq);
+    free_view(dxkv);
+}
+
+void LMultiHeadAttention::resize(int batch){
+    Layer::resize(batch);
+    ad->resize(batch);
+}
+
+void LMultiHeadAttention::forward() {
+    Tensor *x = view2D(xq, parent[0]->output);
+    Tensor *m = view2D(xkv, parent.back()->output);
+
+    Tensor::gemm(1.0f, x, 0, Wq, 0, 0.0f, ad->Q, bq);
+    Tensor::gemm(1.0f, m, 0, Wk, 0, 0.0f, ad->K, bk);
+    Tensor::gemm(1.0f, m, 0, Wv, 0, 0.0f, ad->V, bv);
+
+    Attention(ad);
+
+    Tensor::gemm(1.0f, ad->O, 0, Wo, 0, 0.0f, view2D(out2, output), bo);
+}
+
+void LMultiHeadAttention::backward() {
+    Tensor *d = view2D(dout2, delta);
+
+    // Output projection
+    if (trainable) {
+        Tensor::mult2D(ad->O, 1, d, 0, gWo, 1);
+        if (use_bias) Tensor::reduce_sum2D(d, gbo, 0, 1);
+    }
+    Tensor::mult2D(d, 0, Wo, 1, ad->dO, 0);
+
+    D_Attention(ad);
+
+    // Input projections, note that increment parent deltas
+    Tensor *x = view2D(xq, parent[0]->output);
+    Tensor *m = view2D(xkv, parent.back()->output);
+    if (trainable) {
+        Tensor::mult2D(x, 1, ad->dQ, 0, gWq, 1);
+        Tensor::mult2D(m, 1, ad->dK, 0, gWk, 1);
+        Tensor::mult2D(m, 1, ad->dV, 0, gWv, 1);
+        if (use_bias) {
+            Tensor::reduce_sum2D(ad->dQ, gbq, 0, 1);
+            Tensor::reduce_sum2D(ad->dK, gbk, 0, 1);
+            Tensor::reduce_sum2D(ad->dV, gbv, 0, 1);
+        }
+    }
+
+    Tensor *dx = view2D(dxq, parent[0]->delta);
+    Tensor *dm = view2D(dxkv, parent.back()->delta);
+    Tensor::mult2D(ad->dQ, 0, Wq, 1, dx, 1);
+    Tensor::mult2D(ad->dK, 0, Wk, 1, dm, 1);
+    Tensor::mult2D(ad->dV, 0, Wv, 1, dm, 1);
+
+    // Regularizer
+    if (trainable) if ((reg != nullptr) && (!hold_reg)) {
+        reg->apply(Wq);
+        reg->apply(Wk);
+        reg->apply(Wv);
+        reg->apply(Wo);
+    }
+}
+
+void LMultiHeadAttention::free_grads() {
+    Layer::free_grads();
+    bind_params(this);  // gradients are nullptr now
+}
+
+Layer *LMultiHeadAttention::share(int c, int bs, vector<Layer *> p) {
+    LMultiHeadAttention *n = new LMultiHeadAttention(p, num_heads, head_dim, ad->causal, use_bias, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
+    n->orig = this;
+    n->isshared = true;
+    n->trainable = trainable;
+
+    //share params and gradients
+    for (int i = 0; i < (int)n->params.size(); i++) delete n->params[i];
+    for (int i = 0; i < (int)n->gradients.size(); i++) delete n->gradients[i];
+    n->params = params;
+    n->gradients = gradients;
+    bind_params(n);
+
+    n->reg = reg;
+    n->init = init;
+
+    return n;
+}
+
+Layer *LMultiHeadAttention::clone(int c, int bs, vector<Layer *> p, int todev) {
+    LMultiHeadAttention *n = new LMultiHeadAttention(p, num_heads, head_dim, ad->causal, use_bias, "clone_" + name, todev, this->mem_level);
+    n->orig = this;
+    n->trainable = trainable;
+    n->reg = reg;
+    n->init = init;
+
+    return n;
+}
+
+
+// The projections are not quantized, the attention kernels are float32 only
+void LMultiHeadAttention::enable_calibration() {
+    cout << "Warning: " << name << " is kept in float32\n";
+}
+
+string LMultiHeadAttention::plot(int c) {
+    string s;
+
+    if (c) s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=bisque4,shape=box]";
+    else s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=White,shape=box]";
+
+    return s;
+}
+
+void LMultiHeadAttention::reset_name_counter(){
+    total_layers=0;
+}
@@ -42,6 +42,10 @@ LDense::LDense(Layer *parent, int ndim, bool use_bias, string name, int dev, int
     distributed_training = false;
     acc_gW = nullptr;
     acc_gbias = nullptr;
+    qd = nullptr;
+    act = GEMM_ACT_NONE;
+    act_param = 0.0f;
+    alpha = 1.0f;
 
     parent->addchild(this);
     addparent(parent);
@@ -49,8 +53,17 @@ LDense::LDense(Layer *parent, int ndim, bool use_bias, string name, int dev, int
 
 
 void LDense::forward() {
-    Tensor::mult2D(input, 0, W, 0, output, 0);
-    if (use_bias) Tensor::sum2D_rowwise(output, bias, output);
+    // Int8 path (inference only)
+    if ((qd != nullptr) && (qd->quantized) && (mode == TSMODE)) {
+        Dense_int8(input, qd, use_bias ? bias : nullptr, output);
+        FusedActivation(output, act, act_param);
+        return;
+    }
+
+    // Bias and fused activation are applied by the GEMM epilogue
+    Tensor::gemm(alpha, input, 0, W, 0, 0.0f, output, use_bias ? bias : nullptr, act, act_param);
+
+    if ((qd != nullptr) && (qd->calibrating)) qd->observe(input, output);
 }
 
 void LDense::backward() {
@@ -64,7 +77,13 @@ void LDense::backward() {
     Tensor::mult2D(delta, 0, W, 1, parent[0]->delta, 1);
 
     // Regularizer
-    if (trainable) if(reg != nullptr) {reg->apply(this->W);}
+    if (trainable) if((reg != nullptr) && (!hold_reg)) {reg->apply(this->W);}
+}
+
+void LDense::free_grads() {
+    Layer::free_grads();
+    gW = nullptr;
+    gbias = nullptr;
 }
 
 void LDense::update_weights(Tensor* w, Tensor* bias) {
@@ -171,3 +190,24 @@ void LDense::enable_distributed(){
         }
     }
 }
+
+void LDense::enable_calibration(){
+    if (W->ptr == nullptr) msg("The float32 weights were released by quantize", "LDense::enable_calibration");
+    if (qd == nullptr) qd = new QuantDescriptor(ndim, input->shape[1]);
+
+    qd->reset_ranges();
+    qd->quantized = false;
+    qd->calibrating = true;
+}
+
+void LDense::quantize(bool per_channel){
+    if (qd == nullptr) return;
+
+    // W is (in x ndim)
+    qd->quantize(W->ptr, ndim, 1, per_channel);
+}
+
+// The bias is kept, the int8 path adds it
+void LDense::free_float_weights(){
+    if ((qd != nullptr) && (qd->quantized)) W->deleteData();
+}
@@ -61,6 +61,12 @@ LEmbedding::LEmbedding(Layer *parent, int vocsize, int length, int dim, bool mas
 
     gE=new Tensor({vocsize,dim},dev);
     gradients.push_back(gE);
+    master=this;
+
+    if (gE->isCPU()) {
+      gE->fill_(0.0);
+      touched.assign(vocsize,0);
+    }
 
 
     parent->addchild(this);
@@ -80,17 +86,35 @@ void LEmbedding::forward()
 
   sind.clear();
 
-  Tensor *inputc=input->clone();
-  inputc->toCPU();
+  Tensor *inputc=input;
+  if (!input->isCPU()) {
+    inputc=input->clone();
+    inputc->toCPU();
+  }
 
   for(int i=0;i<b*length;i++) {
-    int val=inputc->get_({i});
-    //int val=0;
+    int val=inputc->ptr[i];
     if (val>=vocsize) {cout<<"word:"<<val<<endl;msg("word > vocsize","LEmbedding::forward");}
     sind.push_back(val);
   }
 
-  delete inputc;
+  if (inputc!=input) delete inputc;
+
+  if ((gE!=nullptr)&&(gE->isCPU())) {
+    // group repeated words so backward sums them once per row
+    uorder.resize(sind.size());
+    for(int i=0;i<(int)uorder.size();i++) uorder[i]=i;
+    std::sort(uorder.begin(),uorder.end(),[this](int x,int y) { return sind[x]<sind[y] || (sind[x]==sind[y] && x<y); });
+
+    uids.clear();
+    ustart.clear();
+    for(int i=0;i<(int)uorder.size();i++)
+      if ((i==0)||(sind[uorder[i]]!=uids.back())) {
+        uids.push_back(sind[uorder[i]]);
+        ustart.push_back(i);
+      }
+    ustart.push_back(uorder.size());
+  }
 
   output->reshape_({b*length,dim});
 
@@ -110,15 +134,55 @@ void LEmbedding::backward()
      int b=output->shape[0];
      delta->reshape_({b*length,dim});
 
-     Tensor::deselect(delta,gE, sind, 0,sind.size(),1, mask_zeros); //1=inc
+     if (gE->isCPU()) {
+       // only the rows of the words in the batch are touched
+       inc_rows(delta,gE,uids,ustart,uorder,mask_zeros);
+       add_sparse_rows(0,uids);
+     }
+     else Tensor::deselect(delta,gE, sind, 0,sind.size(),1, mask_zeros); //1=inc
 
      delta->reshape_({b,length*dim});
 
-     if(reg!= nullptr) {reg->apply(E);}
+     if((reg!= nullptr) && (!hold_reg)) {reg->apply(E);}
    }
 }
 
+void LEmbedding::free_grads()
+{
+  Layer::free_grads();
+  gE=nullptr;
+}
+
+
+void LEmbedding::zeroGrads()
+{
+  if (!gE->isCPU()) {
+    Layer::zeroGrads();
+    return;
+  }
+
+  vector<int> &rows=master->grows;
+  zero_rows(gE,rows);
+  for(int k=0;k<(int)rows.size();k++) master->touched[rows[k]]=0;
+  rows.clear();
+}
+
+vector<int> *LEmbedding::sparse_rows(int j)
+{
+  if ((j==0)&&(gE!=nullptr)&&(gE->isCPU())) return &master->grows;
+  return nullptr;
+}
+
+void LEmbedding::add_sparse_rows(int j, const vector<int> &rows)
+{
+  if (sparse_rows(j)==nullptr) return;
 
+  for(int k=0;k<(int)rows.size();k++)
+    if (!master->touched[rows[k]]) {
+      master->touched[rows[k]]=1;
+      master->grows.push_back(rows[k]);
+    }
+}
 
 
 Layer *LEmbedding::share(int c, int bs, vector<Layer *> p) {
@@ -136,6 +200,8 @@ Layer *LEmbedding::share(int c, int bs, vector<Layer *> p) {
 
     n->E = E;
     n->gE = gE;
+    n->master = master;
+    vector<unsigned char>().swap(n->touched);
 
     n->params.push_back(E);
     n->gradients.push_back(gE);
@@ -34,12 +34,14 @@ Layer::Layer(string name, int dev, int mem) {
     isrecurrent=false;
     isshared=false;
     isnorm=false;
+    own_output=nullptr;
     trainable=true;
 
     orig=nullptr;
     net=nullptr;
 
     reg = nullptr;
+    hold_reg=false;
     init=new IGlorotNormal(1234);
 }
 
@@ -59,6 +61,9 @@ Layer::~Layer(){
       for (int i=0;i<gradients.size();i++){
         delete gradients[i];
     }
+
+    for (int i=0;i<comp_residuals.size();i++) delete comp_residuals[i];
+    for (int i=0;i<sync_params.size();i++) delete sync_params[i];
 }
 
 void Layer::initialize() {
@@ -161,6 +166,26 @@ void Layer::zeroGrads() {
     }
 }
 
+void Layer::free_grads() {
+    for (int i=0;i<(int)gradients.size();i++) {
+        if (!isshared) delete gradients[i];
+        gradients[i] = nullptr;
+    }
+}
+
+// The output tensor is kept (children point to it), only its data changes
+void Layer::alias_input(bool on) {
+    if (on) {
+        own_output = new Tensor(output->shape, output->ptr, output->device);
+        output->reallocate(input);
+    } else {
+        output->reallocate(own_output);
+        own_output->ptr = nullptr;
+        delete own_output;
+        own_output = nullptr;
+    }
+}
+
 void Layer::setmode(int m) {
     mode = m;
 }
@@ -20,22 +20,27 @@ using namespace std;
 int LMatMul::total_layers = 0;
 
 LMatMul::LMatMul(vector<Layer *> parent, string name, int dev, int mem) : MLayer(name, dev, mem) {
-    if (parent.size() == 0) msg("Error: LMatMul layer with empty list");
-
-    if (parent.size() > 1)
-        for (int i = 0; i < parent.size() - 1; ++i)
-            if (!Tensor::eqsize(parent[i]->output, parent[i + 1]->output)) {
-                parent[i]->output->info();
-                parent[i + 1]->output->info();
-                msg("Error: LMatMul layers with different tensor shape");
-            }
+    if (parent.size() != 2) msg("Error: LMatMul layer needs exactly two layers", "LMatMul::LMatMul");
+
+    // A is (batch x ... x m x k) and B is (batch x ... x k x n)
+    Tensor *A = parent[0]->output;
+    Tensor *B = parent[1]->output;
+    int nd = A->ndim;
+    bool ok = (nd >= 3) && (B->ndim == nd) && (A->shape[nd - 1] == B->shape[nd - 2]);
+    for (int i = 0; (ok) && (i < nd - 2); i++) ok = (A->shape[i] == B->shape[i]);
+    if (!ok) {
+        A->info();
+        B->info();
+        msg("Error: LMatMul layers with incompatible tensor shapes", "LMatMul::LMatMul");
+    }
 
     if(name.empty()) this->name = "matmul" + to_string(++total_layers);
 
-    input = parent[0]->output;
+    input = A;
 
-    output = new Tensor(parent[0]->output->shape, dev);
-//    if (!mem_level) { delta = new Tensor(parent[0]->output->shape, dev);  }
+    vector<int> shape(A->shape);
+    shape[nd - 1] = B->shape[nd - 1];
+    output = new Tensor(shape, dev);
 
     for (int i = 0; i < parent.size(); ++i) {
         parent[i]->addchild(this);
@@ -47,6 +52,12 @@ LMatMul::LMatMul(vector<Layer *> parent, string name, int dev, int mem) : MLayer
 
 // virtual
 
+// Both operands are activations (QLinearMatMul would need the ranges of both
+// and a quantization of B on every forward), there are no int8 kernels for it
+void LMatMul::enable_calibration() {
+    cout << "Warning: " << name << " multiplies two activations, it is kept in float32\n";
+}
+
 string LMatMul::plot(int c) {
     string s;
 
@@ -57,18 +68,13 @@ string LMatMul::plot(int c) {
 
 
 void LMatMul::forward() {
-    // TODO: Implement
-    output->fill_(0.0);
-    for (int i = 0; i < parent.size(); ++i)
-        Tensor::inc(parent[i]->output, output);
-
+    Tensor::batched_mult2D(parent[0]->output, 0, parent[1]->output, 0, output, 0);
 }
 
 void LMatMul::backward() {
-    // TODO: Implement
-    for (int i = 0; i < parent.size(); ++i){
-        Tensor::inc(delta, parent[i]->delta);
-    }
+    // dA += dC * B^T, dB += A^T * dC
+    Tensor::batched_mult2D(delta, 0, parent[1]->output, 1, parent[0]->delta, 1);
+    Tensor::batched_mult2D(parent[0]->output, 1, delta, 0, parent[1]->delta, 1);
 }
 
 Layer *LMatMul::share(int c, int bs, vector<Layer *> p) {
@@ -213,6 +213,13 @@ void LBatchNorm::backward(){
 
 }
 
+void LBatchNorm::free_grads()
+{
+  Layer::free_grads();
+  gbn_g=nullptr;
+  gbn_b=nullptr;
+}
+
 
 
 Layer *LBatchNorm::share(int c, int bs, vector<Layer *> p) {
@@ -71,6 +71,12 @@ LGroupNorm::LGroupNorm(Layer *parent, int g, float epsilon, bool affine, string
     addparent(parent);
 }
 
+LGroupNorm::~LGroupNorm(){
+    delete opa;
+    delete bn_mean;
+    delete bn_var;
+}
+
 // virtual
 void LGroupNorm::resize(int batch){
   if (batch!=output->shape[0]) {
@@ -104,6 +110,12 @@ void LGroupNorm::forward()
   // Input = Output = {Batch,Channels,H,W} OR {Batch,Dim}
   // bn_mean = bn_var = mean = variance = bn_g = bn_b = {Batch}
 
+  if (input->isCPU()) {
+    // groups are contiguous, so each (sample, group) is a row
+    LayerNorm(input,output,opa,bn_mean,bn_var,affine?bn_g:nullptr,affine?bn_b:nullptr,input->shape[0]*groups,epsilon);
+    return;
+  }
+
   int M,N;
   int b,z,r,c,d;
 
@@ -178,6 +190,11 @@ void LGroupNorm::backward()
 
   Tensor *dp;
 
+  if (input->isCPU()) {
+    D_LayerNorm(delta,opa,bn_var,affine?bn_g:nullptr,affine?gbn_g:nullptr,affine?gbn_b:nullptr,parent[0]->delta,delta->shape[0]*groups);
+    return;
+  }
+
   b=delta->shape[0];
   z=delta->shape[1];
   r=delta->shape[2];
@@ -258,13 +275,38 @@ void LGroupNorm::backward()
   delete dp;
 }
 
+void LGroupNorm::free_grads()
+{
+  Layer::free_grads();
+  gbn_g=nullptr;
+  gbn_b=nullptr;
+}
+
 
 
 Layer *LGroupNorm::share(int c, int bs, vector<Layer *> p) {
     LGroupNorm *n = new LGroupNorm(p[0], groups, epsilon, affine,"share_"+to_string(c)+this->name, this->dev, this->mem_level);
     n->orig = this;
+    n->isshared=true;
+    n->trainable = trainable;
 
-    // TODO: Implement
+    //share params and gradients
+    for (int i = 0; i < n->params.size(); i++) delete n->params[i];
+    n->params.clear();
+    for (int i = 0; i < n->gradients.size(); i++) delete n->gradients[i];
+    n->gradients.clear();
+
+    if (affine) {
+      n->bn_g=bn_g;
+      n->bn_b=bn_b;
+      n->params.push_back(bn_g);
+      n->params.push_back(bn_b);
+
+      n->gbn_g=gbn_g;
+      n->gbn_b=gbn_b;
+      n->gradients.push_back(gbn_g);
+      n->gradients.push_back(gbn_b);
+    }
 
     return n;
 }
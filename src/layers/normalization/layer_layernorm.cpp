@@ -72,6 +72,15 @@ LLayerNorm::LLayerNorm(Layer *parent,  float epsilon, bool affine,  string name,
     addparent(parent);
 }
 
+LLayerNorm::~LLayerNorm(){
+    delete opa;
+    // mean and variance are batch statistics, never shared
+    if (isshared) {
+      delete mean;
+      delete variance;
+    }
+}
+
 void LLayerNorm::resize(int batch){
     if (batch!=output->shape[0]) {
         opa->reshape_(output->getShape());
@@ -105,6 +114,12 @@ void LLayerNorm::forward() {
   // Input = Output = {Batch,Channels,H,W} OR {Batch,Dim}
   // mean = variance = mean = variance = bn_g = bn_b = {Batch}
 
+  if (input->isCPU()) {
+    // single pass over the native layout, affine fused
+    LayerNorm(input,output,opa,mean,variance,affine?bn_g:nullptr,affine?bn_b:nullptr,input->shape[0],epsilon);
+    return;
+  }
+
   int M,N;
   int b,z,r,c,d;
 
@@ -171,6 +186,11 @@ void LLayerNorm::backward()
 
   Tensor *dp;
 
+  if (input->isCPU()) {
+    D_LayerNorm(delta,opa,variance,affine?bn_g:nullptr,affine?gbn_g:nullptr,affine?gbn_b:nullptr,parent[0]->delta,input->shape[0]);
+    return;
+  }
+
   if (input->ndim==2) {
     M=b=delta->shape[0];
     N=d=delta->shape[1];
@@ -237,14 +257,26 @@ void LLayerNorm::backward()
 
 }
 
+void LLayerNorm::free_grads()
+{
+  Layer::free_grads();
+  gbn_g=nullptr;
+  gbn_b=nullptr;
+}
+
 
 
 Layer *LLayerNorm::share(int c, int bs, vector<Layer *> p) {
     LLayerNorm *n= new LLayerNorm(p[0], epsilon, affine, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
     n->orig = this;
+    n->isshared=true;
+    n->trainable = trainable;
 
     //share params and gradients
-    for (int i = 0; i < n->params.size(); i++) delete n->params[i];
+    if (affine) {
+      delete n->bn_g;
+      delete n->bn_b;
+    }
     n->params.clear();
 
     for (int i = 0; i < n->gradients.size(); i++) delete n->gradients[i];
@@ -261,10 +293,8 @@ Layer *LLayerNorm::share(int c, int bs, vector<Layer *> p) {
       n->gradients.push_back(gbn_g);
       n->gradients.push_back(gbn_b);
     }
-    n->mean=mean;
-    n->variance=variance;
-    n->params.push_back(mean);
-    n->params.push_back(variance);
+    n->params.push_back(n->mean);
+    n->params.push_back(n->variance);
 
     return n;
 }
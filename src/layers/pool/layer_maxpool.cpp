@@ -29,15 +29,19 @@ LMaxPool::LMaxPool(Layer *parent, const vector<int> &pool_size, const vector<int
 LMaxPool::LMaxPool(Layer *parent, PoolDescriptor *D, const string& name, int dev, int mem) : LPool(parent, D, name, dev, mem) {
     if(name.empty()) this->name = "maxpool" + to_string(++total_layers);
 
-    // Params
-    D->indX = new Tensor(D->O->shape, dev);
-    D->indY = new Tensor(D->O->shape, dev);
+    // Params (the CPU indices are kept by the descriptor)
+    if (!D->O->isCPU()) {
+        D->indX = new Tensor(D->O->shape, dev);
+        D->indY = new Tensor(D->O->shape, dev);
+    }
 }
 
 
 void LMaxPool::resize(int batch){
   LPool::resize(batch);
 
+  if (pd->O->isCPU()) return;
+
   delete pd->indX;
   delete pd->indY;
 
@@ -55,7 +59,7 @@ void LMaxPool::backward() {
 }
 
 Layer *LMaxPool::share(int c, int bs, vector<Layer *> p) {
-    auto *n = new LMaxPool(p[0], this->pd, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
+    auto *n = new LMaxPool(p[0], new PoolDescriptor(pd->ksize, pd->stride, pd->pad, pd->mem_level), "share_"+to_string(c)+this->name, this->dev, this->mem_level);
     n->orig = this;
 
     return n;
@@ -0,0 +1,53 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/layers/pool/layer_pool.h"
+
+
+using namespace std;
+
+
+// ---- MAXPOOL1D ----
+// constructors and clones
+
+LMaxPool1D::LMaxPool1D(Layer *parent, const vector<int> &pool_size, const vector<int> &strides, const string& padding, const string& name, int dev, int mem) : LMaxPool1D(parent, new PoolDescriptor({1, pool_size[0]}, {1, strides[0]}, padding, mem), name, dev, mem) {}
+
+LMaxPool1D::LMaxPool1D(Layer *parent, PoolDescriptor *D, const string& name, int dev, int mem) : LMaxPool(parent, D, name, dev, mem) {
+    if (input->ndim != 3) msg("LMaxPool1D only works over 3D tensors", "LMaxPool1D::LMaxPool1D");
+    if(name.empty()) this->name = "maxpool1D" + to_string(++total_layers);
+}
+
+
+void LMaxPool1D::forward() {
+    MPool1D(this->pd);
+}
+
+void LMaxPool1D::backward() {
+    MPool1D_back(this->pd);
+}
+
+Layer *LMaxPool1D::share(int c, int bs, vector<Layer *> p) {
+    auto *n = new LMaxPool1D(p[0], new PoolDescriptor(pd->ksize, pd->stride, pd->pad, pd->mem_level), "share_"+to_string(c)+this->name, this->dev, this->mem_level);
+    n->orig = this;
+
+    return n;
+}
+
+Layer *LMaxPool1D::clone(int c, int bs, vector<Layer *> p, int todev) {
+
+    auto *n = new LMaxPool1D(p[0], new PoolDescriptor(pd->ksize, pd->stride, pd->pad, pd->mem_level),  "share_"+to_string(c)+this->name, todev, this->mem_level);
+
+    n->orig = this;
+    return n;
+}
@@ -418,6 +418,13 @@ void LLSTM::backward() {
 
 }
 
+void LLSTM::free_grads() {
+  Layer::free_grads();
+  gWix = gWfx = gWox = gWcx = nullptr;
+  gWih = gWfh = gWoh = gWch = nullptr;
+  ginbias = gfnbias = gonbias = gcnbias = nullptr;
+}
+
 
 Layer *LLSTM::share(int c, int bs, vector<Layer *> p) {
     LLSTM *n = new LLSTM(p, units, mask_zeros, bidirectional, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
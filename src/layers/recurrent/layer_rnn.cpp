@@ -126,10 +126,15 @@ void LRNN::backward() {
     }
 
     // Regularizer
-    if (trainable) if(reg != nullptr) {reg->apply(this->Wx);reg->apply(this->Wy);}
+    if (trainable) if((reg != nullptr) && (!hold_reg)) {reg->apply(this->Wx);reg->apply(this->Wy);}
 
 }
 
+void LRNN::free_grads() {
+    Layer::free_grads();
+    gWx = gWy = gbias = nullptr;
+}
+
 
 Layer *LRNN::share(int c, int bs, vector<Layer *> p) {
     LRNN *n = new LRNN(p, units, activation, use_bias, bidirectional, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
@@ -0,0 +1,203 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "eddl/net/batch_queue.h"
+
+using namespace std;
+
+
+static int bq_bucket(long v) {
+    int k = 0;
+    while ((v > 1) && (k < BQ_BUCKETS - 1)) { v >>= 1; k++; }
+    return k;
+}
+
+BatchQueueStats::BatchQueueStats(int max_batch) {
+    requests = 0;
+    batches = 0;
+    queue_depth = 0;
+    batch_size = vector<long>(max_batch + 1, 0);
+    depth = vector<long>(BQ_BUCKETS, 0);
+    latency = vector<long>(BQ_BUCKETS, 0);
+}
+
+long BatchQueueStats::latency_quantile(float q) {
+    long n = 0, c = 0;
+    for (int k = 0; k < latency.size(); k++) n += latency[k];
+    for (int k = 0; k < latency.size(); k++) {
+        c += latency[k];
+        if ((n > 0) && (c >= q * n)) return 2L << k;
+    }
+    return 0;
+}
+
+
+// Checked before the stats are sized with it
+static int bq_max_batch(int max_batch) {
+    if (max_batch < 1) msg("max_batch must be > 0", "BatchQueue");
+    return max_batch;
+}
+
+BatchQueue::BatchQueue(Net *net, int max_batch, int max_wait_us) : st(bq_max_batch(max_batch)) {
+    if (max_wait_us < 0) msg("max_wait_us must be >= 0", "BatchQueue");
+
+    this->net = net;
+    this->max_batch = max_batch;
+    this->max_wait_us = max_wait_us;
+    stop = false;
+
+    session = new InferenceSession(net, max_batch);
+    for (int i = 0; i < session->lin.size(); i++) {
+        Tensor *in = session->lin[i]->output;
+        in_size.push_back(in->size / in->shape[0]);
+    }
+
+    worker = thread(&BatchQueue::run, this);
+}
+
+BatchQueue::~BatchQueue() {
+    {
+        lock_guard<mutex> lk(mtx);
+        stop = true;
+    }
+    cv.notify_all();
+    worker.join();
+
+    delete session;
+}
+
+future<vtensor> BatchQueue::submit(vtensor sample) {
+    if (sample.size() != in_size.size())
+        msg("sample tensor list does not match with defined input layers", "BatchQueue::submit");
+    for (int i = 0; i < sample.size(); i++) {
+        if (!sample[i]->isCPU()) msg("samples must be on CPU", "BatchQueue::submit");
+        if (sample[i]->size != in_size[i]) msg("sample size does not match with input layer", "BatchQueue::submit");
+    }
+
+    // The sample is copied, the caller may free it right away
+    auto *r = new Request;
+    for (int i = 0; i < sample.size(); i++) r->in.push_back(sample[i]->clone());
+    r->t = clock::now();
+    future<vtensor> f = r->out.get_future();
+
+    {
+        lock_guard<mutex> lk(mtx);
+        if (stop) {
+            for (int i = 0; i < r->in.size(); i++) delete r->in[i];
+            delete r;
+            msg("the queue is stopped", "BatchQueue::submit");
+        }
+        queue.push_back(r);
+        st.requests++;
+        st.queue_depth = queue.size();
+        st.depth[bq_bucket(queue.size())]++;
+    }
+    cv.notify_one();
+
+    return f;
+}
+
+BatchQueueStats BatchQueue::stats() {
+    lock_guard<mutex> lk(mtx);
+    return st;
+}
+
+void BatchQueue::run() {
+    vector<Request *> batch;
+
+    while (true) {
+        {
+            unique_lock<mutex> lk(mtx);
+            cv.wait(lk, [this]() { return stop || !queue.empty(); });
+            if (queue.empty()) return;  // stopped and drained
+
+            // Wait for a full batch until the oldest request times out
+            clock::time_point deadline = queue.front()->t + chrono::microseconds(max_wait_us);
+            cv.wait_until(lk, deadline, [this]() { return stop || (queue.size() >= (size_t)max_batch); });
+
+            int b = std::min((int)queue.size(), max_batch);
+            for (int i = 0; i < b; i++) {
+                batch.push_back(queue.front());
+                queue.pop_front();
+            }
+            st.queue_depth = queue.size();
+        }
+
+        run_batch(batch);
+        batch.clear();
+    }
+}
+
+void BatchQueue::run_batch(vector<Request *> &batch) {
+    int b = batch.size();
+    int i, j;
+
+    vtensor X;
+    for (i = 0; i < in_size.size(); i++) {
+        vector<int> shape = session->lin[i]->output->getShape();
+        shape[0] = b;
+        X.push_back(new Tensor(shape, DEV_CPU));
+        for (j = 0; j < b; j++)
+            std::copy(batch[j]->in[i]->ptr, batch[j]->in[i]->ptr + in_size[i], X[i]->ptr + (size_t)j * in_size[i]);
+    }
+
+    vector<vtensor> out(b);
+    exception_ptr err = nullptr;
+    try {
+        vtensor Y = session->predict(X);
+
+        // Scatter the rows of every output to the requests
+        for (i = 0; i < Y.size(); i++) {
+            vector<int> shape = Y[i]->getShape();
+            shape[0] = 1;
+            int s = Y[i]->size / b;
+            for (j = 0; j < b; j++) {
+                Tensor *y = new Tensor(shape, Y[i]->device);
+                if (Y[i]->isCPU()) std::copy(Y[i]->ptr + (size_t)j * s, Y[i]->ptr + (size_t)(j + 1) * s, y->ptr);
+                else {
+                    vector<int> ind = {j};
+                    Tensor::select(Y[i], y, ind, 0, 1);
+                }
+                out[j].push_back(y);
+            }
+            delete Y[i];
+        }
+    }
+    catch (...) {
+        err = current_exception();
+    }
+
+    for (i = 0; i < X.size(); i++) delete X[i];
+
+    // Stats are updated before the results are delivered
+    clock::time_point now = clock::now();
+    {
+        lock_guard<mutex> lk(mtx);
+        st.batches++;
+        st.batch_size[b]++;
+        for (j = 0; j < b; j++)
+            st.latency[bq_bucket(chrono::duration_cast<chrono::microseconds>(now - batch[j]->t).count())]++;
+    }
+
+    for (j = 0; j < b; j++) {
+        if (err == nullptr) batch[j]->out.set_value(out[j]);
+        else {
+            for (i = 0; i < out[j].size(); i++) delete out[j][i];
+            batch[j]->out.set_exception(err);
+        }
+        for (i = 0; i < batch[j]->in.size(); i++) delete batch[j]->in[i];
+        delete batch[j];
+    }
+}
@@ -0,0 +1,321 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <exception>
+
+#include <unistd.h>
+#include <poll.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "eddl/net/cluster.h"
+
+using namespace std;
+using namespace std::chrono;
+
+
+static int ring_mod(int a, int n) {
+    return ((a % n) + n) % n;
+}
+
+static void split_address(const string &address, string &host, int &port) {
+    size_t c = address.rfind(':');
+    if ((c == string::npos) || (c == 0)) msg("tcp address must be host:port, got " + address, "Cluster");
+    host = address.substr(0, c);
+    port = atoi(address.substr(c + 1).c_str());
+    if (port <= 0) msg("Bad port in " + address, "Cluster");
+}
+
+static void unix_address(const string &path, sockaddr_un &a) {
+    if (path.size() >= sizeof(a.sun_path)) msg("Socket path too long: " + path, "Cluster");
+    memset(&a, 0, sizeof(a));
+    a.sun_family = AF_UNIX;
+    strncpy(a.sun_path, path.c_str(), sizeof(a.sun_path) - 1);
+}
+
+
+Cluster::Cluster(int rank, int workers, const string &transport, const string &address, const vector<string> &hosts) {
+    if (workers < 1) msg("workers must be > 0", "Cluster");
+    if ((rank < 0) || (rank >= workers)) msg("rank must be in [0, workers)", "Cluster");
+    if ((transport != "unix") && (transport != "tcp")) msg("Unknown transport " + transport + " (unix or tcp)", "Cluster");
+
+    this->rank = rank;
+    this->workers = workers;
+    this->transport = transport;
+    weight = 1.0f;
+    listen_fd = send_fd = recv_fd = -1;
+    seg.resize(CLUSTER_SEGMENT);
+
+    if (workers > 1) connect_ring(address, hosts);
+}
+
+Cluster::Cluster(CompServ *cs) : Cluster(cs->rank, cs->workers, cs->transport, cs->address, cs->hosts) {}
+
+Cluster::~Cluster() {
+    if (send_fd >= 0) close(send_fd);
+    if (recv_fd >= 0) close(recv_fd);
+    if (listen_fd >= 0) close(listen_fd);
+    if (!path.empty()) unlink(path.c_str());
+}
+
+// Every rank listens, connects to the next one (once it listens) and then
+// accepts the previous one, so the ring closes whatever the start order
+void Cluster::connect_ring(const string &address, const vector<string> &hosts) {
+    int next = ring_mod(rank + 1, workers);
+    int prev = ring_mod(rank - 1, workers);
+    steady_clock::time_point deadline = steady_clock::now() + seconds(CLUSTER_TIMEOUT);
+
+    string host;
+    int port = 0;
+    sockaddr_un ua;
+    addrinfo *ai = nullptr;
+
+    if (transport == "unix") {
+        path = address + "." + to_string(rank);
+        unix_address(path, ua);
+        unlink(path.c_str());
+        listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if ((listen_fd < 0) || (::bind(listen_fd, (sockaddr *) &ua, sizeof(ua)) < 0))
+            msg("Can not listen on " + path + ": " + strerror(errno), "Cluster");
+    }
+    else {
+        split_address(address, host, port);
+        sockaddr_in ia;
+        memset(&ia, 0, sizeof(ia));
+        ia.sin_family = AF_INET;
+        ia.sin_addr.s_addr = htonl(INADDR_ANY);
+        ia.sin_port = htons(port + rank);
+        int on = 1;
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_fd >= 0) setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if ((listen_fd < 0) || (::bind(listen_fd, (sockaddr *) &ia, sizeof(ia)) < 0))
+            msg("Can not listen on port " + to_string(port + rank) + ": " + strerror(errno), "Cluster");
+
+        string nhost = ((next < hosts.size()) && (!hosts[next].empty())) ? hosts[next] : host;
+        addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(nhost.c_str(), to_string(port + next).c_str(), &hints, &ai) != 0)
+            msg("Unknown host " + nhost, "Cluster");
+    }
+    if (listen(listen_fd, workers) < 0) msg(string("listen: ") + strerror(errno), "Cluster");
+
+    // Next rank
+    if (transport == "unix") unix_address(address + "." + to_string(next), ua);
+    while (true) {
+        int r;
+        if (transport == "unix") {
+            send_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            r = connect(send_fd, (sockaddr *) &ua, sizeof(ua));
+        }
+        else {
+            send_fd = socket(AF_INET, SOCK_STREAM, 0);
+            r = connect(send_fd, ai->ai_addr, ai->ai_addrlen);
+        }
+        if (r == 0) break;
+
+        close(send_fd);
+        send_fd = -1;
+        if (steady_clock::now() > deadline) {
+            if (ai != nullptr) freeaddrinfo(ai);
+            msg("Rank " + to_string(next) + " not found", "Cluster");
+        }
+        this_thread::sleep_for(milliseconds(100));
+    }
+    if (ai != nullptr) freeaddrinfo(ai);
+
+    // Previous rank
+    pollfd pfd = {listen_fd, POLLIN, 0};
+    int left = duration_cast<milliseconds>(deadline - steady_clock::now()).count();
+    if (poll(&pfd, 1, std::max(left, 1000)) <= 0) msg("Rank " + to_string(prev) + " not connected", "Cluster");
+    recv_fd = accept(listen_fd, nullptr, nullptr);
+    if (recv_fd < 0) msg(string("accept: ") + strerror(errno), "Cluster");
+
+    if (transport == "tcp") {
+        int on = 1;
+        setsockopt(send_fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        setsockopt(recv_fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    }
+
+    // Both ends check the ring
+    float me = rank, who;
+    send_all(&me, 1);
+    recv_all(&who, 1);
+    if ((int) who != prev) msg("Rank " + to_string((int) who) + " connected instead of " + to_string(prev), "Cluster");
+}
+
+void Cluster::send_all(const float *p, long n) {
+    const char *c = (const char *) p;
+    size_t left = n * sizeof(float);
+    while (left > 0) {
+        ssize_t w = ::send(send_fd, c, left, MSG_NOSIGNAL);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            msg(string("send: ") + strerror(errno), "Cluster");
+        }
+        c += w;
+        left -= w;
+    }
+}
+
+void Cluster::recv_all(float *p, long n) {
+    char *c = (char *) p;
+    size_t left = n * sizeof(float);
+    while (left > 0) {
+        ssize_t r = ::recv(recv_fd, c, left, 0);
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            msg(string("recv: ") + strerror(errno), "Cluster");
+        }
+        if (r == 0) msg("Rank " + to_string(ring_mod(rank - 1, workers)) + " closed the connection", "Cluster");
+        c += r;
+        left -= r;
+    }
+}
+
+// Sends buf[si, se) to the next rank while buf[ri, re) is received from the
+// previous one (added to it if sum), segment by segment
+void Cluster::exchange(long si, long se, long ri, long re, bool sum) {
+    exception_ptr serr = nullptr, rerr = nullptr;
+
+    thread sender([&]() {
+        try {
+            send_all(buf.data() + si, se - si);
+        }
+        catch (...) {
+            serr = current_exception();
+        }
+    });
+
+    try {
+        for (long p = ri; p < re; p += CLUSTER_SEGMENT) {
+            long m = std::min((long) CLUSTER_SEGMENT, re - p);
+            if (!sum) {
+                recv_all(buf.data() + p, m);
+                continue;
+            }
+            recv_all(seg.data(), m);
+            float *d = buf.data() + p;
+            for (long i = 0; i < m; i++) d[i] += seg[i];
+        }
+    }
+    catch (...) {
+        rerr = current_exception();
+        shutdown(send_fd, SHUT_RDWR);  // the sender may wait for a reader that is gone
+    }
+
+    sender.join();
+    if (rerr != nullptr) rethrow_exception(rerr);
+    if (serr != nullptr) rethrow_exception(serr);
+}
+
+void Cluster::chunk(int c, long size, long &ini, long &end) {
+    ini = (size * c) / workers;
+    end = (size * (c + 1)) / workers;
+}
+
+// The tensors, one after the other, in buf
+void Cluster::gather(const vector<Tensor *> &T, long size) {
+    buf.resize(size);
+    long off = 0;
+    for (int t = 0; t < T.size(); t++) {
+        Tensor *v = new Tensor(T[t]->shape, buf.data() + off, DEV_CPU);
+        Tensor::copy(T[t], v);
+        v->ptr = nullptr;
+        delete v;
+        off += T[t]->size;
+    }
+}
+
+void Cluster::scatter(const vector<Tensor *> &T) {
+    long off = 0;
+    for (int t = 0; t < T.size(); t++) {
+        Tensor *v = new Tensor(T[t]->shape, buf.data() + off, DEV_CPU);
+        Tensor::copy(v, T[t]);
+        v->ptr = nullptr;
+        delete v;
+        off += T[t]->size;
+    }
+}
+
+// Ring reduce-scatter and all-gather, 2(workers-1) steps of 1/workers of the data
+void Cluster::all_reduce(const vector<Tensor *> &T, bool average) {
+    if (workers == 1) return;
+
+    long size = 0;
+    for (int t = 0; t < T.size(); t++) size += T[t]->size;
+    gather(T, size);
+
+    long si, se, ri, re;
+    for (int k = 0; k < workers - 1; k++) {
+        chunk(ring_mod(rank - k, workers), size, si, se);
+        chunk(ring_mod(rank - k - 1, workers), size, ri, re);
+        exchange(si, se, ri, re, true);
+    }
+
+    // This rank has now the sum of chunk rank+1
+    if (average) {
+        chunk(ring_mod(rank + 1, workers), size, ri, re);
+        for (long i = ri; i < re; i++) buf[i] /= workers;
+    }
+
+    for (int k = 0; k < workers - 1; k++) {
+        chunk(ring_mod(rank + 1 - k, workers), size, si, se);
+        chunk(ring_mod(rank - k, workers), size, ri, re);
+        exchange(si, se, ri, re, false);
+    }
+
+    scatter(T);
+}
+
+// Along the ring from root, every rank forwards a segment as soon as it has it
+void Cluster::broadcast(const vector<Tensor *> &T, int root) {
+    if (workers == 1) return;
+    if ((root < 0) || (root >= workers)) msg("root must be in [0, workers)", "Cluster::broadcast");
+
+    long size = 0;
+    for (int t = 0; t < T.size(); t++) size += T[t]->size;
+
+    if (rank == root) {
+        gather(T, size);
+        send_all(buf.data(), size);
+        return;
+    }
+
+    buf.resize(size);
+    bool forward = (ring_mod(rank + 1, workers) != root);
+    for (long p = 0; p < size; p += CLUSTER_SEGMENT) {
+        long m = std::min((long) CLUSTER_SEGMENT, size - p);
+        recv_all(buf.data() + p, m);
+        if (forward) send_all(buf.data() + p, m);
+    }
+    scatter(T);
+}
+
+vector<int> Cluster::shard(const vector<int> &sind) {
+    int n = sind.size();
+    if (n < workers) msg("batch size lower than the number of workers", "Cluster::shard");
+    long ini = (long) n * rank / workers;
+    long end = (long) n * (rank + 1) / workers;
+    weight = (float) ((end - ini) * workers) / n;
+    return vector<int>(sind.begin() + ini, sind.begin() + end);
+}
@@ -0,0 +1,178 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "eddl/net/collectives.h"
+
+using namespace std;
+
+
+// Elements [ini, ini+len) of T, without copying
+static Tensor *flat_view(Tensor *T, long ini, long len) {
+    return new Tensor({(int)len}, T->ptr + ini, T->device);
+}
+
+static void free_view(Tensor *v) {
+    v->ptr = nullptr;
+    delete v;
+}
+
+
+Collective::Collective(vector<vector<Tensor *>> R, int algo) {
+    if (R.empty()) msg("No replicas", "Collective");
+    for (int i = 1; i < R.size(); i++) {
+        if (R[i].size() != R[0].size()) msg("Replicas with different tensors", "Collective");
+        for (int t = 0; t < R[i].size(); t++)
+            if (!Tensor::eqsize(R[i][t], R[0][t])) msg("Replicas with different shapes", "Collective");
+    }
+
+    this->R = R;
+    n = R.size();
+    size = 0;
+    for (int t = 0; t < R[0].size(); t++) {
+        offset.push_back(size);
+        size += R[0][t]->size;
+    }
+
+    // Recursive halving needs a power of two
+    this->algo = algo;
+    if ((n & (n - 1)) != 0) this->algo = AR_RING;
+}
+
+// Chunks [lo, hi) in elements
+void Collective::chunks(int lo, int hi, long &ini, long &end) {
+    ini = (size * lo) / n;
+    end = (size * hi) / n;
+}
+
+void Collective::chunk(int i, long &ini, long &end) {
+    if (algo == AR_RING) chunks((i + 1) % n, (i + 1) % n + 1, ini, end);
+    else chunks(i, i + 1, ini, end);
+}
+
+// Elements [ini, end) of replica src added (or copied) to replica dst
+void Collective::transfer(int src, int dst, long ini, long end, bool sum) {
+    for (int t = 0; t < offset.size(); t++) {
+        long a = std::max(ini, offset[t]);
+        long b = std::min(end, offset[t] + R[src][t]->size);
+        if (a >= b) continue;
+
+        Tensor *s = flat_view(R[src][t], a - offset[t], b - a);
+        Tensor *d = flat_view(R[dst][t], a - offset[t], b - a);
+
+        if ((s->device != d->device) && (!s->isCPU()) && (!d->isCPU())) {
+            Tensor *h = new Tensor(s->shape, DEV_CPU);
+            Tensor::copy(s, h);
+            if (sum) Tensor::inc(h, d);
+            else Tensor::copy(h, d);
+            delete h;
+        }
+        else if (sum) Tensor::inc(s, d);
+        else Tensor::copy(s, d);
+
+        free_view(s);
+        free_view(d);
+    }
+}
+
+void Collective::scale(int i, long ini, long end, float f) {
+    for (int t = 0; t < offset.size(); t++) {
+        long a = std::max(ini, offset[t]);
+        long b = std::min(end, offset[t] + R[i][t]->size);
+        if (a >= b) continue;
+
+        Tensor *v = flat_view(R[i][t], a - offset[t], b - a);
+        v->mult_(f);
+        free_view(v);
+    }
+}
+
+void Collective::reduce_scatter() {
+    if (n == 1) return;
+
+    if (algo == AR_RING) {
+        // Step k: replica r adds chunk r-1-k of replica r-1
+        for (int k = 0; k < n - 1; k++) {
+            #pragma omp parallel for num_threads(n)
+            for (int r = 0; r < n; r++) {
+                long ini, end;
+                int c = ((r - 1 - k) % n + n) % n;
+                chunks(c, c + 1, ini, end);
+                transfer((r - 1 + n) % n, r, ini, end, true);
+            }
+        }
+        return;
+    }
+
+    // Replicas r and r^d reduce each one half of their range
+    vector<int> lo(n, 0), hi(n, n);
+    for (int d = n / 2; d >= 1; d /= 2) {
+        #pragma omp parallel for num_threads(n)
+        for (int r = 0; r < n; r++) {
+            long ini, end;
+            int mid = (lo[r] + hi[r]) / 2;
+            if (r & d) lo[r] = mid;
+            else hi[r] = mid;
+            chunks(lo[r], hi[r], ini, end);
+            transfer(r ^ d, r, ini, end, true);
+        }
+    }
+}
+
+void Collective::all_gather() {
+    if (n == 1) return;
+
+    if (algo == AR_RING) {
+        // Step k: replica r takes chunk r-k from replica r-1
+        for (int k = 0; k < n - 1; k++) {
+            #pragma omp parallel for num_threads(n)
+            for (int r = 0; r < n; r++) {
+                long ini, end;
+                int c = ((r - k) % n + n) % n;
+                chunks(c, c + 1, ini, end);
+                transfer((r - 1 + n) % n, r, ini, end, false);
+            }
+        }
+        return;
+    }
+
+    // Replicas r and r^d swap the halves they own, from one chunk up to all
+    for (int d = 1; d < n; d *= 2) {
+        #pragma omp parallel for num_threads(n)
+        for (int r = 0; r < n; r++) {
+            long ini, end;
+            int first = (r / d) * d;   // chunks owned by r at this level
+            int other = first ^ d;     // and by r^d
+            chunks(other, other + d, ini, end);
+            transfer(r ^ d, r, ini, end, false);
+        }
+    }
+}
+
+void Collective::all_reduce(bool average) {
+    if (n == 1) return;
+
+    reduce_scatter();
+
+    if (average) {
+        #pragma omp parallel for num_threads(n)
+        for (int r = 0; r < n; r++) {
+            long ini, end;
+            chunk(r, ini, end);
+            scale(r, ini, end, 1.0f / n);
+        }
+    }
+
+    all_gather();
+}
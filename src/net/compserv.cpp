@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 #include <thread>
+#include <fstream>
+#include <sstream>
 
 #include <stdexcept>
 #include "eddl/net/compserv.h"
@@ -33,6 +35,8 @@ CompServ::CompServ(int t, const vector<int> g, const vector<int> &f,int lsb, int
     local_fpgas = vector<int>(f.begin(), f.end());
 
     this->lsb=lsb;
+    rank=0;
+    workers=1;
 
     if (lsb<0) {
       throw std::runtime_error("Error creating CS with lsb<0 in CompServ::CompServ");
@@ -61,6 +65,11 @@ CompServ * CompServ::share() {
   n->lsb=lsb;
   n->isshared=true;
   n->mem_level=mem_level;
+  n->rank=rank;
+  n->workers=workers;
+  n->transport=transport;
+  n->address=address;
+  n->hosts=hosts;
 
   return n;
 }
@@ -69,5 +78,73 @@ CompServ * CompServ::share() {
 
 // for Distributed
 CompServ::CompServ(string filename) {
-     //TODO: Implement
+    type = "distributed";
+    isshared=false;
+
+    local_threads = std::thread::hardware_concurrency();
+    lsb=0;
+    mem_level=0;
+    rank=0;
+    workers=1;
+    transport="unix";
+
+    ifstream f(filename);
+    if (!f.is_open()) {
+      throw std::runtime_error("Error opening " + filename + " in CompServ::CompServ");
+    }
+
+    string line;
+    while (getline(f, line)) {
+      istringstream ss(line.substr(0, line.find('#')));
+      string key, mem;
+      int r;
+      if (!(ss >> key)) continue;
+
+      if (key=="workers") ss >> workers;
+      else if (key=="rank") ss >> rank;
+      else if (key=="threads") ss >> local_threads;
+      else if (key=="lsb") ss >> lsb;
+      else if (key=="transport") ss >> transport;
+      else if (key=="address") ss >> address;
+      else if (key=="host") {
+        ss >> r;
+        if ((!ss.fail()) && (r >= 0)) {
+          if (hosts.size() <= r) hosts.resize(r + 1);
+          ss >> hosts[r];
+        }
+      }
+      else if (key=="mem") {
+        ss >> mem;
+        if (mem=="full_mem") mem_level=0;
+        else if (mem=="mid_mem") mem_level=1;
+        else if (mem=="low_mem") mem_level=2;
+        else throw std::runtime_error("Error mem param " + mem + " in CompServ::CompServ");
+      }
+      else throw std::runtime_error("Unknown key " + key + " in " + filename + " in CompServ::CompServ");
+
+      if (ss.fail()) {
+        throw std::runtime_error("Error reading " + key + " in " + filename + " in CompServ::CompServ");
+      }
+    }
+
+    // The launcher tells every process its rank
+    const char *env = getenv("EDDL_RANK");
+    if (env != nullptr) rank = atoi(env);
+
+    if (local_threads==-1) local_threads = std::thread::hardware_concurrency();
+    if (workers<1) {
+      throw std::runtime_error("Error creating CS with workers<1 in CompServ::CompServ");
+    }
+    if ((rank<0)||(rank>=workers)) {
+      throw std::runtime_error("Error creating CS with rank out of [0, workers) in CompServ::CompServ");
+    }
+    if (lsb<0) {
+      throw std::runtime_error("Error creating CS with lsb<0 in CompServ::CompServ");
+    }
+    if ((transport!="unix")&&(transport!="tcp")) {
+      throw std::runtime_error("Error creating CS with transport " + transport + " in CompServ::CompServ");
+    }
+    if ((workers>1)&&(address.empty())) {
+      throw std::runtime_error("Error creating CS without address in CompServ::CompServ");
+    }
 }
@@ -17,6 +17,9 @@
 #include <chrono>
 #include <thread>
 #include "eddl/net/net.h"
+#include "eddl/net/pipeline.h"
+#include "eddl/net/update_stream.h"
+#include "eddl/net/cluster.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
@@ -66,6 +69,7 @@ int isInorig(Layer *l, vlayer vl, int &ind) {
 
 Net::Net() {
     batch_size=1;
+    batch_set=-1;
     optimizer = nullptr;
     name="model";
     tr_batches=0;
@@ -73,6 +77,15 @@ Net::Net() {
     flog_ts=nullptr;
     rnet=nullptr;
     isbuild=false;
+    isinference=false;
+    isaliased=false;
+    precision=DT_FLOAT32;
+    fsched=nullptr;
+    bsched=nullptr;
+    pipeline=nullptr;
+    ustream=nullptr;
+    backward_hook=nullptr;
+    cluster=nullptr;
 }
 
 Net::Net(vlayer in, vlayer out):Net() {
@@ -156,6 +169,12 @@ Net::Net(vector <Net *> vnets):Net()
 
 Net::~Net()
 {
+    alias_eval(false);
+
+    delete pipeline;
+    delete ustream;
+    delete cluster;
+
     for(int i=0;i<snets.size();i++){
 
         for(int j=0;j<snets[i]->layers.size();j++) {
@@ -180,6 +199,9 @@ Net::~Net()
 
     delete optimizer;
     optimizer= nullptr;
+
+    delete fsched;
+    delete bsched;
 }
 
 /////////////////////////////////////////
@@ -305,7 +327,17 @@ void Net::setlogfile(string fname)
 }
 
 
+// Quantized inference-only nets keep the int8 weights only (see quantize)
+static void check_float_weights(vlayer &layers, const string &where) {
+    for (int i = 0; i < layers.size(); i++)
+        for (int j = 0; j < layers[i]->params.size(); j++)
+            if (layers[i]->params[j]->ptr == nullptr)
+                msg("The float32 weights of " + layers[i]->name + " were released by quantize", where);
+}
+
 void Net::save(const string& filename, string format){
+    check_float_weights(layers, "Net::save");
+
     // Open file stream
     std::ofstream ofs(filename, std::ios::out | std::ios::binary);
 
@@ -323,6 +355,8 @@ void Net::save(const string& filename, string format){
 }
 
 void Net::load(const string& filename, string format){
+    check_float_weights(layers, "Net::load");
+
     // Open file stream
     std::ifstream ifs(filename, std::ios::in | std::ios::binary);
     if (!ifs.good()){
@@ -345,6 +379,37 @@ void Net::load(const string& filename, string format){
     ifs.close();
 }
 
+// The kernels are float32 only: activations and deltas are stored and
+// computed in float32 whatever the precision. They are rounded to it after
+// every layer, to check how a model trains with that precision (an extra
+// pass over them, no memory is saved)
+void Net::set_mixed_precision(int dtype){
+    if ((dtype!=DT_FLOAT32)&&(dtype!=DT_BFLOAT16))
+        msg("Unknown data type", "Net::set_mixed_precision");
+
+    // Params (master weights) and gradients are always kept in float32
+    for (int i = 0; i < snets.size(); i++) snets[i]->precision=dtype;
+    precision=dtype;
+}
+
+// Training splits every batch in micro_batches that go through nstages
+// threads (see Pipeline). nstages=0 goes back to the regular training.
+void Net::set_pipeline(int nstages, int micro_batches){
+    delete pipeline;
+    pipeline=nullptr;
+
+    if (nstages > 0) pipeline=new Pipeline(this, nstages, micro_batches);
+}
+
+// The update of every layer runs on its own thread as soon as its backward
+// is done, overlapped with the backward of the rest (see UpdateStream)
+void Net::set_overlap_update(bool on){
+    delete ustream;
+    ustream=nullptr;
+
+    if (on) ustream=new UpdateStream(this);
+}
+
 void Net::reset_accumulated_gradients(){
     for(Layer* l : layers){
         l->reset_accumulated_gradients();
@@ -16,7 +16,11 @@
 #include <chrono>
 #include <thread>
 #include <stdexcept>
+#include <algorithm>
 #include "eddl/net/net.h"
+#include "eddl/net/pipeline.h"
+#include "eddl/net/update_stream.h"
+#include "eddl/net/cluster.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
@@ -51,6 +55,20 @@ void *train_batch_t(void *t) {
   return nullptr;
 }
 
+void *accumulate_batch_t(void *t) {
+  auto *targs = (tdata *) t;
+
+  Net *net = targs->net;
+  net->do_reset();
+  net->do_forward();
+  net->do_compute_loss();
+
+  net->do_delta();
+  net->do_backward();
+
+  return nullptr;
+}
+
 void *eval_batch_t(void *t) {
   auto *targs = (tdata *) t;
 
@@ -180,6 +198,8 @@ void Net::setmode(int m) {
   for (int i = 0; i < snets.size(); i++)
   for (int j = 0; j < snets[i]->layers.size(); j++)
   snets[i]->layers[j]->setmode(m);
+
+  if (isbuild) alias_eval(m==TSMODE);
 }
 
 void Net::clamp(float min,float max)
@@ -192,6 +212,7 @@ void Net::clamp(float min,float max)
 
 void Net::setlr(vector <float> p)
 {
+  if (isinference) msg("Net built for inference only", "Net.setlr");
   for(int i=0;i<snets.size();i++)
   snets[i]->optimizer->change(p);
 }
@@ -208,7 +229,8 @@ void Net::forward(vector<Tensor*> in)
   }
   else {
 
-    reset();
+    // Inference only nets have no deltas to clear
+    if (!isinference) reset();
     if (in.size()) {
       if (in.size()!=lin.size())
       msg("size missmatch in list of tensors","Net.forward(vtensor)");
@@ -297,7 +319,7 @@ void Net::forward(vector<Layer *> in)
 
 void Net::forward()
 {
-  reset();
+  if (!isinference) reset();
 
   run_snets(forward_t);
 }
@@ -306,6 +328,7 @@ void Net::forward()
 //// BACKWARD
 void Net::backward(vector<Tensor *> target)
 {
+  if (isinference) msg("Net built for inference only", "Net.backward");
 
   if (isrecurrent) {
     if (rnet==nullptr) {
@@ -354,6 +377,7 @@ void Net::backward(vector<Tensor *> target)
 
 
 void Net::backward(){
+  if (isinference) msg("Net built for inference only", "Net.backward");
 
   vector<Net*> visited;
   tr_batches++;
@@ -520,6 +544,7 @@ void Net::print_loss(int b)
 
 void Net::reset_grads()
 {
+  if (isinference) msg("Net built for inference only", "Net.reset_grads");
   if (isrecurrent)
   if (rnet!=nullptr)
   rnet->reset_grads();
@@ -543,29 +568,35 @@ void Net::reset()
 
 void Net::update()
 {
+  if (isinference) msg("Net built for inference only", "Net.update");
   if (isrecurrent) {
     if (rnet!=nullptr) {
       rnet->update();
     }
   }
   else {
-    run_snets(update_t);
-
     int comp=snets.size();
 
+    if ((comp > 1) && (cs->lsb == 0)) sync_grads();
+    if ((cluster != nullptr) && (cs->lsb == 0)) sync_cluster(true);
+
+    run_snets(update_t);
+
     if (batch_size<comp) {
       msg("batch_size lower than computing service parallelism","update");
 
     }
 
-    if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (tr_batches%cs->lsb==1)) {
+    if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (cs->lsb > 0) && (tr_batches%cs->lsb==1)) {
       sync_weights();
     }
+    if ((cluster != nullptr) && (cs->lsb > 0) && (tr_batches%cs->lsb==1)) sync_cluster(false);
   }
 }
 
 void Net::delta()
 {
+  if (isinference) msg("Net built for inference only", "Net.delta");
   if (isrecurrent) {
     if (rnet!=nullptr)
     rnet->run_snets(delta_t);
@@ -577,7 +608,8 @@ void Net::delta()
 
 //////////////////////////////////////////////////////////////
 //////// HIGHER LEVEL FUNCS
-void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
+void Net::fit(vtensor tin, vtensor tout, int batch, int epochs, int accumulation_steps) {
+  if (isinference) msg("Net built for inference only", "Net.fit");
   int i, j, k, n;
 
   if (isrecurrent) {
@@ -608,12 +640,18 @@ void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
     msg("different number of samples in output tensor", "Net.fit");
 
 
-    // Set batch size
-    resize(batch);
+    // Check gradient accumulation
+    if (accumulation_steps < 1)
+    msg("accumulation steps must be >= 1", "Net.fit");
+    if (batch % accumulation_steps)
+    msg("batch size must be a multiple of the accumulation steps", "Net.fit");
+
+    // Set batch size (the net only holds one micro-batch at a time)
+    resize(batch / accumulation_steps);
 
     // Create array to store batch indices (later random)
     vind sind;
-    for (i = 0; i < batch_size; i++)
+    for (i = 0; i < batch; i++)
     sind.push_back(0);
 
 
@@ -621,10 +659,12 @@ void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
     setmode(TRMODE);
 
     // Set some parameters
-    int num_batches = n / batch_size;
+    int num_batches = n / batch;
 
     // Train network
-    fprintf(stdout, "%d epochs of %d batches of size %d\n", epochs, num_batches, batch_size);
+    fprintf(stdout, "%d epochs of %d batches of size %d\n", epochs, num_batches, batch);
+    if (accumulation_steps > 1)
+    fprintf(stdout, "(%d micro-batches of size %d)\n", accumulation_steps, batch_size);
     for (i = 0; i < epochs; i++) {
       high_resolution_clock::time_point e1 = high_resolution_clock::now();
       fprintf(stdout, "Epoch %d\n", i + 1);
@@ -635,12 +675,12 @@ void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
       for (j = 0; j < num_batches; j++) {
 
         // Set random indices
-        for (k = 0; k < batch_size; k++) sind[k] = rand() % n;
+        for (k = 0; k < batch; k++) sind[k] = rand() % n;
 
         // Train batch
         tr_batches++;
 
-        train_batch(tin, tout, sind);
+        train_batch(tin, tout, sind, 0, accumulation_steps);
 
         print_loss(j+1);
 
@@ -707,10 +747,7 @@ void Net::fit_recurrent(vtensor tin, vtensor tout, int batch, int epochs) {
 
 
 /////////////////////////////////////////
-void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval) {
-
-  if (batch_size!=sind.size()) resize(sind.size());
-
+void Net::load_batch(vtensor X, vtensor Y, vind sind) {
   int comp=snets.size();
 
   if (batch_size<comp) {
@@ -719,9 +756,6 @@ void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval) {
 
   int thread_batch_size=batch_size / comp;
 
-  if (eval) setmode(TSMODE);
-  else setmode(TRMODE);
-
   // Check indices
   if (sind.size() == 0) msg("error void index","Net::train_batch");
   // Split data for each network
@@ -742,18 +776,69 @@ void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval) {
       Tensor::copy(Ys[i][j], snets[i]->lout[j]->target);
     }
   }
+}
+
+/////////////////////////////////////////
+// Loss scaling checks all the gradients before any update
+bool Net::overlap_update() {
+  return (ustream != nullptr) && (cluster == nullptr) && (optimizer->get_loss_scale() == 1.0) && (!optimizer->dynamic_loss_scale);
+}
+
+void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval, int accumulation_steps) {
+  if (isinference) msg("Net built for inference only", "Net.train_batch");
+
+  // Every process of a distributed CS trains its part of the batch
+  if ((!eval) && (cluster != nullptr)) sind = cluster->shard(sind);
+
+  if ((!eval) && (pipeline != nullptr)) {
+    if (accumulation_steps > 1)
+      msg("the micro-batches of a pipelined net are set by set_pipeline","Net::train_batch");
+    pipeline->train_batch(X, Y, sind);
+    return;
+  }
+
+  if ((!eval) && (accumulation_steps > 1)) {
+    train_batch_accumulated(X, Y, sind, accumulation_steps);
+    return;
+  }
+
+  if (batch_size!=sind.size()) resize(sind.size());
+
+  int comp=snets.size();
+
+  if (eval) setmode(TSMODE);
+  else setmode(TRMODE);
+
+  load_batch(X, Y, sind);
 
   if (eval)
   run_snets(eval_batch_t);
+  else if (overlap_update()) {
+    // Every layer is updated (and averaged) as soon as its backward is done
+    run_snets(reset_grads_t);
+    ustream->begin();
+    run_snets(accumulate_batch_t);
+    ustream->end();
+  }
+  else if (((comp > 1) || (cluster != nullptr)) && (cs->lsb == 0)) {
+    // Synchronous data-parallel: average the gradients before the update
+    run_snets(reset_grads_t);
+    run_snets(accumulate_batch_t);
+    if (comp > 1) sync_grads();
+    if (cluster != nullptr) sync_cluster(true);
+    run_snets(update_t);
+  }
   else
   run_snets(train_batch_t);
 
   // If training (eval==0), apply gradients
   if (!eval) {
     // In case of multiple GPUS or FPGA synchronize params
-    if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (tr_batches%cs->lsb==0)) {
+    if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (cs->lsb > 0) && (tr_batches%cs->lsb==0)) {
       sync_weights();
     }
+    // Or the processes of a distributed CS
+    if ((cluster != nullptr) && (cs->lsb > 0) && (tr_batches%cs->lsb==0)) sync_cluster(false);
   }
 
   compute_loss();
@@ -761,8 +846,136 @@ void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval) {
 }
 
 
+/////////////////////////////////////////
+// Splits the logical batch "sind" in micro-batches, accumulates their
+// gradients in place and applies them once, as a single batch would.
+// Losses normalize the deltas by the micro-batch size, so the accumulated
+// gradients must be averaged over the number of micro-batches
+// (shared layers point to the same gradients, scale them only once)
+void Net::average_grads(int steps) {
+  vtensor scaled;
+  for (int i = 0; i < snets.size(); i++)
+    for (int j = 0; j < snets[i]->layers.size(); j++) {
+      Layer *l = snets[i]->layers[j];
+      for (int k = 0; k < l->get_trainable_params_count(); k++) {
+        bool done = false;
+        for (int p = 0; p < scaled.size(); p++)
+          if (scaled[p] == l->gradients[k]) { done = true; break; }
+        if (done) continue;
+        l->gradients[k]->div_(steps);
+        scaled.push_back(l->gradients[k]);
+      }
+    }
+}
+
+// Regularizers act on the weights, so they run once per logical batch: on
+// the backward of its last micro-batch, as they would on a single batch
+void Net::hold_regularizers(bool hold) {
+  for (int i = 0; i < snets.size(); i++)
+    for (int j = 0; j < snets[i]->layers.size(); j++)
+      snets[i]->layers[j]->hold_reg = hold;
+}
+
+void Net::train_batch_accumulated(vtensor X, vtensor Y, vind sind, int accumulation_steps) {
+  int j, k, s;
+
+  if (sind.size() % accumulation_steps)
+  msg("batch size must be a multiple of the accumulation steps","Net::train_batch");
+
+  int micro_batch=sind.size() / accumulation_steps;
+  if (batch_size!=micro_batch) resize(micro_batch);
+
+  int comp=snets.size();
+
+  setmode(TRMODE);
+
+  // Gradients are zeroed once and then incremented by every micro-batch
+  run_snets(reset_grads_t);
+
+  // Losses are reported for the whole logical batch
+  verr batch_err(fiterr.size(), 0.0);
+  verr prev_err(fiterr);
+  for (j = 0; j < fiterr.size(); j++) fiterr[j] = 0.0;
+
+  vind mind(micro_batch);
+  for (s = 0; s < accumulation_steps; s++) {
+    for (k = 0; k < micro_batch; k++) mind[k] = sind[(s * micro_batch) + k];
+
+    load_batch(X, Y, mind);
+
+    hold_regularizers(s < accumulation_steps - 1);
+    run_snets(accumulate_batch_t);
+
+    compute_loss();
+
+    for (j = 0; j < fiterr.size(); j++) {
+      batch_err[j] += fiterr[j];
+      fiterr[j] = 0.0;
+    }
+  }
+
+  for (j = 0; j < fiterr.size(); j++) fiterr[j] = prev_err[j] + batch_err[j];
+
+  average_grads(accumulation_steps);
+
+  if ((comp > 1) && (cs->lsb == 0)) sync_grads();
+  if ((cluster != nullptr) && (cs->lsb == 0)) sync_cluster(true);
+
+  run_snets(update_t);
+
+  // In case of multiple GPUS or FPGA synchronize params
+  if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (cs->lsb > 0) && (tr_batches%cs->lsb==0)) {
+    sync_weights();
+  }
+  if ((cluster != nullptr) && (cs->lsb > 0) && (tr_batches%cs->lsb==0)) sync_cluster(false);
+}
+
+
 ///////////////////////////////////////////
-void Net::evaluate(vtensor tin, vtensor tout) {
+// Samples per forward pass of predict/evaluate. Without an explicit batch
+// the current batch of the net is kept (e.g. the one of fit), so the
+// activations are not reallocated.
+int Net::stream_batch(int n, int batch) {
+  if (batch <= 0) {
+    if (batch_set > 0) batch = batch_size;
+    else batch = (n < STREAM_BATCH) ? n : STREAM_BATCH;
+  }
+  return batch;
+}
+
+// Evaluates the first n samples of a batch padded up to batch_size, the
+// losses and metrics only see those n samples
+void Net::eval_partial_batch(vtensor X, vtensor Y, vind sind, int n) {
+  int i, p;
+
+  load_batch(X, Y, sind);
+  forward();
+
+  for (i = 0, p = 0; i < lout.size(); i++, p += 2) {
+    collectTensor(lout[i], "output");
+
+    vector<int> shape = lout[i]->output->getShape();
+    shape[0] = n;
+    Tensor *out = new Tensor(shape, lout[i]->output->ptr, lout[i]->output->device);
+    Tensor *target = new Tensor(shape, lout[i]->output->device);
+    Tensor::select(Y[i], target, sind, 0, n);
+
+    if (losses.size() >= (i + 1))
+    fiterr[p] += losses[i]->value(target, out);
+    if (metrics.size() >= (i + 1))
+    fiterr[p + 1] += metrics[i]->value(target, out);
+
+    out->ptr = nullptr;
+    delete out;
+    delete target;
+  }
+
+  inferenced_samples += n;
+}
+
+///////////////////////////////////////////
+void Net::evaluate(vtensor tin, vtensor tout, int batch) {
+  if (isinference) msg("Net built for inference only", "Net.evaluate");
 
   int i, j, k, n;
 
@@ -786,11 +999,12 @@ void Net::evaluate(vtensor tin, vtensor tout) {
     if (tin[i]->shape[0] != n)
     msg("different number of samples in input tensor", "Net.evaluate");
 
-    for (i = 1; i < tout.size(); i++)
+    for (i = 0; i < tout.size(); i++)
     if (tout[i]->shape[0] != n)
     msg("different number of samples in output tensor", "Net.evaluate");
 
-
+    batch = stream_batch(n, batch);
+    if (batch_size != batch) resize(batch);
 
     printf("Evaluate with batch size %d\n",batch_size);
 
@@ -803,12 +1017,15 @@ void Net::evaluate(vtensor tin, vtensor tout) {
     // Start eval
     setmode(TSMODE);
     reset_loss();
-    for (j = 0; j < n / batch_size; j++) {
+    for (j = 0; j * batch_size < n; j++) {
+      int b = std::min(batch_size, n - (j * batch_size));
 
+      // The last batch is padded with its last sample
       for (k=0;k<batch_size;k++)
-      sind[k]=(j*batch_size)+k;
+      sind[k]=(j*batch_size)+std::min(k, b-1);
 
-      train_batch(tin, tout, sind, 1);
+      if (b == batch_size) train_batch(tin, tout, sind, 1);
+      else eval_partial_batch(tin, tout, sind, b);
 
       print_loss(j+1);
       fprintf(stdout, "\r");
@@ -864,25 +1081,144 @@ void Net::evaluate_recurrent(vtensor tin, vtensor tout) {
 
 
 ///////////////////////////////////////////
-vtensor Net::predict(vtensor tin) {
+// The samples go through the net in chunks of the same size and the outputs
+// are written to tensors allocated once for all of them, so the memory does
+// not depend on the number of samples
+vtensor Net::predict(vtensor tin, int batch) {
+  int i, j, k, n;
   vtensor out;
 
-  cout<<"Predict "<<tin[0]->shape[0]<<" samples\n";
+  if (isrecurrent) {
+    cout<<"Predict "<<tin[0]->shape[0]<<" samples\n";
+
+    setmode(TSMODE);
+
+    forward(tin);
+
+    cout<<"OK\n";
+    for (i = 0; i < lout.size(); i++) {
+      collectTensor(lout[i],"output");
+      out.push_back(lout[i]->output->clone());
+    }
+
+    return out;
+  }
+
+  if (tin.size() != lin.size())
+  msg("input tensor list does not match with defined input layers", "Net.predict");
+
+  n = tin[0]->shape[0];
+  for (i = 1; i < tin.size(); i++)
+  if (tin[i]->shape[0] != n)
+  msg("different number of samples in input tensor", "Net.predict");
+
+  cout<<"Predict "<<n<<" samples\n";
+
+  batch = stream_batch(n, batch);
+  if (batch_size != batch) resize(batch);
 
   setmode(TSMODE);
 
-  forward(tin);
+  vtensor X;
+  for (i = 0; i < tin.size(); i++) {
+    vector<int> shape = tin[i]->getShape();
+    shape[0] = batch_size;
+    X.push_back(new Tensor(shape, DEV_CPU));
+  }
 
-  cout<<"OK\n";
-  for (int i = 0; i < lout.size(); i++) {
-    collectTensor(lout[i],"output");
-    out.push_back(lout[i]->output->clone());
+  for (i = 0; i < lout.size(); i++) {
+    vector<int> shape = lout[i]->output->getShape();
+    shape[0] = n;
+    out.push_back(new Tensor(shape, lout[i]->output->device));
+  }
+
+  vind sind(batch_size);
+  vind oind;  // rows of out of the current chunk
+
+  for (j = 0; j < n; j += batch_size) {
+    int b = std::min(batch_size, n - j);
+
+    // The last chunk is padded with its last sample
+    for (k = 0; k < batch_size; k++)
+    sind[k] = j + std::min(k, b - 1);
+    oind.assign(sind.begin(), sind.begin() + b);
+
+    for (i = 0; i < tin.size(); i++)
+    Tensor::select(tin[i], X[i], sind, 0, batch_size);
+
+    forward(X);
+
+    for (i = 0; i < lout.size(); i++) {
+      collectTensor(lout[i],"output");
+      Tensor::deselect(lout[i]->output, out[i], oind, 0, b);
+    }
   }
 
+  for (i = 0; i < X.size(); i++) delete X[i];
+
+  cout<<"OK\n";
+
   return out;
 }
 
 
+/////////////////////////////////////////
+// Post-training quantization: a forward pass over the calibration samples
+// records the ranges of the quantizable layers, then their weights are
+// quantized to int8. Forward in TSMODE uses the int8 path afterwards.
+// MatMul and MultiHeadAttention layers are kept in float32.
+void Net::quantize(vtensor tin, bool per_channel) {
+  int i, j, n;
+
+  if (snets[0]->dev != DEV_CPU)
+  msg("int8 inference is only available on CPU", "Net.quantize");
+  if (isrecurrent)
+  msg("recurrent nets can not be quantized", "Net.quantize");
+  if (tin.size() != lin.size())
+  msg("input tensor list does not match with defined input layers", "Net.quantize");
+
+  n = tin[0]->shape[0];
+  for (i = 1; i < tin.size(); i++)
+  if (tin[i]->shape[0] != n)
+  msg("different number of samples in input tensor", "Net.quantize");
+
+  int batch = (batch_size < n) ? batch_size : n;
+
+  vind sind;
+  for (i = 0; i < n; i++) sind.push_back(i);
+
+  vtensor X;
+  for (i = 0; i < tin.size(); i++) {
+    vector<int> shape = tin[i]->shape;
+    shape[0] = batch;
+    X.push_back(new Tensor(shape, DEV_CPU));
+  }
+
+  // Calibration sees the unfolded Dense inputs
+  alias_eval(false);
+  for (i = 0; i < layers.size(); i++)
+  layers[i]->enable_calibration();
+
+  setmode(TSMODE);
+  for (j = 0; j + batch <= n; j += batch) {
+    for (i = 0; i < tin.size(); i++)
+    Tensor::select(tin[i], X[i], sind, j, j + batch);
+    forward(X);
+  }
+
+  for (i = 0; i < layers.size(); i++)
+  layers[i]->quantize(per_channel);
+
+  // Inference-only nets never go back to the float32 path, only the int8
+  // weights of the quantized layers are kept
+  if (isinference)
+  for (i = 0; i < layers.size(); i++)
+  layers[i]->free_float_weights();
+
+  for (i = 0; i < X.size(); i++) delete X[i];
+}
+
+
 
 
 
@@ -16,11 +16,13 @@
 #include <chrono>
 #include <thread>
 #include "eddl/net/net.h"
+#include "eddl/net/cluster.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
 
 #include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/conv/layer_conv.h"
 
 #ifdef cGPU
 #include "eddl/hardware/gpu/gpu_tensor.h"
@@ -66,6 +68,14 @@ void Net::fts() {
 
     }
 
+    // Independent branches run concurrently (see do_forward)
+    delete fsched;
+    fsched = new LayerScheduler(vfts, false);
+    if (fsched->width < 2) {
+        delete fsched;
+        fsched = nullptr;
+    }
+
    if (VERBOSE) {
     for (i = 0; i < vfts.size(); i++) {
       cout<<vfts[i]->name<<"-->";
@@ -111,6 +121,13 @@ void Net::bts() {
 
     }
 
+    delete bsched;
+    bsched = new LayerScheduler(vbts, true);
+    if (bsched->width < 2) {
+        delete bsched;
+        bsched = nullptr;
+    }
+
 if (VERBOSE) {
    for (i = 0; i < vbts.size(); i++) {
      cout<<vbts[i]->name<<"-->";
@@ -180,6 +197,16 @@ void Net::build(Optimizer *opt, vloss lo, vmetrics me, CompServ *cs, bool initia
 
   set_compserv(cs);
 
+  // All the processes start from the weights of the first one
+  if (cluster != nullptr) {
+    vtensor params;
+    for (int i = 0; i < layers.size(); i++) params.insert(params.end(), layers[i]->params.begin(), layers[i]->params.end());
+    cluster->broadcast(params, 0);
+  }
+
+  // On CPU the net runs its own layers, so their activations can be fused in place
+  if ((snets[0] == this) && (dev == DEV_CPU) && (!isrecurrent)) fuse_activations();
+
   if (VERBOSE) {
     if (cs->type == "local") {
       if (snets[0]->dev == DEV_CPU)
@@ -189,12 +216,33 @@ void Net::build(Optimizer *opt, vloss lo, vmetrics me, CompServ *cs, bool initia
       else
         cout << "Net running on FPGA " << snets[0]->dev - DEV_FPGA << "\n";
     }
+    else if (cluster != nullptr)
+      cout << "Net running on CPU, rank " << cluster->rank << " of " << cluster->workers << "\n";
   }
   isbuild=true;
 
 }
 
 
+// Builds the net for inference: no optimizer, losses or backward order, and
+// the gradients of the layers are released once the net is on its devices.
+void Net::build_inference(CompServ *cs, bool initialize){
+  for (int i = 0; i < layers.size(); i++)
+    if (layers[i]->isrecurrent) msg("Recurrent nets can not be built for inference only", "Net.build_inference");
+  if (mnets.size())
+    msg("Merged nets can not be built for inference only", "Net.build_inference");
+
+  isinference = true;
+  build(nullptr, {}, {}, cs, initialize);
+
+  for (int i = 0; i < snets.size(); i++)
+    if (snets[i] != this)
+      for (int j = 0; j < snets[i]->layers.size(); j++) snets[i]->layers[j]->free_grads();
+  for (int i = 0; i < layers.size(); i++) layers[i]->free_grads();
+
+  setmode(TSMODE);
+}
+
 void Net::build(Optimizer *opt, vloss lo, vmetrics me, bool initialize) {
     if (VERBOSE) cout<<"Build net "<<name<<"\n";
 
@@ -219,7 +267,7 @@ void Net::build(Optimizer *opt, vloss lo, vmetrics me, bool initialize) {
     }
     // set optimizer
     optimizer = opt;
-    optimizer->setlayers(layers);
+    if (optimizer != nullptr) optimizer->setlayers(layers);
 
     // set loss functions and create targets tensors
     this->losses = vloss(lo);
@@ -234,11 +282,101 @@ void Net::build(Optimizer *opt, vloss lo, vmetrics me, bool initialize) {
     // forward sort
     fts();
     // backward sort
-    bts();
+    if (!isinference) bts();
     // random params
     if(initialize) do_initialize();
 }
 
+// Activations right after a Dense or Conv layer are computed as the epilogue of its GEMM:
+// the parent writes the activated values into the activation's output, which is shared.
+void Net::fuse_activations(){
+    for (int i = 0; i < layers.size(); i++) {
+        LActivation *a = dynamic_cast<LActivation *>(layers[i]);
+        if ((a == nullptr) || (a->fused) || (a->parent.size() != 1)) continue;
+
+        int act;
+        float act_param = 0.0f;
+        if (a->act == "relu") act = GEMM_ACT_RELU;
+        else if ((a->act == "leaky_relu") && (a->params[0] >= 0.0f)) { act = GEMM_ACT_LEAKY_RELU; act_param = a->params[0]; }
+        else if (a->act == "sigmoid") act = GEMM_ACT_SIGMOID;
+        else if (a->act == "tanh") act = GEMM_ACT_TANH;
+        else continue;
+
+        // The parent output must not be seen by anyone else
+        Layer *p = a->parent[0];
+        int ind;
+        if ((p->child.size() != 1) || (isIn(p, lout, ind))) continue;
+
+        LDense *ld = dynamic_cast<LDense *>(p);
+        LConv *lc = dynamic_cast<LConv *>(p);
+        if (ld != nullptr) {
+            ld->act = act;
+            ld->act_param = act_param;
+        } else if (lc != nullptr) {
+            lc->cd->act = act;
+            lc->cd->act_param = act_param;
+            lc->cd->O = a->output;
+        } else continue;
+
+        delete p->output;
+        p->output = a->output;
+        a->input = a->output;
+        a->fused = true;
+    }
+}
+
+// In TSMODE the layers that are an identity (random data augmentation, noise,
+// dropout) alias the output of their parent instead of copying it. The
+// inference scaling of a Dropout is folded into the GEMM of the Dense that
+// follows it (CPU), otherwise that Dropout keeps its copy. Undone in TRMODE
+// and while resizing.
+void Net::alias_eval(bool on){
+  int ind;
+
+  if ((on == isaliased) || (isrecurrent)) return;
+  isaliased = on;
+
+  for (int s = 0; s < snets.size(); s++) {
+    Net *sn = snets[s];
+
+    vector<float *> before;
+    for (int i = 0; i < sn->vfts.size(); i++) before.push_back(sn->vfts[i]->output->ptr);
+
+    // Forward order, the parents are done first
+    for (int i = 0; i < sn->vfts.size(); i++) {
+      Layer *l = sn->vfts[i];
+
+      // Views of a parent (e.g. Reshape) follow its data
+      if ((l->parent.size() == 1) && (l->output != l->parent[0]->output) && (isIn(l->parent[0], sn->vfts, ind))
+          && (l->output->ptr == before[ind]) && (l->parent[0]->output->ptr != before[ind])) {
+        l->output->reallocate(l->parent[0]->output);
+        continue;
+      }
+
+      if (!on) {
+        if (l->own_output == nullptr) continue;
+
+        LDropout *d = dynamic_cast<LDropout *>(l);
+        if ((d != nullptr) && (d->iw)) ((LDense *)d->child[0])->alpha = 1.0f;
+
+        l->alias_input(false);
+        continue;
+      }
+
+      if ((l->parent.size() != 1) || (!l->eval_identity()) || (!Tensor::eqsize(l->input, l->output))) continue;
+
+      LDropout *d = dynamic_cast<LDropout *>(l);
+      if ((d != nullptr) && (d->iw)) {
+        LDense *c = (d->child.size() == 1) ? dynamic_cast<LDense *>(d->child[0]) : nullptr;
+        if ((c == nullptr) || (!c->input->isCPU()) || (c->qd != nullptr) || (isIn(d, sn->lout, ind))) continue;
+        c->alpha = 1.0f - d->df;
+      }
+
+      l->alias_input(true);
+    }
+  }
+}
+
 void Net::set_compserv(CompServ *cs){
     int todev;
     this->cs=cs;
@@ -329,8 +467,23 @@ void Net::set_compserv(CompServ *cs){
         } else {
             // split on multiple FPGAs
         }
+    } else if (cs->type == "distributed") {
+        // One process of a data-parallel job, its part runs on CPU
+        if (dev != DEV_CPU) msg("Net and Layers device missmatch", "Net.set_compserv");
+        if (mnets.size()) msg("Merged nets are not supported by the distributed CS", "Net.set_compserv");
+        if (isrecurrent) msg("Recurrent nets are not supported by the distributed CS", "Net.set_compserv");
+
+        int nthreads = cs->local_threads;
+        if (nthreads <= 0)
+            msg("Threads must be > 0", "Net.set_compserv");
+
+        Eigen::initParallel();
+        Eigen::setNbThreads(nthreads);
+
+        snets.push_back(this);
+        if ((!cs->isshared) && (cluster == nullptr)) cluster = new Cluster(cs);
     } else {
-        msg("Distributed version not yet implemented", "Net.set_compserv");
+        msg("Unknown computing service " + cs->type, "Net.set_compserv");
     }
 
 
@@ -404,7 +557,8 @@ void Net::split(int c, int todev) {
         char cname[100];
         sprintf(cname,"snet_%d",i);
         snets[i]->name=cname;
-        snets[i]->build(optimizer->clone(), losses, metrics);
+        snets[i]->isinference=isinference;
+        snets[i]->build(isinference ? nullptr : optimizer->clone(), losses, metrics);
         if(onnx_pretrained){ //We need to copy the imported weights to each snet
             //printf("Copying from CPU to GPU\n");
             for(int i = 0; i < snets.size(); i++)
@@ -421,8 +575,13 @@ void Net::resize(int b)
 {
   int i,j;
 
+  batch_set=b;
   if (batch_size==b) return;
 
+  // Aliased outputs get their own data back before being reallocated
+  bool aliased=isaliased;
+  alias_eval(false);
+
   batch_size=b;
   if (VERBOSE) cout<<"Resizing Net to batch_size="<<batch_size<<"\n";
 
@@ -464,6 +623,8 @@ void Net::resize(int b)
         Ys[i].push_back(new Tensor(snets[i]->lout[j]->output->shape));
   }
 
+  alias_eval(aliased);
+
   reset();
 
 }
@@ -15,7 +15,11 @@
 #include <string>
 #include <chrono>
 #include <thread>
+#include <mutex>
 #include "eddl/net/net.h"
+#include "eddl/net/collectives.h"
+#include "eddl/net/update_stream.h"
+#include "eddl/net/cluster.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
@@ -48,7 +52,51 @@ void Net::do_reset_grads() {
   }
 }
 
+// Layers of one net that run at the same time book their parents' deltas in turns
+static mutex delta_mtx;
+
+// round: emulate bfloat16 activations and deltas (see set_mixed_precision)
+static void forward_layer(Layer *l, bool round) {
+  // Aliases its parent in TSMODE (see alias_eval)
+  if (l->own_output != nullptr) return;
+
+  l->forward();
+
+  if (round) l->output->round_bfloat16_();
+}
+
+static void backward_layer(Layer *l, bool round) {
+  // Reserve parent's delta (if reserved, ignored)
+  {
+    lock_guard<mutex> lk(delta_mtx);
+    l->mem_delta_parent();
+  }
+
+  // The delta is complete once all the children have been processed
+  if ((round)&&(l->delta!=nullptr)) l->delta->round_bfloat16_();
+
+  l->backward();
+
+  // Delete this delta
+  if (l->mem_level) {
+    lock_guard<mutex> lk(delta_mtx);
+    l->free_delta();
+  }
+}
+
+// The task graphs are only worth it on CPU, with more than one thread
+bool Net::run_parallel(LayerScheduler *sched) {
+  return (sched != nullptr) && (dev == DEV_CPU) && (cs != nullptr) && (cs->local_threads > 1) && (!VERBOSE);
+}
+
 void Net::do_forward() {
+  bool round = (precision == DT_BFLOAT16);
+
+  if (run_parallel(fsched)) {
+    fsched->run(cs->local_threads, [this, round](int i) { forward_layer(vfts[i], round); });
+    return;
+  }
+
   if (VERBOSE) {
     cout<<"START FORWARD\n";
     getchar();
@@ -61,7 +109,8 @@ void Net::do_forward() {
       fprintf(stdout, "  %s In[%d,%s]:%f\n", vfts[i]->name.c_str(), j, vfts[i]->parent[j]->name.c_str(),vfts[i]->parent[j]->output->sum());
     }
 
-    vfts[i]->forward();
+    forward_layer(vfts[i], round);
+
     if (VERBOSE) {
       fprintf(stdout, "  %s Out:%f\n", vfts[i]->name.c_str(), vfts[i]->output->sum());
       getchar();
@@ -74,6 +123,16 @@ void Net::do_forward() {
 }
 
 void Net::do_backward() {
+  bool round = (precision == DT_BFLOAT16);
+
+  if ((run_parallel(bsched)) && (this->verbosity_level < 1)) {
+    bsched->run(cs->local_threads, [this, round](int i) {
+      backward_layer(vbts[i], round);
+      if (backward_hook != nullptr) backward_hook->ready(this, vbts[i]);
+    });
+    return;
+  }
+
   if (VERBOSE) {
     cout<<"START BACKWARD\n";
     getchar();
@@ -83,19 +142,12 @@ void Net::do_backward() {
       std::cout << vbts[i]->name << std::endl;
     }
 
-    // Reserve parent's delta (if reserved, ignored)
-    vbts[i]->mem_delta_parent();
-
-    // Do backward
     if (VERBOSE) {
       cout << "backward "<<vbts[i]->name << " delta="<<vbts[i]->delta->sum()<<"\n";
     }
 
-    vbts[i]->backward();
-
-
-    // Delete this delta
-    if(vbts[i]->mem_level) { vbts[i]->free_delta(); }
+    backward_layer(vbts[i], round);
+    if (backward_hook != nullptr) backward_hook->ready(this, vbts[i]);
   }
   if (VERBOSE) {
     cout<<"END BACKWARD\n";
@@ -103,6 +155,18 @@ void Net::do_backward() {
   }
 }
 
+// Layers vfts[first..last-1] only (e.g. a stage of a pipeline)
+void Net::do_forward(int first, int last) {
+  bool round = (precision == DT_BFLOAT16);
+  for (int i = first; i < last; i++) forward_layer(vfts[i], round);
+}
+
+// The same layers in reverse order
+void Net::do_backward(int first, int last) {
+  bool round = (precision == DT_BFLOAT16);
+  for (int i = last - 1; i >= first; i--) backward_layer(vfts[i], round);
+}
+
 void Net::do_delta() {
   if (VERBOSE) {
     cout<<"Delta\n";
@@ -112,6 +176,8 @@ void Net::do_delta() {
     lout[i]->mem_delta();
     if (losses.size()>=(i+1)) {
       losses[i]->delta(lout[i]->target, lout[i]->output, lout[i]->delta);
+      if ((optimizer!=nullptr)&&(optimizer->get_loss_scale()!=1.0))
+        lout[i]->delta->mult_(optimizer->get_loss_scale());
       if (VERBOSE) cout<<"Delta: "<<lout[i]->name<<" delta:"<<lout[i]->delta->sum()<<"\n";
     }
   }
@@ -144,31 +210,89 @@ void Net::do_compute_loss() {
 }
 
 void Net::do_applygrads() {
+  // Skip the update if the (loss scaled) gradients overflowed
+  if (!optimizer->unscale_grads()) return;
+
   optimizer->applygrads(batch_size);
 }
 
 
 
 
+// Params (or gradients) of every snet, in the same order for all of them
+static vector<vector<Tensor *>> replica_tensors(Net *net, bool grads) {
+  vector<vector<Tensor *>> R(net->snets.size());
+  for (int i = 0; i < net->snets.size(); i++)
+    for (int j = 0; j < net->snets[i]->layers.size(); j++) {
+      Layer *l = net->snets[i]->layers[j];
+      if (!grads) R[i].insert(R[i].end(), l->params.begin(), l->params.end());
+      else
+        for (int k = 0; k < l->get_trainable_params_count(); k++)
+          if (l->gradients[k] != nullptr) R[i].push_back(l->gradients[k]);
+    }
+  return R;
+}
+
 void Net::sync_weights() {
   //cout<<"\nSync weights...\n";
+  Collective C(replica_tensors(this, false), AR_HALVING);
+  C.all_reduce(true);
+
+  // The master keeps a copy of the average
+  if (snets[0] == this) return;
   for (int j = 0; j < layers.size(); j++)
-  for (int k = 0; k < layers[j]->params.size(); k++) {
-    // Taking average
-    layers[j]->params[k]->fill_(0.0);
-    for (int i = 0; i < snets.size(); i++) {
-      Tensor::inc(snets[i]->layers[j]->params[k], layers[j]->params[k]);
-    }
-    layers[j]->params[k]->div_(snets.size());
+    for (int k = 0; k < layers[j]->params.size(); k++)
+      Tensor::copy(snets[0]->layers[j]->params[k], layers[j]->params[k]);
+}
 
-    // copy-back to devices
-    for (int i = 0; i < snets.size(); i++) {
-      Tensor::copy(layers[j]->params[k], snets[i]->layers[j]->params[k]);
+// Distributed CS: the average of the gradients (or the weights) of all the
+// processes
+void Net::sync_cluster(bool grads) {
+  vtensor T = replica_tensors(this, grads)[0];
+
+  // Gradients are means over the shard, uneven shards weigh them by their size
+  if ((grads) && (cluster->weight != 1.0f))
+    for (int i = 0; i < T.size(); i++) T[i]->mult_(cluster->weight);
+
+  // Row-sparse gradients: the optimizer applies (and zeroGrads clears) only
+  // the listed rows, so every rank lists the rows touched by any of them. A
+  // 0/1 mask per row goes in the same all-reduce.
+  vlayer ml;
+  vector<int> mj;
+  vtensor masks;
+  if (grads)
+    for (int i = 0; i < snets[0]->layers.size(); i++) {
+      Layer *l = snets[0]->layers[i];
+      for (int k = 0; k < l->get_trainable_params_count(); k++) {
+        vector<int> *rows = l->sparse_rows(k);
+        if (rows == nullptr) continue;
+        Tensor *m = Tensor::zeros({l->gradients[k]->shape[0]});
+        for (int r = 0; r < (int)rows->size(); r++) m->ptr[(*rows)[r]] = 1.0f;
+        ml.push_back(l);
+        mj.push_back(k);
+        masks.push_back(m);
+      }
     }
+  T.insert(T.end(), masks.begin(), masks.end());
+
+  cluster->all_reduce(T, true);
 
+  for (int i = 0; i < masks.size(); i++) {
+    vector<int> rows;
+    for (int r = 0; r < masks[i]->size; r++)
+      if (masks[i]->ptr[r] > 0.0f) rows.push_back(r);
+    ml[i]->add_sparse_rows(mj[i], rows);
+    delete masks[i];
   }
 }
 
+// Synchronous data-parallel: every snet applies the average of the gradients
+// of all of them
+void Net::sync_grads() {
+  Collective C(replica_tensors(this, true), AR_HALVING);
+  C.all_reduce(true);
+}
+
 
 void collectTensor(Layer *l,string tname, int p)
 {
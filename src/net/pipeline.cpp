@@ -0,0 +1,332 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "eddl/net/pipeline.h"
+
+using namespace std;
+
+
+bool Pipeline::Channel::push(int m) {
+    unique_lock<mutex> lk(mtx);
+    cv.wait(lk, [this]() { return closed || (q.size() < capacity); });
+    if (closed) return false;
+    q.push_back(m);
+    cv.notify_all();
+    return true;
+}
+
+bool Pipeline::Channel::pop(int &m) {
+    unique_lock<mutex> lk(mtx);
+    cv.wait(lk, [this]() { return closed || !q.empty(); });
+    if (q.empty()) return false;
+    m = q.front();
+    q.pop_front();
+    cv.notify_all();
+    return true;
+}
+
+void Pipeline::Channel::close() {
+    lock_guard<mutex> lk(mtx);
+    closed = true;
+    cv.notify_all();
+}
+
+
+Pipeline::Pipeline(Net *net, int nstages, int micro_batches) {
+    if (!net->isbuild) msg("The net must be built first", "Pipeline");
+    if ((net->dev != DEV_CPU) || (net->snets.size() != 1) || (net->snets[0] != net))
+        msg("Pipelines run on CPU only", "Pipeline");
+    if (net->isrecurrent) msg("Recurrent nets are not supported", "Pipeline");
+    if (net->isinference) msg("Net built for inference only", "Pipeline");
+    if (net->mnets.size()) msg("Merged nets are not supported", "Pipeline");
+    if (net->cluster != nullptr) msg("Distributed nets are not supported", "Pipeline");
+    if ((nstages < 1) || (nstages > net->vfts.size())) msg("nstages must be in [1, number of layers]", "Pipeline");
+    if (micro_batches < 1) msg("micro_batches must be > 0", "Pipeline");
+
+    this->net = net;
+    this->nstages = nstages;
+    this->micro_batches = micro_batches;
+    batch_size = net->batch_size;
+    threads = std::max(1, net->cs->local_threads / nstages);
+    error = nullptr;
+
+    split();
+
+    // Lanes are created stage by stage, so every stage allocates its
+    // activations from its own core group
+    int nlanes = std::min(nstages, micro_batches);
+    vector<vlayer> ll(nlanes);
+    on_stages([&](int s) {
+        int ind;
+        for (int m = 0; m < nlanes; m++)
+            for (int i = first[s]; i < first[s + 1]; i++) {
+                Layer *l = net->vfts[i];
+                vlayer par;
+                for (int j = 0; j < l->parent.size(); j++) {
+                    if (!isIn(l->parent[j], net->vfts, ind)) msg("Unexpected error", "Pipeline");
+                    par.push_back(ll[m][ind]);
+                }
+
+                Layer *n = l->share(m, batch_size, par);
+                if (n == nullptr) msg("Layer " + l->name + " can not be shared", "Pipeline");
+                ll[m].push_back(n);
+            }
+    });
+
+    for (int m = 0; m < nlanes; m++) {
+        vlayer lin, lout;
+        int ind;
+        for (int j = 0; j < net->lin.size(); j++) {
+            isIn(net->lin[j], net->vfts, ind);
+            lin.push_back(ll[m][ind]);
+        }
+        for (int j = 0; j < net->lout.size(); j++) {
+            isIn(net->lout[j], net->vfts, ind);
+            lout.push_back(ll[m][ind]);
+        }
+
+        Net *lane = new Net(lin, lout);
+        lane->build(nullptr, net->losses, net->metrics, false);
+
+        // The stages split the lanes as they split the net
+        lane->vfts = ll[m];
+        lane->vbts.clear();
+        delete lane->fsched;
+        delete lane->bsched;
+        lane->fsched = lane->bsched = nullptr;
+
+        lane->fuse_activations();
+        lane->batch_size = batch_size;
+        lane->optimizer = net->optimizer;  // loss scale of do_delta, not owned
+        lanes.push_back(lane);
+    }
+
+    for (int s = 0; s < nstages - 1; s++) {
+        fwd.push_back(new Channel);
+        bwd.push_back(new Channel);
+    }
+}
+
+Pipeline::~Pipeline() {
+    for (int m = 0; m < lanes.size(); m++) {
+        vlayer ll = lanes[m]->vfts;
+        lanes[m]->optimizer = nullptr;
+        delete lanes[m];
+        for (int i = ll.size() - 1; i >= 0; i--) delete ll[i];
+    }
+    for (int s = 0; s < fwd.size(); s++) {
+        delete fwd[s];
+        delete bwd[s];
+    }
+}
+
+// Contiguous stages of similar cost. The cost of a layer is its output plus
+// its params times the positions they are applied to (MACs of Dense and Conv)
+void Pipeline::split() {
+    int n = net->vfts.size();
+    vector<double> cost(n);
+    double total = 0.0;
+    for (int i = 0; i < n; i++) {
+        Tensor *o = net->vfts[i]->output;
+        double per = o->size / o->shape[0];
+        double ch = (o->ndim > 1) ? o->shape[1] : 1;
+        double p = 0.0;
+        for (int j = 0; j < net->vfts[i]->params.size(); j++) p += net->vfts[i]->params[j]->size;
+        cost[i] = per + p * (per / ch);
+        total += cost[i];
+    }
+
+    first = {0};
+    double acc = 0.0;
+    for (int i = 0; i < n; i++) {
+        acc += cost[i];
+        int s = first.size();
+        int left = n - (i + 1);
+        if ((s < nstages) && (left >= nstages - s) && ((left == nstages - s) || (acc >= total * s / nstages)))
+            first.push_back(i + 1);
+    }
+    first.push_back(n);
+}
+
+// Threads of a stage: OpenMP teams of its size, on its own cores when there are enough
+void Pipeline::bind(int s) {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+#ifdef __linux__
+    int ncores = thread::hardware_concurrency();
+    if (ncores >= nstages * threads) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int c = s * threads; c < (s + 1) * threads; c++) CPU_SET(c, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+}
+
+// f(s) on a thread of every stage, one stage after the other
+void Pipeline::on_stages(const function<void(int)> &f) {
+    for (int s = 0; s < nstages; s++) {
+        thread t([&, s]() {
+            bind(s);
+            try {
+                f(s);
+            }
+            catch (...) {
+                error = current_exception();
+            }
+        });
+        t.join();
+
+        if (error != nullptr) {
+            exception_ptr e = error;
+            error = nullptr;
+            rethrow_exception(e);
+        }
+    }
+}
+
+void Pipeline::resize(int b) {
+    if (b == batch_size) return;
+    batch_size = b;
+
+    on_stages([&](int s) {
+        for (int m = 0; m < lanes.size(); m++)
+            for (int i = first[s]; i < first[s + 1]; i++) lanes[m]->vfts[i]->resize(b);
+    });
+    for (int m = 0; m < lanes.size(); m++) lanes[m]->batch_size = b;
+}
+
+void Pipeline::train_batch(vtensor X, vtensor Y, vind sind) {
+    int i, m, s;
+
+    if (sind.size() % micro_batches)
+        msg("batch size must be a multiple of the micro-batches", "Pipeline::train_batch");
+    resize(sind.size() / micro_batches);
+
+    net->setmode(TRMODE);
+    for (m = 0; m < lanes.size(); m++) {
+        lanes[m]->precision = net->precision;
+        for (i = 0; i < lanes[m]->vfts.size(); i++) lanes[m]->vfts[i]->setmode(TRMODE);
+    }
+
+    // Gradients are zeroed once and then incremented by every micro-batch
+    net->do_reset_grads();
+
+    lane_err = verr(net->fiterr.size(), 0.0);
+    error = nullptr;
+    for (s = 0; s < fwd.size(); s++) {
+        fwd[s]->q.clear();
+        fwd[s]->closed = false;
+        fwd[s]->capacity = nstages;
+        bwd[s]->q.clear();
+        bwd[s]->closed = false;
+        bwd[s]->capacity = nstages;
+    }
+
+    vector<thread> th;
+    for (s = 0; s < nstages; s++)
+        th.push_back(thread(&Pipeline::run_stage, this, s, std::ref(X), std::ref(Y), std::ref(sind)));
+    for (s = 0; s < nstages; s++) th[s].join();
+
+    if (error != nullptr) rethrow_exception(error);
+
+    net->average_grads(micro_batches);
+    net->do_applygrads();
+
+    for (i = 0; i < lane_err.size(); i++) net->fiterr[i] += lane_err[i];
+    net->inferenced_samples += sind.size();
+}
+
+// 1F1B: stage s starts nstages-s-1 micro-batches, then runs one forward and one backward
+void Pipeline::run_stage(int s, vtensor &X, vtensor &Y, vind &sind) {
+    bind(s);
+
+    try {
+        int warm = std::min(nstages - s - 1, micro_batches);
+        int f = 0, b = 0;
+
+        for (; f < warm; f++)
+            if (!forward(s, f, X, Y, sind)) return;
+
+        while (b < micro_batches) {
+            if ((f < micro_batches) && (!forward(s, f++, X, Y, sind))) return;
+            if (!backward(s, b++)) return;
+        }
+    }
+    catch (...) {
+        {
+            lock_guard<mutex> lk(err_mtx);
+            if (error == nullptr) error = current_exception();
+        }
+        for (int k = 0; k < fwd.size(); k++) {
+            fwd[k]->close();
+            bwd[k]->close();
+        }
+    }
+}
+
+bool Pipeline::forward(int s, int m, vtensor &X, vtensor &Y, vind &sind) {
+    Net *lane = lanes[m % lanes.size()];
+    int ini = m * batch_size;
+    int end = ini + batch_size;
+    int i, j;
+
+    if (s > 0) {
+        if (!fwd[s - 1]->pop(j)) return false;
+    }
+    else {
+        for (j = 0; j < X.size(); j++) Tensor::select(X[j], lane->lin[j]->input, sind, ini, end);
+    }
+
+    for (i = first[s]; i < first[s + 1]; i++) lane->vfts[i]->reset();
+    lane->do_forward(first[s], first[s + 1]);
+
+    if (s < nstages - 1) return fwd[s]->push(m);
+
+    // Last stage: losses and deltas of the outputs
+    for (j = 0; j < Y.size(); j++) {
+        lane->lout[j]->check_target();
+        Tensor::select(Y[j], lane->lout[j]->target, sind, ini, end);
+    }
+    lane->do_compute_loss();
+    for (j = 0; j < lane_err.size(); j++) lane_err[j] += lane->fiterr[j];
+    lane->do_delta();
+
+    return true;
+}
+
+bool Pipeline::backward(int s, int m) {
+    Net *lane = lanes[m % lanes.size()];
+    int i, j;
+
+    if (s < nstages - 1) {
+        if (!bwd[s]->pop(j)) return false;
+    }
+
+    // Regularizers decay the shared weights once, after the last micro-batch
+    for (i = first[s]; i < first[s + 1]; i++) lane->vfts[i]->hold_reg = (m < micro_batches - 1);
+    lane->do_backward(first[s], first[s + 1]);
+
+    if (s > 0) return bwd[s - 1]->push(m);
+    return true;
+}
@@ -0,0 +1,249 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include <map>
+#include <set>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "eddl/net/scheduler.h"
+
+using namespace std;
+
+
+// Layer whose delta is really written: views (Reshape, DA...) write their parent's
+static Layer *delta_root(Layer *l) {
+    while ((l->shares_parent_delta()) && (l->parent.size() == 1)) l = l->parent[0];
+    return l;
+}
+
+LayerScheduler::LayerScheduler(vector<Layer *> &order, bool backward) {
+    int i, j;
+
+    size = order.size();
+    map<Layer *, int> ind;
+    for (i = 0; i < size; i++) ind[order[i]] = i;
+
+    vector<set<int>> pred(size);
+    map<void *, int> last;   // last layer that used params, or wrote a delta or a gradient
+
+    for (i = 0; i < size; i++) {
+        Layer *l = order[i];
+        vector<Layer *> &deps = backward ? l->child : l->parent;
+        for (j = 0; j < deps.size(); j++) {
+            auto it = ind.find(deps[j]);
+            if (it != ind.end()) pred[i].insert(it->second);
+        }
+
+        vector<void *> res;
+        if (!backward) {
+            // Shared copies (e.g. the time steps of an unrolled net) have the
+            // same params, and may update them (running statistics)
+            for (j = 0; j < l->params.size(); j++) res.push_back(l->params[j]);
+        }
+        else {
+            for (j = 0; j < l->parent.size(); j++) res.push_back(delta_root(l->parent[j]));
+            for (j = 0; j < l->gradients.size(); j++)
+                if (l->gradients[j] != nullptr) res.push_back(l->gradients[j]);
+        }
+
+        for (j = 0; j < res.size(); j++) {
+            auto it = last.find(res[j]);
+            if ((it != last.end()) && (it->second != i)) pred[i].insert(it->second);
+            last[res[j]] = i;
+        }
+    }
+
+    succ = vector<vector<int>>(size);
+    npred = vector<int>(size, 0);
+    pending = unique_ptr<atomic<int>[]>(new atomic<int>[size]);
+
+    // Depth of every layer, the order is topological
+    vector<int> depth(size, 0);
+    vector<int> count(size + 1, 0);
+    for (i = 0; i < size; i++) {
+        for (int p : pred[i]) {
+            succ[p].push_back(i);
+            depth[i] = std::max(depth[i], depth[p] + 1);
+        }
+        npred[i] = pred[i].size();
+        count[depth[i]]++;
+    }
+    width = (size > 0) ? *std::max_element(count.begin(), count.end()) : 0;
+
+    nthreads = 1;
+    task = nullptr;
+    remaining = 0;
+    queued = 0;
+    running = 0;
+    failed = false;
+    generation = 0;
+    stop = false;
+    queues.push_back(unique_ptr<Queue>(new Queue));
+}
+
+LayerScheduler::~LayerScheduler() {
+    stop_workers();
+}
+
+void LayerScheduler::start_workers(int n) {
+    while (queues.size() < n) queues.push_back(unique_ptr<Queue>(new Queue));
+    for (int w = 1; w < n; w++) workers.push_back(thread(&LayerScheduler::worker, this, w));
+}
+
+void LayerScheduler::stop_workers() {
+    {
+        lock_guard<mutex> lk(mtx);
+        stop = true;
+    }
+    cv.notify_all();
+    for (int w = 0; w < workers.size(); w++) workers[w].join();
+    workers.clear();
+    stop = false;
+}
+
+void LayerScheduler::run(int nthreads, const function<void(int)> &f) {
+    if (size == 0) return;
+
+    int n = std::min(nthreads, width);
+    if (n <= 1) {
+        for (int i = 0; i < size; i++) f(i);
+        return;
+    }
+    if (workers.size() != n - 1) {
+        stop_workers();
+        start_workers(n);
+    }
+
+#ifdef _OPENMP
+    int omp_threads = omp_get_max_threads();
+#endif
+
+    this->nthreads = nthreads;
+    task = &f;
+    failed = false;
+    error = nullptr;
+    running = 0;
+    for (int i = 0; i < size; i++) pending[i] = npred[i];
+    remaining = size;
+
+    for (int i = 0; i < size; i++)
+        if (npred[i] == 0) push(0, i);
+    {
+        lock_guard<mutex> lk(mtx);
+        generation++;
+    }
+    cv.notify_all();
+
+    drain(0);
+
+#ifdef _OPENMP
+    omp_set_num_threads(omp_threads);
+#endif
+
+    if (error != nullptr) rethrow_exception(error);
+}
+
+void LayerScheduler::worker(int w) {
+    long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lk(mtx);
+            cv.wait(lk, [&]() { return stop || (generation != seen); });
+            if (stop) return;
+            seen = generation;
+        }
+        drain(w);
+    }
+}
+
+// Runs ready layers until the whole graph is done
+void LayerScheduler::drain(int w) {
+    int i;
+    while (true) {
+        if (pop(w, i)) {
+            execute(w, i);
+            continue;
+        }
+        unique_lock<mutex> lk(mtx);
+        if (remaining == 0) return;
+        cv.wait(lk, [&]() { return (queued > 0) || (remaining == 0) || stop; });
+        if (stop) return;
+    }
+}
+
+void LayerScheduler::push(int w, int i) {
+    {
+        lock_guard<mutex> lk(queues[w]->mtx);
+        queues[w]->q.push_back(i);
+    }
+    queued++;
+    {
+        lock_guard<mutex> lk(mtx);
+    }
+    cv.notify_all();
+}
+
+// Own layers in LIFO order (the last one made ready is hot in cache),
+// other workers' in FIFO order
+bool LayerScheduler::pop(int w, int &i) {
+    int nq = queues.size();
+    for (int k = 0; k < nq; k++) {
+        Queue *q = queues[(w + k) % nq].get();
+        lock_guard<mutex> lk(q->mtx);
+        if (q->q.empty()) continue;
+        if (k == 0) {
+            i = q->q.back();
+            q->q.pop_back();
+        } else {
+            i = q->q.front();
+            q->q.pop_front();
+        }
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+void LayerScheduler::execute(int w, int i) {
+    int inflight = (++running) + queued;
+
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(1, nthreads / std::max(1, inflight)));
+#endif
+
+    if (!failed) {
+        try {
+            (*task)(i);
+        }
+        catch (...) {
+            lock_guard<mutex> lk(mtx);
+            if (!failed) error = current_exception();
+            failed = true;
+        }
+    }
+    running--;
+
+    for (int s : succ[i])
+        if (--pending[s] == 0) push(w, s);
+
+    if (--remaining == 0) {
+        {
+            lock_guard<mutex> lk(mtx);
+        }
+        cv.notify_all();
+    }
+}
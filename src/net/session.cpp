@@ -0,0 +1,143 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/net/session.h"
+#include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/conv/layer_conv.h"
+
+using namespace std;
+
+
+// Rows [ini, ini+b) of T, without copying
+static Tensor *batch_view(Tensor *T, int ini, int b) {
+    vector<int> shape = T->getShape();
+    shape[0] = b;
+    return new Tensor(shape, T->ptr + (size_t)ini * (T->size / T->shape[0]), T->device);
+}
+
+static void free_view(Tensor *v) {
+    v->ptr = nullptr;
+    delete v;
+}
+
+// Quantization of the int8 layers (Dense, Conv), nullptr for the others
+static QuantDescriptor **quant_of(Layer *l) {
+    LDense *d = dynamic_cast<LDense *>(l);
+    if (d != nullptr) return &d->qd;
+    LConv *c = dynamic_cast<LConv *>(l);
+    if (c != nullptr) return &c->qd;
+    return nullptr;
+}
+
+
+InferenceSession::InferenceSession(Net *net, int max_batch) {
+    if (!net->isbuild) msg("The net must be built first", "InferenceSession");
+    if (net->isrecurrent) msg("Recurrent nets are not supported", "InferenceSession");
+    if (max_batch < 1) msg("max_batch must be > 0", "InferenceSession");
+
+    this->net = net;
+    this->max_batch = max_batch;
+    batch_size = max_batch;
+
+    // Layers of the device net (the net itself on CPU), which hold the params
+    Net *src = net->snets[0];
+    int ind;
+
+    for (int i = 0; i < src->vfts.size(); i++) {
+        Layer *l = src->vfts[i];
+        vlayer par;
+        for (int j = 0; j < l->parent.size(); j++) {
+            if (!isIn(l->parent[j], src->vfts, ind)) msg("Unexpected error", "InferenceSession");
+            par.push_back(layers[ind]);
+        }
+
+        Layer *n = l->share(0, max_batch, par);
+        if (n == nullptr) msg("Layer " + l->name + " can not be shared", "InferenceSession");
+        n->setmode(TSMODE);
+
+        // Own copy of the packed weights and scratch of quantized layers
+        QuantDescriptor **q = quant_of(l);
+        if ((q != nullptr) && (*q != nullptr) && ((*q)->quantized)) {
+            QuantDescriptor *c = new QuantDescriptor(**q);
+            c->calibrating = false;
+            c->qI.clear();
+            *quant_of(n) = c;
+            quant.push_back(c);
+        }
+        layers.push_back(n);
+    }
+
+    for (int i = 0; i < src->lin.size(); i++) {
+        if (!isIn(src->lin[i], src->vfts, ind)) msg("Unexpected error", "InferenceSession");
+        lin.push_back(layers[ind]);
+    }
+    for (int i = 0; i < src->lout.size(); i++) {
+        if (!isIn(src->lout[i], src->vfts, ind)) msg("Unexpected error", "InferenceSession");
+        lout.push_back(layers[ind]);
+    }
+}
+
+InferenceSession::~InferenceSession() {
+    for (int i = layers.size() - 1; i >= 0; i--) delete layers[i];
+    for (int i = 0; i < (int)quant.size(); i++) delete quant[i];
+}
+
+// Views (e.g. Reshape) follow their parents, so layers go in forward order.
+// Activations are only reallocated when the batch changes.
+void InferenceSession::resize(int b) {
+    if (b == batch_size) return;
+    batch_size = b;
+    for (int i = 0; i < layers.size(); i++) layers[i]->resize(b);
+}
+
+void InferenceSession::forward() {
+    for (int i = 0; i < layers.size(); i++) layers[i]->forward();
+}
+
+vtensor InferenceSession::predict(vtensor tin) {
+    if (tin.size() != lin.size())
+        msg("input tensor list does not match with defined input layers", "InferenceSession::predict");
+
+    int n = tin[0]->shape[0];
+    for (int i = 1; i < tin.size(); i++)
+        if (tin[i]->shape[0] != n) msg("different number of samples in input tensor", "InferenceSession::predict");
+
+    vtensor out;
+    for (int i = 0; i < lout.size(); i++) {
+        vector<int> shape = lout[i]->output->getShape();
+        shape[0] = n;
+        out.push_back(new Tensor(shape, lout[i]->output->device));
+    }
+
+    for (int ini = 0; ini < n; ini += max_batch) {
+        int b = std::min(max_batch, n - ini);
+        resize(b);
+
+        for (int i = 0; i < tin.size(); i++) {
+            Tensor *v = batch_view(tin[i], ini, b);
+            Tensor::copy(v, lin[i]->output);
+            free_view(v);
+        }
+
+        forward();
+
+        for (int i = 0; i < lout.size(); i++) {
+            Tensor *v = batch_view(out[i], ini, b);
+            Tensor::copy(lout[i]->output, v);
+            free_view(v);
+        }
+    }
+
+    return out;
+}
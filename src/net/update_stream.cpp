@@ -0,0 +1,190 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "eddl/net/update_stream.h"
+#include "eddl/net/collectives.h"
+
+using namespace std;
+
+
+UpdateStream::UpdateStream(Net *net) {
+    if (!net->isbuild) msg("The net must be built first", "UpdateStream");
+    if (net->isinference) msg("Net built for inference only", "UpdateStream");
+    if (net->isrecurrent) msg("Recurrent nets are not supported", "UpdateStream");
+
+    this->net = net;
+    sync = false;
+    total = done = 0;
+    stop = false;
+    error = nullptr;
+
+    worker = thread(&UpdateStream::run, this);
+}
+
+UpdateStream::~UpdateStream() {
+    {
+        lock_guard<mutex> lk(mtx);
+        stop = true;
+        cv.notify_all();
+    }
+    worker.join();
+}
+
+// Layers are matched by their index, the same in all the snets
+void UpdateStream::setup() {
+    snets = net->snets;
+
+    groups.clear();
+    if (sync) groups.push_back(snets);
+    else
+        for (int i = 0; i < snets.size(); i++) groups.push_back({snets[i]});
+
+    vlayer &ll = snets[0]->layers;
+    owner = vector<int>(ll.size(), -1);
+    members = vector<vector<int>>(ll.size());
+    for (int j = 0; j < ll.size(); j++) {
+        if (ll[j]->get_trainable_params_count() == 0) continue;
+        owner[j] = j;
+        for (int k = 0; k < j; k++)
+            if ((owner[k] == k) && (ll[k]->gradients[0] == ll[j]->gradients[0])) {
+                owner[j] = k;
+                break;
+            }
+        members[owner[j]].push_back(j);
+    }
+
+    where.clear();
+    for (int g = 0; g < groups.size(); g++)
+        for (int i = 0; i < groups[g].size(); i++)
+            for (int j = 0; j < groups[g][i]->layers.size(); j++)
+                where[groups[g][i]->layers[j]] = make_pair(g, j);
+
+    total = 0;
+    for (int j = 0; j < owner.size(); j++)
+        if (owner[j] == j) total += groups.size();
+}
+
+void UpdateStream::begin() {
+    bool s = (net->snets.size() > 1) && (net->cs->lsb == 0);
+    if ((net->snets != snets) || (s != sync)) {
+        sync = s;
+        setup();
+    }
+
+    {
+        lock_guard<mutex> lk(mtx);
+        done = 0;
+        error = nullptr;
+        q.clear();
+        pending = vector<vector<int>>(groups.size(), vector<int>(owner.size(), 0));
+        for (int g = 0; g < groups.size(); g++)
+            for (int j = 0; j < owner.size(); j++)
+                if (owner[j] == j) pending[g][j] = groups[g].size() * members[j].size();
+    }
+
+    for (int i = 0; i < snets.size(); i++) {
+        snets[i]->optimizer->begin_step();
+        snets[i]->backward_hook = this;
+    }
+}
+
+void UpdateStream::ready(Net *snet, Layer *l) {
+    auto it = where.find(l);
+    if (it == where.end()) return;
+    int g = it->second.first;
+    int o = owner[it->second.second];
+    if (o < 0) return;
+
+    lock_guard<mutex> lk(mtx);
+    if (--pending[g][o] == 0) {
+        q.push_back(make_pair(g, o));
+        cv.notify_all();
+    }
+}
+
+void UpdateStream::end() {
+    {
+        unique_lock<mutex> lk(mtx);
+
+        // Layers the backward did not reach are updated as well
+        for (int g = 0; g < groups.size(); g++)
+            for (int j = 0; j < owner.size(); j++)
+                if ((owner[j] == j) && (pending[g][j] > 0)) {
+                    pending[g][j] = 0;
+                    q.push_back(make_pair(g, j));
+                }
+        cv.notify_all();
+
+        cv.wait(lk, [this]() { return done == total; });
+    }
+
+    for (int i = 0; i < snets.size(); i++) snets[i]->backward_hook = nullptr;
+
+    if (error != nullptr) {
+        exception_ptr e = error;
+        error = nullptr;
+        rethrow_exception(e);
+    }
+}
+
+void UpdateStream::run() {
+    // The updates are elementwise, the cores are left to the backward
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+
+    unique_lock<mutex> lk(mtx);
+    while (true) {
+        cv.wait(lk, [this]() { return stop || !q.empty(); });
+        if (stop) return;
+
+        pair<int, int> job = q.front();
+        q.pop_front();
+        lk.unlock();
+
+        exception_ptr e = nullptr;
+        try {
+            update(job.first, job.second);
+        }
+        catch (...) {
+            e = current_exception();
+        }
+
+        lk.lock();
+        if ((e != nullptr) && (error == nullptr)) error = e;
+        done++;
+        cv.notify_all();
+    }
+}
+
+void UpdateStream::update(int g, int o) {
+    vector<Net *> &G = groups[g];
+
+    if (sync && (G.size() > 1)) {
+        vector<vector<Tensor *>> R(G.size());
+        for (int i = 0; i < G.size(); i++) {
+            Layer *l = G[i]->layers[o];
+            for (int k = 0; k < l->get_trainable_params_count(); k++) R[i].push_back(l->gradients[k]);
+        }
+        Collective C(R, AR_HALVING);
+        C.all_reduce(true);
+    }
+
+    for (int i = 0; i < G.size(); i++)
+        for (int m = 0; m < members[o].size(); m++) G[i]->optimizer->update_layer(members[o][m]);
+}
@@ -10,6 +10,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <cmath>
 
 #include "eddl/optimizers/optim.h"
 
@@ -19,6 +20,12 @@ using namespace std;
 Optimizer::Optimizer() {
   isshared=false;
   clip_val=-1;
+  orig=nullptr;
+
+  loss_scale=1.0;
+  dynamic_loss_scale=false;
+  scale_window=2000;
+  good_steps=0;
 }
 
 void Optimizer::set_clip_val(float v)
@@ -35,3 +42,82 @@ void Optimizer::clip()
       layers[i]->gradients[j]->clamp_(-clip_val,clip_val);
 
 }
+
+// Gradients of layers[i] only
+void Optimizer::clip(int i)
+{
+  if (clip_val<0) return;
+
+  for (int j = 0; j < layers[i]->get_trainable_params_count(); j++)
+    layers[i]->gradients[j]->clamp_(-clip_val,clip_val);
+}
+
+void Optimizer::applygrads(int batch)
+{
+  if (isshared) {
+    orig->applygrads(batch);
+    return;
+  }
+
+  begin_step();
+  for (int i = 0; i < layers.size(); i++) update_layer(i);
+}
+
+// Position of the first param of layers[i] in the per-param state (e.g. momentum)
+int Optimizer::param_index(int i)
+{
+  int p = 0;
+  for (int k = 0; k < i; k++) p += layers[k]->get_trainable_params_count();
+  return p;
+}
+
+void Optimizer::set_loss_scale(float scale, bool dynamic, int window)
+{
+  if (scale<=0) msg("loss scale must be > 0","Optimizer::set_loss_scale");
+
+  loss_scale=scale;
+  dynamic_loss_scale=dynamic;
+  scale_window=window;
+  good_steps=0;
+}
+
+void Optimizer::copy_loss_scale(Optimizer *o)
+{
+  loss_scale=o->loss_scale;
+  dynamic_loss_scale=o->dynamic_loss_scale;
+  scale_window=o->scale_window;
+}
+
+float Optimizer::get_loss_scale()
+{
+  if (isshared) return orig->get_loss_scale();
+  return loss_scale;
+}
+
+// Removes the loss scale from the gradients. Returns false when they
+// overflowed, in which case the update must be skipped.
+bool Optimizer::unscale_grads()
+{
+  if (isshared) return orig->unscale_grads();
+  if ((loss_scale==1.0)&&(!dynamic_loss_scale)) return true;
+
+  bool finite=true;
+  for (int i = 0; i < layers.size(); i++)
+    for (int j = 0; j < layers[i]->get_trainable_params_count(); j++) {
+      if (loss_scale!=1.0) layers[i]->gradients[j]->div_(loss_scale);
+      if (!std::isfinite(layers[i]->gradients[j]->sum())) finite=false;
+    }
+
+  if (dynamic_loss_scale) {
+    if (!finite) {
+      loss_scale/=2.0;
+      good_steps=0;
+    }
+    else if (++good_steps>=scale_window) {
+      loss_scale*=2.0;
+      good_steps=0;
+    }
+  }
+
+  return finite;
+}
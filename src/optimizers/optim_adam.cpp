@@ -12,6 +12,8 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -31,8 +33,6 @@ Adam::Adam(float lr, float beta_1, float beta_2, float epsilon, float weight_dec
 Adam::~Adam() {
   mT.clear();
   vT.clear();
-  mCap.clear();
-  vCap.clear();
 }
 
 void Adam::change(vector<float> &p) {
@@ -43,6 +43,7 @@ void Adam::change(vector<float> &p) {
 Optimizer *Adam::clone() {
     Adam *n=new Adam(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad);
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
     
     return n;
 }
@@ -51,6 +52,7 @@ Optimizer *Adam::share() {
     n->orig=this;
     n->isshared=true;
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
     return n;
 }
 void Adam::setlayers(vlayer l) {
@@ -65,43 +67,37 @@ void Adam::setlayers(vlayer l) {
             mT.back()->fill_(0.0);
             vT.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
             vT.back()->fill_(0.0);
-            mCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
-            mCap.back()->fill_(0.0);
-            vCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
-            vCap.back()->fill_(0.0);
         }
 
 }
 
-void Adam::applygrads(int batch) {
+void Adam::begin_step() {
+  if (isshared) orig->begin_step();
+  else t++;
+}
+
+void Adam::update_layer(int i) {
   if (isshared) {
-    orig->applygrads(batch);
+    orig->update_layer(i);
+    return;
   }
-  else {
-    clip();
-    int p = 0;
-    t++;
-    for (int i = 0; i < layers.size(); i++)
-      if (layers[i]->trainable) {
-        for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
-            Tensor::add(beta_1,mT[p],(1-beta_1),layers[i]->gradients[j],mT[p],0);
-            layers[i]->gradients[j]->sqr_();
-            Tensor::add(beta_2,vT[p],(1-beta_2),layers[i]->gradients[j],vT[p],0);
-
-            Tensor::copy(mT[p],mCap[p]);
-            mCap[p]->div_(1-pow(beta_1,t));
-
-            Tensor::copy(vT[p],vCap[p]);
-            vCap[p]->div_(1-pow(beta_2,t));
-            vCap[p]->add_(epsilon);
-            vCap[p]->sqrt_();
-
-            Tensor::el_div(mCap[p],vCap[p],mCap[p],0);
-
-            Tensor::add(-lr, mCap[p],1.0,layers[i]->params[j], layers[i]->params[j], 0);
-        }
-    }
-    else p+=layers[i]->get_trainable_params_count();
+  if (!layers[i]->trainable) return;
+
+  clip(i);
+  int p = param_index(i);
+  for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+      vector<int> *rows = layers[i]->sparse_rows(j);
+      if (rows != nullptr) {
+        // lazy update, only rows with gradient
+        adam_rows(layers[i]->params[j], layers[i]->gradients[j], mT[p], vT[p], *rows, lr, beta_1, beta_2, epsilon, t);
+        continue;
+      }
+      // moments and weights in a single pass
+      Expr g(layers[i]->gradients[j]), m(mT[p]), v(vT[p]), w(layers[i]->params[j]);
+      float c1 = 1 - pow(beta_1, t), c2 = 1 - pow(beta_2, t);
+      Tensor::eval({mT[p], vT[p], layers[i]->params[j]},
+                   {beta_1 * m + (1 - beta_1) * g,
+                    beta_2 * v + (1 - beta_2) * sqr(g),
+                    w - lr * (m / c1) / sqrt(v / c2 + epsilon)});
   }
-
 }
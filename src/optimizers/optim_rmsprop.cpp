@@ -12,6 +12,8 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -26,7 +28,6 @@ RMSProp::RMSProp(float lr, float rho, float epsilon, float weight_decay) : Optim
 
 RMSProp::~RMSProp() {
   gT1.clear();
-  gT.clear();
 }
 
 void RMSProp::change(vector<float> &p) {
@@ -38,6 +39,7 @@ void RMSProp::change(vector<float> &p) {
 Optimizer *RMSProp::clone() {
     RMSProp *n=new RMSProp(lr, rho, epsilon, weight_decay);
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
 
     return n;
 }
@@ -47,6 +49,7 @@ Optimizer *RMSProp::share() {
     n->orig=this;
     n->isshared=true;
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
     return n;
 }
 void RMSProp::setlayers(vlayer l) {
@@ -59,47 +62,27 @@ void RMSProp::setlayers(vlayer l) {
         for (int j = 0; j < layers[i]->get_trainable_params_count(); j++) {
             gT1.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
             gT1.back()->fill_(0.0);
-            gT.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
-            gT.back()->fill_(0.0);
         }
 
 }
 
-void RMSProp::applygrads(int batch) {
+void RMSProp::update_layer(int i) {
   if (isshared) {
-    orig->applygrads(batch);
+    orig->update_layer(i);
+    return;
   }
-  else {
-
-    clip();
-
-    int p = 0;
-    for (int i = 0; i < layers.size(); i++)
-      if (layers[i]->trainable) {
-        for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
-            Tensor::copy(layers[i]->gradients[j],gT[p]);
-            gT[p]->sqr_();
-            gT[p]->mult_(1.0f-rho);
-
-            gT1[p]->sqr_();
-            gT1[p]->mult_(rho);
-            Tensor::add(1.0,gT1[p],1.0,gT[p],gT[p],0);
-
-            gT[p]->add_(epsilon);
-            gT[p]->sqrt_();
-            Tensor::el_div(layers[i]->gradients[j],gT[p],gT[p],0);
-
-            Tensor::copy(layers[i]->gradients[j],gT1[p]);
-
-            Tensor::add(-lr, gT[p],1.0,layers[i]->params[j], layers[i]->params[j], 0);
-
-      			/*if (layers[i]->acc_gradients.size() > 0) {
-        				Tensor::add(-lr, gT[p],1.0,layers[i]->acc_gradients[j], layers[i]->acc_gradients[j], 0);
-      			}
-            */
-        }
-    }
-    else p+=layers[i]->get_trainable_params_count();
+  if (!layers[i]->trainable) return;
+
+  clip(i);
+  int p = param_index(i);
+  for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+      vector<int> *rows = layers[i]->sparse_rows(j);
+      if (rows != nullptr) {
+        rmsprop_rows(layers[i]->params[j], layers[i]->gradients[j], gT1[p], *rows, lr, rho, epsilon);
+        continue;
+      }
+      Expr g(layers[i]->gradients[j]), g1(gT1[p]), w(layers[i]->params[j]);
+      Tensor::eval({layers[i]->params[j], gT1[p]},
+                   {w - lr * g / sqrt((1.0f - rho) * sqr(g) + rho * sqr(g1) + epsilon), g});
   }
-
 }
@@ -12,6 +12,8 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -36,6 +38,7 @@ void SGD::change(vector<float> &p) {
 Optimizer *SGD::clone() {
     SGD *n=new SGD(lr, mu, weight_decay, nesterov);
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
 
     return n;
 }
@@ -45,6 +48,7 @@ Optimizer *SGD::share() {
     n->orig=this;
     n->isshared=true;
     n->clip_val=clip_val;
+    n->copy_loss_scale(this);
     return n;
 }
 
@@ -63,21 +67,22 @@ void SGD::setlayers(vlayer l) {
 
 }
 
-void SGD::applygrads(int batch) {
+void SGD::update_layer(int i) {
     if (isshared) {
-      orig->applygrads(batch);
+      orig->update_layer(i);
+      return;
     }
-    else {
-      clip();
-      int p = 0;
-      for (int i = 0; i < layers.size(); i++) {
-        if (layers[i]->trainable) {
-          for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
-            Tensor::add(lr , layers[i]->gradients[j], mu, mT[p], mT[p], 0);
-            Tensor::add(1.0, layers[i]->params[j], -1.0, mT[p], layers[i]->params[j], 0);
-          }
-        }
-        else p+=layers[i]->get_trainable_params_count();
+    if (!layers[i]->trainable) return;
+
+    clip(i);
+    int p = param_index(i);
+    for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+      vector<int> *rows = layers[i]->sparse_rows(j);
+      if (rows != nullptr) {
+        sgd_rows(layers[i]->params[j], layers[i]->gradients[j], mT[p], *rows, lr, mu);
+        continue;
       }
+      Expr g(layers[i]->gradients[j]), m(mT[p]), w(layers[i]->params[j]);
+      Tensor::eval({mT[p], layers[i]->params[j]}, {lr * g + mu * m, w - m});
     }
 }
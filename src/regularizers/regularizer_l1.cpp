@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include "eddl/regularizers/regularizer.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -22,10 +23,5 @@ RL1::RL1(float l1) : Regularizer("l1") {
 }
 
 void RL1::apply(Tensor* T) {
-    Tensor *S = T->clone();
-
-    S->sign_();
-    Tensor::add(1.0f, T, -this->l1, S, T, 0);
-
-    delete S;
+    Tensor::eval(T, Expr(T) - this->l1 * sign(Expr(T)));
 }
@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include "eddl/regularizers/regularizer.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -23,14 +24,5 @@ RL1L2::RL1L2(float l1, float l2) : Regularizer("l1_l2") {
 }
 
 void RL1L2::apply(Tensor* T) {
-  Tensor *S = T->clone();
-  Tensor *A = T->clone();
-
-  S->sign_();
-  Tensor::add(1.0f, T, -this->l1, S, T, 0);
-
-  Tensor::add(1.0f, T, -this->l2, A, T, 0);
-
-  delete A;
-  delete S;
+  Tensor::eval(T, (1.0f - this->l2) * Expr(T) - this->l1 * sign(Expr(T)));
 }
@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include "eddl/regularizers/regularizer.h"
+#include "eddl/tensor/tensor_expr.h"
 
 using namespace std;
 
@@ -22,9 +23,5 @@ RL2::RL2(float l2) : Regularizer("l2") {
 }
 
 void RL2::apply(Tensor* T) {
-    Tensor *B = T->clone();
-
-    Tensor::add(1.0f, T, -this->l2, B, T, 0);
-
-    delete B;
+    Tensor::eval(T, (1.0f - this->l2) * Expr(T));
 }
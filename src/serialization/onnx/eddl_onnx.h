@@ -28,14 +28,15 @@
 	Net* import_net_from_onnx_string(std::string* model_string, int mem=0);
 
 #if defined(cPROTO)
-	Net* build_net_onnx(onnx::ModelProto model, int mem);
+	Net* build_net_onnx(const onnx::ModelProto &model, int mem, string base_dir="");
 #endif
 
 	// Exporting module
 	//----------------------------------------------------------------------------------------
 
-	// Saves a model with the onnx format in the file path provided
-	void save_net_to_onnx_file( Net *net, string path );
+	// Saves a model with the onnx format in the file path provided. With external_data the
+	// weights are streamed to "<path>.data" and referenced from the model (ONNX external data)
+	void save_net_to_onnx_file( Net *net, string path, bool external_data=false );
 
 	// Returns a pointer to the serialized model in Onnx
 	size_t serialize_net_to_onnx_pointer( Net *net, void * & serialized_model, bool gradients=false );
@@ -121,11 +122,31 @@
 	void set_weights_from_onnx(Net* net, std::string* model_string);
 	void set_weights_from_onnx_pointer(Net* net, void *ptr_model, size_t model_size );
 
+	// Accumulates the gradients (or weights delta) stored in the onnx net. Compressed nets are
+	// decoded transparently
 	void apply_grads_from_onnx(Net* net, std::string* model_string);
     void apply_grads_from_onnx_pointer( Net* net, void * ptr_onnx, size_t count );
 
+	// Compressed exchange
+	// ---------------------------------------------------------------------------------------
+
+	#define COMPRESS_NONE 0 // Full fp32 values
+	#define COMPRESS_BF16 1 // bfloat16
+	#define COMPRESS_INT8 2 // 8-bit linear quantization, one scale per tensor
+	#define COMPRESS_TOPK 3 // Only the topk_ratio largest magnitudes, as sparse initializers
+
+	// Serializes the accumulated gradients compressed. The compression error is kept in the
+	// layers and added to the next exchange (error feedback)
+	size_t serialize_grads_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio=0.01 );
+	std::string* serialize_grads_to_onnx_string( Net *net, int compression, float topk_ratio=0.01 );
+
+	// Serializes the change of the weights since the previous call (the first call marks the
+	// starting point). Apply it on the other nodes with apply_grads_from_onnx
+	size_t serialize_weights_delta_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio=0.01 );
+	std::string* serialize_weights_delta_to_onnx_string( Net *net, int compression, float topk_ratio=0.01 );
+
 #if defined(cPROTO)
-	map<string, vector<Tensor*> > get_tensors_from_onnx(onnx::ModelProto model);
+	map<string, vector<Tensor*> > get_tensors_from_onnx(const onnx::ModelProto &model);
 #endif
 
 
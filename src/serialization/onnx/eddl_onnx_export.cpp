@@ -1,5 +1,9 @@
 #include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
 #include <fstream>
+#include <algorithm>
 #include "eddl/serialization/onnx/eddl_onnx.h"
 
 using namespace std;
@@ -26,6 +30,14 @@ using namespace std;
 
 	void build_gemm_node( LDense *layer, onnx::GraphProto *graph, bool gradients );
 
+	void set_conv_attributes( LConv *layer, onnx::NodeProto *node );
+
+	void set_conv_kernel_dims( LConv *layer, onnx::TensorProto *t );
+
+	void build_qlinear_conv_node( LConv *layer, onnx::GraphProto *graph );
+
+	void build_qlinear_matmul_node( LDense *layer, onnx::GraphProto *graph );
+
 	void build_maxpool_node( LMaxPool *layer, onnx::GraphProto *graph );
 
 	void build_averagepool_node( LAveragePool *layer, onnx::GraphProto *graph );
@@ -83,12 +95,63 @@ using namespace std;
 
 #ifdef cPROTO
 
-	void save_net_to_onnx_file( Net *net, string path ) {
+	// External data: while a model is being saved with external_data=true, the float
+	// initializers are streamed from the layer tensors to a side file instead of being
+	// copied into the proto (keeps the proto small and below the protobuf 2GB limit)
+	#define EXTERNAL_DATA_MIN_BYTES 1024
+
+	struct ExternalDataWriter {
+		ofstream ofs;
+		string location; // Relative to the model file
+		size_t offset;
+	};
+
+	static ExternalDataWriter *external_writer = nullptr;
+
+	void set_float_data( onnx::TensorProto *tensor, const float *ptr, size_t size ) {
+		size_t bytes = sizeof(float) * size;
+		if ( external_writer == nullptr || bytes < EXTERNAL_DATA_MIN_BYTES ) {
+			tensor->mutable_float_data()->Add( ptr, ptr + size );
+			return;
+		}
+
+		external_writer->ofs.write( reinterpret_cast<const char*>(ptr), bytes );
+		tensor->set_data_location( onnx::TensorProto::EXTERNAL );
+		onnx::StringStringEntryProto* entry = tensor->add_external_data();
+		entry->set_key( "location" );
+		entry->set_value( external_writer->location );
+		entry = tensor->add_external_data();
+		entry->set_key( "offset" );
+		entry->set_value( to_string( external_writer->offset ) );
+		entry = tensor->add_external_data();
+		entry->set_key( "length" );
+		entry->set_value( to_string( bytes ) );
+		external_writer->offset += bytes;
+	}
+
+	void save_net_to_onnx_file( Net *net, string path, bool external_data ) {
 		// Builds all the model in onnx from the Net object
 		if (net->snets[0]->dev!=DEV_CPU)
 			net->sync_weights();
 		bool export_gradients = false; // We always store weights to file
+
+		// Weights go to "<path>.data", next to the model
+		ExternalDataWriter writer;
+		if ( external_data ) {
+			string data_path = path + ".data";
+			size_t sep = data_path.find_last_of( "/\\" );
+			writer.location = ( sep == string::npos ) ? data_path : data_path.substr( sep + 1 );
+			writer.offset = 0;
+			writer.ofs.open( data_path, ios::out | ios::binary );
+			if ( !writer.ofs.good() ) {
+				cerr << "Failed to create the external data file " << data_path << endl;
+				return;
+			}
+			external_writer = &writer;
+		}
 		onnx::ModelProto model = build_onnx_model( net , export_gradients );
+		external_writer = nullptr;
+
 		// Create the file stream and save the serialization of the onnx model in it
 		fstream ofs( path, ios::out | ios::binary );
     	if ( !model.SerializeToOstream( &ofs ) ) { // The serialization is automated by the protobuf library
@@ -193,11 +256,17 @@ using namespace std;
 	    } 
 		else if ( LConv* t = dynamic_cast<LConv*>( layer ) ) 
 		{
-	    	build_conv_node( (LConv*)(LinLayer*)layer, graph, gradients );
+			if ( !gradients && t->qd != nullptr && t->qd->quantized )
+				build_qlinear_conv_node( (LConv*)(LinLayer*)layer, graph );
+			else
+				build_conv_node( (LConv*)(LinLayer*)layer, graph, gradients );
 	    } 
 		else if ( LDense *t = dynamic_cast<LDense*>( layer ) ) 
 		{
-	    	build_gemm_node( (LDense*)(LinLayer*)layer, graph, gradients );
+			if ( !gradients && t->qd != nullptr && t->qd->quantized )
+				build_qlinear_matmul_node( (LDense*)(LinLayer*)layer, graph );
+			else
+				build_gemm_node( (LDense*)(LinLayer*)layer, graph, gradients );
 	    } 
 		else if ( LMaxPool *t = dynamic_cast<LMaxPool*>( layer ) ) 
 		{
@@ -327,55 +396,69 @@ using namespace std;
 	// Node builders
 	//----------------------------------------------------------------------------------------
 
-	void build_conv_node( LConv *layer, onnx::GraphProto *graph, bool gradients ) {
-		// Add an empty node to the graph
-		onnx::NodeProto* node = graph->add_node();
-		node->set_op_type( "Conv" );
-		node->set_name( layer->name );
-		// Set the inputs of the node from the parents of the layer
-		for ( Layer* parentl : layer->parent ) {
-			node->add_input( parentl->name );
-		}
-		// Set the input params names of the conv op
-		node->add_input( layer->name + "_W" );
-		node->add_input( layer->name + "_b" );
-		// Set the name of the output of the node to link with other nodes
-		node->add_output( layer->name );
-
+	void set_conv_attributes( LConv *layer, onnx::NodeProto *node ) {
+		// 1D convolutions (3D input) only have the cols axis
+		bool conv1D = layer->input->ndim == 3;
 		////////////////////////// Attributes of the Conv operation //////////////////////////////////
 		// Attr dilations
 		onnx::AttributeProto* conv_dilations = node->add_attribute();
 		conv_dilations->set_name( "dilations" );
 		conv_dilations->set_type( onnx::AttributeProto::INTS );
-		vector<int> vdilations {1, 1}; // ?? Tenemos esto en EDDL
-		for ( int i : vdilations ) {
-			conv_dilations->add_ints( i );
-		}
+		if ( !conv1D ) conv_dilations->add_ints( layer->cd->dr );
+		conv_dilations->add_ints( layer->cd->dc );
 		//Attr group
 		onnx::AttributeProto* conv_group = node->add_attribute();
 		conv_group->set_name( "group" );
 		conv_group->set_type( onnx::AttributeProto::INT );
-		conv_group->set_i( 1 ); // ????????????????????????????????????????????????????
+		conv_group->set_i( layer->cd->groups );
 		// Attr kernel_shape
 		onnx::AttributeProto* conv_kernel_shape = node->add_attribute();
 		conv_kernel_shape->set_name( "kernel_shape" );
 		conv_kernel_shape->set_type( onnx::AttributeProto::INTS );
-		conv_kernel_shape->add_ints( layer->cd->kr );
+		if ( !conv1D ) conv_kernel_shape->add_ints( layer->cd->kr );
 		conv_kernel_shape->add_ints( layer->cd->kc );
 		// Attr pads
 		onnx::AttributeProto* conv_pads = node->add_attribute();
 		conv_pads->set_name( "pads" );
 		conv_pads->set_type( onnx::AttributeProto::INTS );
-		conv_pads->add_ints( layer->cd->padrt );
+		if ( !conv1D ) conv_pads->add_ints( layer->cd->padrt );
 		conv_pads->add_ints( layer->cd->padcl );
-		conv_pads->add_ints( layer->cd->padrb );
+		if ( !conv1D ) conv_pads->add_ints( layer->cd->padrb );
 		conv_pads->add_ints( layer->cd->padcr );
 		// Attr strides
 		onnx::AttributeProto* conv_strides = node->add_attribute();
 		conv_strides->set_name( "strides" );
 		conv_strides->set_type( onnx::AttributeProto::INTS );
-		conv_strides->add_ints( layer->cd->sr );
+		if ( !conv1D ) conv_strides->add_ints( layer->cd->sr );
 		conv_strides->add_ints( layer->cd->sc );
+	}
+
+	void set_conv_kernel_dims( LConv *layer, onnx::TensorProto *t ) {
+		// K is (nk x kz x kr x kc), 1D convolutions drop the single row
+		const vector<int> &shape = layer->cd->K->shape;
+		for ( int i = 0; i < shape.size(); i++ ) {
+			if ( i == 2 && layer->input->ndim == 3 ) continue;
+			t->add_dims( shape[i] );
+		}
+	}
+
+	void build_conv_node( LConv *layer, onnx::GraphProto *graph, bool gradients ) {
+		// Add an empty node to the graph
+		onnx::NodeProto* node = graph->add_node();
+		node->set_op_type( "Conv" );
+		node->set_name( layer->name );
+		// Set the inputs of the node from the parents of the layer
+		for ( Layer* parentl : layer->parent ) {
+			node->add_input( parentl->name );
+		}
+		// Set the input params names of the conv op
+		node->add_input( layer->name + "_W" );
+		node->add_input( layer->name + "_b" );
+		// Set the name of the output of the node to link with other nodes
+		node->add_output( layer->name );
+
+		// Attributes of the Conv operation
+		set_conv_attributes( layer, node );
 
 		// Check if we are exporting weights or accumulated gradients 
 		if ( !gradients ) {
@@ -383,30 +466,30 @@ using namespace std;
 			onnx::TensorProto* conv_w = graph->add_initializer();
 			conv_w->set_name( layer->name + "_W" );
 			conv_w->set_data_type( onnx::TensorProto::FLOAT );	
-			conv_w->mutable_dims()->Add( layer->cd->K->shape.begin(), layer->cd->K->shape.end() ); // Set the shape of the weights
-			conv_w->mutable_float_data()->Add( layer->cd->K->ptr, layer->cd->K->ptr + layer->cd->K->size ); // Set the weights values
+			set_conv_kernel_dims( layer, conv_w ); // Set the shape of the weights
+			set_float_data( conv_w, layer->cd->K->ptr, layer->cd->K->size ); // Set the weights values
 			//conv_w->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->cd->K->ptr), sizeof(float) * layer->cd->K->size );
 			// Bias input
 			onnx::TensorProto* conv_b = graph->add_initializer();
 			conv_b->set_name( layer->name + "_b" );
 			conv_b->set_data_type( onnx::TensorProto::FLOAT );	
 			conv_b->mutable_dims()->Add( layer->cd->bias->shape.begin(), layer->cd->bias->shape.end() ); // Set the shape of the bias
-			conv_b->mutable_float_data()->Add( layer->cd->bias->ptr, layer->cd->bias->ptr + layer->cd->bias->size); // Set the bias values
+			set_float_data( conv_b, layer->cd->bias->ptr, layer->cd->bias->size ); // Set the bias values
 			//conv_b->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->cd->bias->ptr), sizeof(float) * layer->cd->bias->size );
 		} else {
 			// Accumulated gradients (Weights) input
 			onnx::TensorProto* conv_w = graph->add_initializer();
 			conv_w->set_name( layer->name + "_W" );
 			conv_w->set_data_type( onnx::TensorProto::FLOAT );	
-			conv_w->mutable_dims()->Add( layer->cd->acc_gK->shape.begin(), layer->cd->acc_gK->shape.end() ); // Set the accumulated gradiens shape (weights)
-			conv_w->mutable_float_data()->Add( layer->cd->acc_gK->ptr, layer->cd->acc_gK->ptr + layer->cd->acc_gK->size ); // Set the accumulated gradients values (weights) 
+			set_conv_kernel_dims( layer, conv_w ); // Set the accumulated gradiens shape (weights)
+			set_float_data( conv_w, layer->cd->acc_gK->ptr, layer->cd->acc_gK->size ); // Set the accumulated gradients values (weights) 
 			//conv_w->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->cd->acc_gK->ptr), sizeof(float) * layer->cd->acc_gK->size );
 			// Accumulated gradients (bias) input
 			onnx::TensorProto* conv_b = graph->add_initializer();
 			conv_b->set_name( layer->name + "_b" );
 			conv_b->set_data_type( onnx::TensorProto::FLOAT );	
 			conv_b->mutable_dims()->Add( layer->cd->acc_gbias->shape.begin(), layer->cd->acc_gbias->shape.end() ); // Set the accumulated gradients shape (bias)
-			conv_b->mutable_float_data()->Add( layer->cd->acc_gbias->ptr, layer->cd->acc_gbias->ptr + layer->cd->acc_gbias->size); // Set the accumulated gradients values (bias)
+			set_float_data( conv_b, layer->cd->acc_gbias->ptr, layer->cd->acc_gbias->size ); // Set the accumulated gradients values (bias)
 			//conv_b->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->cd->acc_gbias->ptr), sizeof(float) * layer->cd->acc_gbias->size );
 		}
 	}
@@ -454,7 +537,7 @@ using namespace std;
 			weight->set_name( layer->name + "_W" );
 			weight->set_data_type( onnx::TensorProto::FLOAT );	
 			weight->mutable_dims()->Add( layer->W->shape.begin(), layer->W->shape.end() ); // Set the shape of the weights
-			weight->mutable_float_data()->Add( layer->W->ptr, layer->W->ptr + layer->W->size ); // Set the weights values
+			set_float_data( weight, layer->W->ptr, layer->W->size ); // Set the weights values
 			//weight->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->W->ptr), sizeof(float) * layer->W->size );
 			if ( layer->use_bias ) {
 				// Bias input
@@ -462,7 +545,7 @@ using namespace std;
 				bias->set_name( layer->name + "_b" );
 				bias->set_data_type( onnx::TensorProto::FLOAT );	
 				bias->mutable_dims()->Add( layer->bias->shape.begin(), layer->bias->shape.end() ); // Set the bias shape
-				bias->mutable_float_data()->Add( layer->bias->ptr, layer->bias->ptr + layer->bias->size ); // Set the bias values
+				set_float_data( bias, layer->bias->ptr, layer->bias->size ); // Set the bias values
 				//bias->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->bias->ptr), sizeof(float) * layer->bias->size );
 			}		
 		} else {
@@ -471,7 +554,7 @@ using namespace std;
 			weight->set_name( layer->name + "_W" );
 			weight->set_data_type( onnx::TensorProto::FLOAT );	
 			weight->mutable_dims()->Add( layer->acc_gW->shape.begin(), layer->acc_gW->shape.end() ); // Set the accumulated gradients shape (weights)
-			weight->mutable_float_data()->Add( layer->acc_gW->ptr, layer->acc_gW->ptr + layer->acc_gW->size ); // Set the accumulated gradients values (weights)
+			set_float_data( weight, layer->acc_gW->ptr, layer->acc_gW->size ); // Set the accumulated gradients values (weights)
 			//weight->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->acc_gW->ptr), sizeof(float) * layer->acc_gW->size );
 
 			// Check if we are using bias 
@@ -481,12 +564,131 @@ using namespace std;
 				bias->set_name( layer->name + "_b" );
 				bias->set_data_type( onnx::TensorProto::FLOAT );	
 				bias->mutable_dims()->Add( layer->acc_gbias->shape.begin(), layer->acc_gbias->shape.end() ); // Set the accumulated gradients shape (bias)
-				bias->mutable_float_data()->Add( layer->acc_gbias->ptr, layer->acc_gbias->ptr + layer->acc_gbias->size ); // Set the accumulated gradients values (bias)
+				set_float_data( bias, layer->acc_gbias->ptr, layer->acc_gbias->size ); // Set the accumulated gradients values (bias)
 				//bias->mutable_raw_data()->assign( reinterpret_cast<const char*>(layer->acc_gbias->ptr), sizeof(float) * layer->acc_gbias->size );
 			}
 		}
 	}
 
+	// Adds the scale (float) and zero point initializers of a quantized tensor
+	void add_quant_params( onnx::GraphProto *graph, string name, vector<float> scale, vector<int> zero, int zero_type ) {
+		onnx::TensorProto* t_scale = graph->add_initializer();
+		t_scale->set_name( name + "_scale" );
+		t_scale->set_data_type( onnx::TensorProto::FLOAT );
+		if ( scale.size() > 1 ) t_scale->add_dims( scale.size() ); // Per channel (1-D), else scalar
+		t_scale->mutable_float_data()->Add( scale.begin(), scale.end() );
+
+		onnx::TensorProto* t_zero = graph->add_initializer();
+		t_zero->set_name( name + "_zero_point" );
+		t_zero->set_data_type( zero_type );
+		if ( zero.size() > 1 ) t_zero->add_dims( zero.size() );
+		t_zero->mutable_int32_data()->Add( zero.begin(), zero.end() ); // (u)int8 values are stored as int32
+	}
+
+	// QuantizeLinear (input) -> op -> DequantizeLinear (output), returns the op node
+	onnx::NodeProto* build_qlinear_nodes( Layer *layer, QuantDescriptor *qd, string op_type, string output, onnx::GraphProto *graph ) {
+		string x = layer->name + "_x";
+		string y = layer->name + "_y";
+		add_quant_params( graph, x, {qd->in_scale}, {qd->in_zero}, onnx::TensorProto::UINT8 );
+		add_quant_params( graph, y, {qd->out_scale}, {qd->out_zero}, onnx::TensorProto::UINT8 );
+		vector<int> w_zero( qd->per_channel ? qd->channels : 1, 0 );
+		vector<float> w_scale( qd->w_scale.begin(), qd->per_channel ? qd->w_scale.end() : qd->w_scale.begin() + 1 );
+		add_quant_params( graph, layer->name + "_W", w_scale, w_zero, onnx::TensorProto::INT8 );
+
+		onnx::NodeProto* quant = graph->add_node();
+		quant->set_op_type( "QuantizeLinear" );
+		quant->set_name( x + "_quantize" );
+		quant->add_input( layer->parent[0]->name );
+		quant->add_input( x + "_scale" );
+		quant->add_input( x + "_zero_point" );
+		quant->add_output( x + "_quantized" );
+
+		onnx::NodeProto* node = graph->add_node();
+		node->set_op_type( op_type );
+		node->set_name( layer->name );
+		node->add_input( x + "_quantized" );
+		node->add_input( x + "_scale" );
+		node->add_input( x + "_zero_point" );
+		node->add_input( layer->name + "_W" );
+		node->add_input( layer->name + "_W_scale" );
+		node->add_input( layer->name + "_W_zero_point" );
+		node->add_input( y + "_scale" );
+		node->add_input( y + "_zero_point" );
+		node->add_output( y + "_quantized" );
+
+		onnx::NodeProto* dequant = graph->add_node();
+		dequant->set_op_type( "DequantizeLinear" );
+		dequant->set_name( y + "_dequantize" );
+		dequant->add_input( y + "_quantized" );
+		dequant->add_input( y + "_scale" );
+		dequant->add_input( y + "_zero_point" );
+		dequant->add_output( output );
+
+		return node;
+	}
+
+	void build_qlinear_conv_node( LConv *layer, onnx::GraphProto *graph ) {
+		QuantDescriptor *qd = layer->qd;
+		onnx::NodeProto* node = build_qlinear_nodes( layer, qd, "QLinearConv", layer->name, graph );
+		set_conv_attributes( layer, node );
+
+		// Int8 filters, same layout as the float ones
+		onnx::TensorProto* conv_w = graph->add_initializer();
+		conv_w->set_name( layer->name + "_W" );
+		conv_w->set_data_type( onnx::TensorProto::INT8 );
+		set_conv_kernel_dims( layer, conv_w );
+		for ( int n = 0; n < qd->channels; n++ ) {
+			for ( int k = 0; k < qd->ksize; k++ ) {
+				conv_w->add_int32_data( qd->weight( n, k ) );
+			}
+		}
+
+		// Int32 bias with scale x_scale * w_scale
+		if ( layer->cd->use_bias ) {
+			node->add_input( layer->name + "_b" );
+			onnx::TensorProto* conv_b = graph->add_initializer();
+			conv_b->set_name( layer->name + "_b" );
+			conv_b->set_data_type( onnx::TensorProto::INT32 );
+			conv_b->add_dims( qd->channels );
+			for ( int n = 0; n < qd->channels; n++ ) {
+				conv_b->add_int32_data( (int)round( layer->cd->bias->ptr[n] / (qd->in_scale * qd->w_scale[n]) ) );
+			}
+		}
+	}
+
+	void build_qlinear_matmul_node( LDense *layer, onnx::GraphProto *graph ) {
+		QuantDescriptor *qd = layer->qd;
+		// QLinearMatMul has no bias, it is added after the dequantization
+		string output = layer->use_bias ? layer->name + "_matmul" : layer->name;
+		build_qlinear_nodes( layer, qd, "QLinearMatMul", output, graph );
+
+		// Int8 weights (in x ndim), packed channel-major in the descriptor
+		onnx::TensorProto* weight = graph->add_initializer();
+		weight->set_name( layer->name + "_W" );
+		weight->set_data_type( onnx::TensorProto::INT8 );
+		weight->mutable_dims()->Add( layer->W->shape.begin(), layer->W->shape.end() );
+		for ( int k = 0; k < qd->ksize; k++ ) {
+			for ( int n = 0; n < qd->channels; n++ ) {
+				weight->add_int32_data( qd->weight( n, k ) );
+			}
+		}
+
+		if ( layer->use_bias ) {
+			onnx::NodeProto* node = graph->add_node();
+			node->set_op_type( "Add" );
+			node->set_name( layer->name + "_bias" );
+			node->add_input( output );
+			node->add_input( layer->name + "_b" );
+			node->add_output( layer->name );
+
+			onnx::TensorProto* bias = graph->add_initializer();
+			bias->set_name( layer->name + "_b" );
+			bias->set_data_type( onnx::TensorProto::FLOAT );
+			bias->mutable_dims()->Add( layer->bias->shape.begin(), layer->bias->shape.end() );
+			set_float_data( bias, layer->bias->ptr, layer->bias->size );
+		}
+	}
+
 	void build_maxpool_node( LMaxPool *layer, onnx::GraphProto *graph ) {
 		// Add an empty node to the graph
 		onnx::NodeProto* node = graph->add_node();
@@ -499,26 +701,28 @@ using namespace std;
 		// Set the name of the output of the node to link with other nodes
 		node->add_output( layer->name );
 
+		// 1D pooling (3D input) only has the cols axis
+		bool pool1D = layer->input->ndim == 3;
+
 		// Attr kernel_shape
 		onnx::AttributeProto* max_pool_ks = node->add_attribute();
 		max_pool_ks->set_name( "kernel_shape" );
 		max_pool_ks->set_type( onnx::AttributeProto::INTS );
-		for ( int i : layer->pd->ksize ) {
-			max_pool_ks->add_ints( i );
-		}
+		if ( !pool1D ) max_pool_ks->add_ints( layer->pd->kr );
+		max_pool_ks->add_ints( layer->pd->kc );
 		// Attr pads
 		onnx::AttributeProto* max_pool_pads = node->add_attribute();
 		max_pool_pads->set_name( "pads" );
 		max_pool_pads->set_type( onnx::AttributeProto::INTS );
-		max_pool_pads->add_ints( layer->pd->padrt );
+		if ( !pool1D ) max_pool_pads->add_ints( layer->pd->padrt );
 		max_pool_pads->add_ints( layer->pd->padcl );
-		max_pool_pads->add_ints( layer->pd->padrb );
+		if ( !pool1D ) max_pool_pads->add_ints( layer->pd->padrb );
 		max_pool_pads->add_ints( layer->pd->padcr );
 		// Attr strides
 		onnx::AttributeProto* max_pool_strides = node->add_attribute();
 		max_pool_strides->set_name( "strides" );
 		max_pool_strides->set_type( onnx::AttributeProto::INTS );
-		max_pool_strides->add_ints( layer->pd->sr );
+		if ( !pool1D ) max_pool_strides->add_ints( layer->pd->sr );
 		max_pool_strides->add_ints( layer->pd->sc );
 	}
 
@@ -974,14 +1178,14 @@ using namespace std;
 		mean->set_name( layer->name + "_mean" );
 		mean->set_data_type( onnx::TensorProto::FLOAT );	
 		mean->add_dims( n_features );
-		mean->mutable_float_data()->Add( layer->mean->ptr, layer->mean->ptr + layer->mean->size ); // Set the mean values
+		set_float_data( mean, layer->mean->ptr, layer->mean->size ); // Set the mean values
 
 		// variance input
 		onnx::TensorProto* variance = graph->add_initializer();
 		variance->set_name( layer->name + "_variance" );
 		variance->set_data_type( onnx::TensorProto::FLOAT );	
 		variance->add_dims( n_features );
-		variance->mutable_float_data()->Add( layer->variance->ptr, layer->variance->ptr + layer->variance->size ); // Set the mean values
+		set_float_data( variance, layer->variance->ptr, layer->variance->size ); // Set the mean values
 	}
 
 	void build_dropout_node( LDropout *layer, onnx::GraphProto *graph ) {
@@ -1041,10 +1245,182 @@ using namespace std;
 	// End: Node builders
 	//----------------------------------------------------------------------------------------
 
+	// Compressed exchange (distributed module)
+	//----------------------------------------------------------------------------------------
+
+	// Writes v compressed into the initializer t. On return v holds the compression error
+	// (v - decompressed values). Returns true if t has been replaced by a sparse initializer
+	bool compress_values( onnx::GraphProto *graph, onnx::TensorProto *t, vector<float> &v, int compression, float topk_ratio ) {
+		size_t n = v.size();
+		t->clear_float_data();
+
+		if ( compression == COMPRESS_NONE ) {
+			t->mutable_float_data()->Add( v.begin(), v.end() );
+			std::fill( v.begin(), v.end(), 0.0f );
+			return false;
+		}
+		else if ( compression == COMPRESS_BF16 ) {
+			string raw( 2 * n, '\0' );
+			for ( size_t i = 0; i < n; i++ ) {
+				uint32_t bits;
+				memcpy( &bits, &v[i], sizeof(float) );
+				bits += 0x7fff + ( (bits >> 16) & 1 ); // Round to nearest even
+				uint16_t h = (uint16_t)( bits >> 16 );
+				memcpy( &raw[2 * i], &h, sizeof(uint16_t) );
+
+				bits = (uint32_t)h << 16;
+				float sent;
+				memcpy( &sent, &bits, sizeof(float) );
+				v[i] -= sent;
+			}
+			t->set_data_type( onnx::TensorProto::BFLOAT16 );
+			t->set_raw_data( raw );
+			return false;
+		}
+		else if ( compression == COMPRESS_INT8 ) {
+			float amax = 0.0f;
+			for ( size_t i = 0; i < n; i++ ) amax = std::max( amax, std::fabs( v[i] ) );
+			float scale = ( amax > 0.0f ) ? amax / 127.0f : 1.0f;
+
+			string raw( n, '\0' );
+			for ( size_t i = 0; i < n; i++ ) {
+				int q = (int)std::round( v[i] / scale );
+				q = std::max( -127, std::min( 127, q ) );
+				raw[i] = (char)(int8_t)q;
+				v[i] -= q * scale;
+			}
+			t->set_data_type( onnx::TensorProto::INT8 );
+			t->set_raw_data( raw );
+
+			onnx::TensorProto* t_scale = graph->add_initializer();
+			t_scale->set_name( t->name() + ":scale" );
+			t_scale->set_data_type( onnx::TensorProto::FLOAT );
+			t_scale->add_float_data( scale );
+			return false;
+		}
+		else if ( compression == COMPRESS_TOPK ) {
+			size_t k = std::max( (size_t)1, (size_t)( topk_ratio * n ) );
+			k = std::min( k, n );
+
+			// Magnitude of the k-th largest value
+			vector<float> mag( n );
+			for ( size_t i = 0; i < n; i++ ) mag[i] = std::fabs( v[i] );
+			std::nth_element( mag.begin(), mag.begin() + ( n - k ), mag.end() );
+			float threshold = mag[n - k];
+
+			onnx::SparseTensorProto* sparse = graph->add_sparse_initializer();
+			sparse->mutable_dims()->CopyFrom( t->dims() );
+			onnx::TensorProto* values = sparse->mutable_values();
+			onnx::TensorProto* indices = sparse->mutable_indices();
+			values->set_name( t->name() );
+			values->set_data_type( onnx::TensorProto::FLOAT );
+			indices->set_data_type( onnx::TensorProto::INT64 ); // Linearized indices
+			for ( size_t i = 0; i < n && (size_t)values->float_data_size() < k; i++ ) {
+				if ( std::fabs( v[i] ) >= threshold && v[i] != 0.0f ) {
+					values->add_float_data( v[i] );
+					indices->add_int64_data( i );
+					v[i] = 0.0f;
+				}
+			}
+			values->add_dims( values->float_data_size() );
+			indices->add_dims( indices->int64_data_size() );
+			return true;
+		}
+
+		msg( "Unknown compression", "ONNX::compress_values" );
+		return false;
+	}
+
+	onnx::ModelProto build_compressed_onnx_model( Net *net, bool weights_delta, int compression, float topk_ratio ) {
+		if (net->snets[0]->dev!=DEV_CPU)
+			net->sync_weights();
+		onnx::ModelProto model = build_onnx_model( net, !weights_delta );
+		onnx::GraphProto* graph = model.mutable_graph();
+
+		map<string, int> init_index;
+		for ( int i = 0; i < graph->initializer_size(); i++ ) init_index[graph->initializer(i).name()] = i;
+
+		vector<int> sparse_inits;
+		for ( Layer* l : net->layers ) {
+			// Same layers as in apply_grads_from_onnx
+			if ( !dynamic_cast<LConv*>( l ) && !dynamic_cast<LDense*>( l ) ) continue;
+
+			vector<Tensor*> &src = weights_delta ? l->params : l->acc_gradients;
+			for ( int j = 0; j < src.size(); j++ ) {
+				string name = l->name + ( j == 0 ? "_W" : "_b" );
+				if ( !init_index.count( name ) ) continue;
+
+				Tensor* x = src[j];
+				vector<float> v( x->ptr, x->ptr + x->size );
+				Tensor* state;
+				if ( weights_delta ) { // v = params - params seen by the others
+					if ( l->sync_params.size() <= j ) l->sync_params.push_back( x->clone() );
+					state = l->sync_params[j];
+					for ( int i = 0; i < x->size; i++ ) v[i] -= state->ptr[i];
+				}
+				else { // v = gradients + error of the previous exchange
+					if ( l->comp_residuals.size() <= j ) l->comp_residuals.push_back( Tensor::zeros( x->shape ) );
+					state = l->comp_residuals[j];
+					for ( int i = 0; i < x->size; i++ ) v[i] += state->ptr[i];
+				}
+
+				vector<float> err( v );
+				if ( compress_values( graph, graph->mutable_initializer( init_index[name] ), err, compression, topk_ratio ) )
+					sparse_inits.push_back( init_index[name] );
+
+				if ( weights_delta ) for ( int i = 0; i < x->size; i++ ) state->ptr[i] += v[i] - err[i];
+				else std::copy( err.begin(), err.end(), state->ptr );
+			}
+		}
+
+		// Remove the dense copies of the sparse initializers
+		std::sort( sparse_inits.rbegin(), sparse_inits.rend() );
+		for ( int i : sparse_inits ) graph->mutable_initializer()->DeleteSubrange( i, 1 );
+
+		return model;
+	}
+
+	size_t serialize_compressed( onnx::ModelProto &model, void * & serialized_model ) {
+		size_t size = model.ByteSizeLong();
+		serialized_model = new char [ size ];
+		if ( ! model.SerializeToArray( serialized_model, size ) ) {
+			cerr << "Failed to serialize the model in onnx into the buffer." << endl;
+		}
+		return size;
+	}
+
+	size_t serialize_grads_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio ) {
+		onnx::ModelProto model = build_compressed_onnx_model( net, false, compression, topk_ratio );
+		return serialize_compressed( model, serialized_model );
+	}
+
+	string* serialize_grads_to_onnx_string( Net *net, int compression, float topk_ratio ) {
+		onnx::ModelProto model = build_compressed_onnx_model( net, false, compression, topk_ratio );
+		string * model_string = new string();
+		if ( ! model.SerializeToString(model_string) ) {
+			cerr << "Failed to serialize the model in onnx into a string ." << endl;
+		}
+		return model_string;
+	}
+
+	size_t serialize_weights_delta_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio ) {
+		onnx::ModelProto model = build_compressed_onnx_model( net, true, compression, topk_ratio );
+		return serialize_compressed( model, serialized_model );
+	}
+
+	string* serialize_weights_delta_to_onnx_string( Net *net, int compression, float topk_ratio ) {
+		onnx::ModelProto model = build_compressed_onnx_model( net, true, compression, topk_ratio );
+		string * model_string = new string();
+		if ( ! model.SerializeToString(model_string) ) {
+			cerr << "Failed to serialize the model in onnx into a string ." << endl;
+		}
+		return model_string;
+	}
+
 	// End: Exporting Module
 	//----------------------------------------------------------------------------------------
 #else
-	void save_net_to_onnx_file( Net *net, string path ){
+	void save_net_to_onnx_file( Net *net, string path, bool external_data ){
 		cerr << "Not compiled for ONNX. Missing Protobuf" << endl;
 	}
 
@@ -1058,4 +1434,24 @@ using namespace std;
 		return nullptr;
 	}
 
+	size_t serialize_grads_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio ){
+		cerr << "Not compiled for ONNX. Missing Protobuf. Returning -1" << endl;
+		return -1;
+	}
+
+	std::string* serialize_grads_to_onnx_string( Net *net, int compression, float topk_ratio ){
+		cerr << "Not compiled for ONNX. Missing Protobuf. Returning nullptr" << endl;
+		return nullptr;
+	}
+
+	size_t serialize_weights_delta_to_onnx_pointer( Net *net, void * & serialized_model, int compression, float topk_ratio ){
+		cerr << "Not compiled for ONNX. Missing Protobuf. Returning -1" << endl;
+		return -1;
+	}
+
+	std::string* serialize_weights_delta_to_onnx_string( Net *net, int compression, float topk_ratio ){
+		cerr << "Not compiled for ONNX. Missing Protobuf. Returning nullptr" << endl;
+		return nullptr;
+	}
+
 #endif //cPROTO
@@ -8,6 +8,12 @@
 #include <map>
 #include <set>
 #include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #define NEW_FROM_VECTOR_PTR(v) (copy((v)->begin(), (v)->end(), new float[(v)->size()]) - (v)->size())
 std::vector<int> vf2vi(const std::vector<float>& vf)
@@ -25,11 +31,11 @@ std::vector<int> vf2vi(const std::vector<float>& vf)
 #endif
 
 #if defined(cPROTO)
-	Net* build_net_onnx(onnx::ModelProto model, int mem);
+	Net* build_net_onnx(const onnx::ModelProto &model, int mem, string base_dir="");
 #endif
 
 #if defined(cPROTO)
-	map<string, vector<Tensor*> > get_tensors_from_onnx(onnx::ModelProto model);
+	map<string, vector<Tensor*> > get_tensors_from_onnx(const onnx::ModelProto &model);
 #endif
 
 
@@ -82,8 +88,40 @@ using namespace std;
 
 
 	int verbose=0;
+
+	// Memory maps the files referenced by the initializers stored as external data.
+	// Each file is mapped once and unmapped when the import finishes
+	class ExternalDataReader {
+	public:
+		string base_dir;
+		map<string, pair<char*, size_t> > files;
+
+		explicit ExternalDataReader(string base_dir) : base_dir(base_dir) {}
+
+		~ExternalDataReader() {
+			for (auto &f : files) munmap(f.second.first, f.second.second);
+		}
+
+		const char* get(const string &location, size_t offset, size_t length) {
+			if (!files.count(location)) {
+				string path = base_dir + location;
+				int fd = open(path.c_str(), O_RDONLY);
+				if (fd < 0) msg("External data file not found: " + path, "ONNX::ImportNet");
+				struct stat st;
+				fstat(fd, &st);
+				void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				close(fd);
+				if (ptr == MAP_FAILED) msg("Failed to map external data file: " + path, "ONNX::ImportNet");
+				files[location] = make_pair((char*)ptr, (size_t)st.st_size);
+			}
+			pair<char*, size_t> &f = files[location];
+			if (offset + length > f.second) msg("External data out of bounds: " + location, "ONNX::ImportNet");
+			return f.first + offset;
+		}
+	};
+
 	//Gets the initializers from the onnx layer graph
-	vector<onnx::TensorProto> get_initializers(onnx::GraphProto graph) {
+	vector<onnx::TensorProto> get_initializers(const onnx::GraphProto &graph) {
 		vector<onnx::TensorProto> initializers;
 		for(int i = 0; i < graph.initializer_size(); i++) initializers.push_back(graph.initializer(i));
 		return initializers;
@@ -203,10 +241,40 @@ using namespace std;
 		return true;
 	}
 
+	//Reads the values of a float tensor stored as external data (mmapped)
+	bool TryReadingExternalValues( const onnx::TensorProto& t, ExternalDataReader *reader, vector<float> &values ) {
+		string location;
+		size_t offset = 0;
+		size_t length = 0;
+		for (int i = 0; i < t.external_data_size(); i++) {
+			const onnx::StringStringEntryProto &entry = t.external_data(i);
+			if (entry.key() == "location") location = entry.value();
+			else if (entry.key() == "offset") offset = stoull(entry.value());
+			else if (entry.key() == "length") length = stoull(entry.value());
+		}
+		if (length == 0) { // Whole tensor
+			length = sizeof(float);
+			for (int i = 0; i < t.dims_size(); i++) length *= t.dims(i);
+		}
+		if (reader == nullptr || location.empty() || t.data_type() != onnx::TensorProto::FLOAT) {
+			cerr << "External data not supported for tensor " << t.name() << endl;
+			return false;
+		}
+
+		const char *src = reader->get(location, offset, length);
+		values.resize(length / sizeof(float));
+		memcpy(values.data(), src, length);
+		return true;
+	}
+
 	//Parses the values of the onnx tensor to a c++ vector of that type
-	vector<float> parseTensorValues(onnx::TensorProto t){
+	vector<float> parseTensorValues(const onnx::TensorProto &t, ExternalDataReader *reader=nullptr){
 		int data_type = t.data_type(); //Only works for non raw data for now
 		vector<float> values;
+		if (t.data_location() == onnx::TensorProto::EXTERNAL) {
+			TryReadingExternalValues(t, reader, values);
+			return values;
+		}
 		switch(data_type){
 			case onnx::TensorProto::UNDEFINED:
 				//TODO: Make this
@@ -222,15 +290,29 @@ using namespace std;
 				}
 				break;
 			case onnx::TensorProto::UINT8:
-				//Se puede
-				for(int i = 0; i < t.int32_data_size(); i++){
-					values.push_back(t.int32_data(i));
+				if(t.has_raw_data()){
+					const string &raw = t.raw_data();
+					for(size_t i = 0; i < raw.size(); i++){
+						values.push_back((uint8_t)raw[i]);
+					}
+				}
+				else{
+					for(int i = 0; i < t.int32_data_size(); i++){
+						values.push_back(t.int32_data(i));
+					}
 				}
 				break;
 			case onnx::TensorProto::INT8:
-				//Se puede
-				for(int i = 0; i < t.int32_data_size(); i++){
-					values.push_back(t.int32_data(i));
+				if(t.has_raw_data()){
+					const string &raw = t.raw_data();
+					for(size_t i = 0; i < raw.size(); i++){
+						values.push_back((int8_t)raw[i]);
+					}
+				}
+				else{
+					for(int i = 0; i < t.int32_data_size(); i++){
+						values.push_back(t.int32_data(i));
+					}
 				}
 				break;
 			case onnx::TensorProto::UINT16:
@@ -286,7 +368,24 @@ using namespace std;
 				//TODO: Make this
 				break;
 			case onnx::TensorProto::BFLOAT16:
-				//TODO: Make this
+				// The upper 16 bits of a float32
+				if(t.has_raw_data()){
+					const string &raw = t.raw_data();
+					vector<uint16_t> half(raw.size() / sizeof(uint16_t));
+					memcpy(half.data(), raw.data(), half.size() * sizeof(uint16_t));
+					values.resize(half.size());
+					for(size_t i = 0; i < half.size(); i++){
+						uint32_t bits = (uint32_t)half[i] << 16;
+						memcpy(&values[i], &bits, sizeof(float));
+					}
+				}
+				else{
+					values.resize(t.int32_data_size());
+					for(int i = 0; i < t.int32_data_size(); i++){
+						uint32_t bits = (uint32_t)t.int32_data(i) << 16;
+						memcpy(&values[i], &bits, sizeof(float));
+					}
+				}
 				break;
 
 			default:
@@ -299,25 +398,73 @@ using namespace std;
 	}
 
 	//Creates two maps. Both have the name of the initializer node as key. The values are a vector containing the weights and a vector containing the shape of the vector, respectively.
-	void get_initializers_maps(vector<onnx::TensorProto> tensors, map<string, vector<float> > &values_map, map<string, vector<int> > &dims_map) {
+	void get_initializers_maps(const onnx::GraphProto &graph, map<string, vector<float> > &values_map, map<string, vector<int> > &dims_map, ExternalDataReader *reader=nullptr) {
 
-		for(onnx::TensorProto tensor : tensors){
+		for(const onnx::TensorProto &tensor : graph.initializer()){
 			vector<int> dims;
 			for(int i = 0; i < tensor.dims_size(); i++) {
 				dims.push_back(tensor.dims(i));
 			}
 			string tensorName = tensor.name();
-			vector<float> values = parseTensorValues(tensor);
 
-
-			values_map[tensorName] = values;
+			values_map[tensorName] = parseTensorValues(tensor, reader); // Moved, not copied
 			dims_map[tensorName] = dims;
+		}
+
+		// Sparse initializers (top-k compressed gradients) are densified
+		for(const onnx::SparseTensorProto &sparse : graph.sparse_initializer()){
+			vector<int> dims;
+			size_t size = 1;
+			for(int i = 0; i < sparse.dims_size(); i++) {
+				dims.push_back(sparse.dims(i));
+				size *= sparse.dims(i);
+			}
+			string tensorName = sparse.values().name();
+
+			vector<float> nz_values = parseTensorValues(sparse.values(), reader);
+			const onnx::TensorProto &indices = sparse.indices();
+			if (indices.dims_size() != 1 || indices.int64_data_size() != nz_values.size())
+				msg("Only linear (1-D) int64 indices are supported for " + tensorName, "ONNX::ImportNet");
 
+			vector<float> values(size, 0.0f);
+			for(int i = 0; i < indices.int64_data_size(); i++) {
+				values[indices.int64_data(i)] = nz_values[i];
+			}
+			values_map[tensorName] = std::move(values);
+			dims_map[tensorName] = dims;
+		}
 
+		// Int8 compressed initializers come with their dequantization scale
+		for(auto &entry : values_map){
+			auto scale = values_map.find(entry.first + ":scale");
+			if (scale == values_map.end() || scale->second.empty()) continue;
+			for(float &v : entry.second) v *= scale->second[0];
 		}
 		return;
 	}
 
+	//Copies the initializer values straight into a (CPU) layer param
+	void copy_values_to_tensor(const vector<float> &values, Tensor *t, bool transpose=false) {
+		if (values.size() != t->size) msg("Initializer size does not match with the layer", "ONNX::ImportNet");
+		if (!transpose) {
+			std::copy(values.begin(), values.end(), t->ptr);
+		}
+		else { // Stored as (cols x rows)
+			int rows = t->shape[0];
+			int cols = t->shape[1];
+			for (int c = 0; c < cols; c++)
+				for (int r = 0; r < rows; r++)
+					t->ptr[r * cols + c] = values[c * rows + r];
+		}
+	}
+
+	//ONNX pads are [begin..., end...], the descriptors expect {top, bottom, left, right}
+	vector<int> onnx_pads_to_eddl(const vector<int> &pads) {
+		if (pads.empty()) return {0, 0, 0, 0};
+		if (pads.size() == 2) return {0, 0, pads[0], pads[1]}; // 1D: only cols
+		return {pads[0], pads[2], pads[1], pads[3]};
+	}
+
 	//Parses one TensorProto pointer (Input or output) to eddl Tensor pointer
 	vector<int> parse_IO_tensor(onnx::TypeProto::Tensor tensor) {
 		onnx::TensorShapeProto tensorShape = tensor.shape();
@@ -354,7 +501,7 @@ using namespace std;
 	}
 
 	//Returns a vector with the input names of the net
-	vector<onnx::ValueInfoProto> get_inputs(onnx::GraphProto graph){
+	vector<onnx::ValueInfoProto> get_inputs(const onnx::GraphProto &graph){
 		set<string> input_names;
 		set<string> initializer_names;//We make the substraction of both sets to find the true inputs
 
@@ -362,9 +509,9 @@ using namespace std;
 			input_names.insert(graph.input(i).name());
 		}
 
-		vector<onnx::TensorProto> initializers = get_initializers(graph); for(int i = 0; i < initializers.size(); i++){ //Construct set of initializer names
-			if(initializers[i].has_name())
-				initializer_names.insert(initializers[i].name());
+		for(int i = 0; i < graph.initializer_size(); i++){ //Construct set of initializer names
+			if(graph.initializer(i).has_name())
+				initializer_names.insert(graph.initializer(i).name());
 		}
 
 		vector<string> true_inputs(100);
@@ -383,7 +530,7 @@ using namespace std;
 
 
 	//Returns a vector containing the output names of the net
-	vector<string> get_outputs(onnx::GraphProto graph){
+	vector<string> get_outputs(const onnx::GraphProto &graph){
 		vector<string> output_names;
 
 		for(int i = 0; i < graph.output_size(); i++){ //Construct set of output names
@@ -393,7 +540,7 @@ using namespace std;
 	}
 
 	//Returns a vector containing all nodes of the graph in onnx containers.
-	vector<onnx::NodeProto> get_graph_nodes(onnx::GraphProto graph) {
+	vector<onnx::NodeProto> get_graph_nodes(const onnx::GraphProto &graph) {
 		vector<onnx::NodeProto> nodes;
 		for( int i = 0; i < graph.node_size(); i++) {
 			onnx::NodeProto node = graph.node(i);
@@ -419,7 +566,10 @@ using namespace std;
 				//return;
 			}
 		}
-		return build_net_onnx(model, mem);
+		// External data locations are relative to the model file
+		size_t sep = path.find_last_of("/\\");
+		string base_dir = (sep == string::npos) ? "" : path.substr(0, sep + 1);
+		return build_net_onnx(model, mem, base_dir);
 	}
 
 	//Imports a net from a pointer passed as argument
@@ -455,7 +605,7 @@ using namespace std;
 
 
 	//Builds a eddl Net from an instance of the onnx container for model
-	Net* build_net_onnx(onnx::ModelProto model, int mem){
+	Net* build_net_onnx(const onnx::ModelProto &model, int mem, string base_dir){
 
 		long long int ir_version = model.ir_version();
 		// We have to check if the imported net has the
@@ -476,19 +626,19 @@ using namespace std;
 		cout << "Domain: " << model.domain() << endl;
 		cout << "Model_version: " << model.model_version() << endl;
 		int counter = 0;
-		onnx::GraphProto graph = model.graph(); //Get the graph of the model.
+		const onnx::GraphProto &graph = model.graph(); //Get the graph of the model.
 		//Model needs input in the constructor, so we start with that.
 
 		vector<onnx::ValueInfoProto> inputs_onnx = get_inputs(graph); //Get the inputs
 
 		vector<Layer*> inputs =  parse_IO_tensors(inputs_onnx, mem); //Parse ONNX inputs to EDDL inputs
 
-		vector<onnx::TensorProto> initializers = get_initializers(graph); // Retrieves the initializers from the graph.
-																		  // The weight for the layers can be found in the initializers.
-
+		// The weight for the layers can be found in the initializers.
+		// Tensors stored as external data are read from their mmapped files
+		ExternalDataReader reader(base_dir);
 		map<string, vector<float>> map_init_values;
 		map<string, vector<int>>   map_init_dims;
-		get_initializers_maps(initializers, map_init_values, map_init_dims);// Creates 2 maps
+		get_initializers_maps(graph, map_init_values, map_init_dims, &reader);// Creates 2 maps
 																			//  Key: Input Name . Value: Weights
 																			//  Key: Input Name . Value: Dims
 		vector<onnx::NodeProto> nodes = get_graph_nodes(graph);
@@ -668,6 +818,8 @@ using namespace std;
 						//bool explicit_padding;
 						string auto_pad_option = "";
 						bool auto_pad = false;
+						int group = 1;
+						vector<int> dilations = {1, 1};
 						vector<float> *bias;
 
 						for ( int j = 0; j < node->attribute_size(); j++ ) { //Set the attributes
@@ -684,11 +836,14 @@ using namespace std;
 								else if(!attribute.s().compare("SAME_UPPER"))
 									auto_pad_option = "same";
 							}
-							else if (!attr_name.compare("dilations")) { //It isn't implemented in eddl
-
+							else if (!attr_name.compare("dilations")) {
+								dilations.clear();
+								for( int h = 0; h < attribute.ints_size(); h++){
+									dilations.push_back(attribute.ints(h));
+								}
 							}
-							else if (!attr_name.compare("group")) { //We don't know if this exists in eddl
-
+							else if (!attr_name.compare("group")) {
+								group = attribute.i();
 							}
 							else if (!attr_name.compare("kernel_shape")) { //
 								for( int h = 0; h<attribute.ints_size(); h++){
@@ -696,7 +851,7 @@ using namespace std;
 								}
 							}
 							else if (!attr_name.compare("pads")) { //
-								for(int h = 0; h < 4; h++){
+								for(int h = 0; h < attribute.ints_size(); h++){
 									pads.push_back(attribute.ints(h));
 								}
 							}
@@ -727,28 +882,30 @@ using namespace std;
 
 						filters = dims[0];
 						string name = node->name();
+						bool conv1D = kernel_shape.size() == 1;
+						if(conv1D){ //1D convolutions are single-row 2D convolutions
+							kernel_shape.insert(kernel_shape.begin(), 1);
+							strides.insert(strides.begin(), 1);
+							if (dilations.size() == 1) dilations.insert(dilations.begin(), 1);
+						}
 						ConvolDescriptor* convol_descriptor;
 						if(!auto_pad){
 							kernel_shape.insert(kernel_shape.begin(), filters); //Add number of filters to kernel shape
-							convol_descriptor = new ConvolDescriptor(kernel_shape, strides, pads);
+							convol_descriptor = new ConvolDescriptor(kernel_shape, strides, onnx_pads_to_eddl(pads), 0, group, dilations);
+							convol_descriptor->use_bias = node->input_size() > 2;
 						}
-						else convol_descriptor = new ConvolDescriptor(filters, kernel_shape, strides, auto_pad_option, node->input_size() > 2, mem);
+						else convol_descriptor = new ConvolDescriptor(filters, kernel_shape, strides, auto_pad_option, node->input_size() > 2, mem, group, dilations);
 
-						actual_layer = new LConv(parent, convol_descriptor, name, dev, mem);
+						if(conv1D) actual_layer = new LConv1D(parent, convol_descriptor, name, dev, mem);
+						else actual_layer = new LConv(parent, convol_descriptor, name, dev, mem);
 
 						if(node->input_size() > 2){
 							string bias_name = node->input(2);
 							bias = &(map_init_values[bias_name]);
 							vector<int> bias_shape;
-							bias_shape.push_back(bias->size());
-							Tensor* bias_tensor = new Tensor(bias_shape, NEW_FROM_VECTOR_PTR(bias), dev);
-							Tensor::copy(bias_tensor , convol_descriptor->bias);
-							delete bias_tensor;
-
+							copy_values_to_tensor(*bias, convol_descriptor->bias);
 						}
-						Tensor* weights_tensor = new Tensor(dims, NEW_FROM_VECTOR_PTR(weights), dev);
-						Tensor::copy(weights_tensor, convol_descriptor->K);
-						delete weights_tensor;
+						copy_values_to_tensor(*weights, convol_descriptor->K);
 						break;
 					}
 
@@ -810,26 +967,11 @@ using namespace std;
 						Tensor * input_size = parent->output;
 						LDense* dense = new LDense(parent, neuronas, use_bias, name, dev, mem); 
 
-						Tensor* weights_tensor = new Tensor(dims, NEW_FROM_VECTOR_PTR(weights), dev);
-						if(transB){
-							vector<int> reverse_dims;
-							for(int h = dims.size()-1; h >= 0; h--){
-								reverse_dims.push_back(dims[h]);
-							}
-							Tensor* weights_tensor_T = new Tensor(reverse_dims, dev);
-							Tensor::transpose(weights_tensor, weights_tensor_T, {1,0});
-							Tensor::copy(weights_tensor_T, dense->W );
-							delete weights_tensor_T;
-						}
-						else Tensor::copy(weights_tensor, dense->W );
-						delete weights_tensor;
+						copy_values_to_tensor(*weights, dense->W, transB);
 						if(use_bias){
 							bias_name = node->input(2);
 							bias = &(map_init_values[bias_name]);
-							bias_dims = map_init_dims[bias_name];
-							Tensor* bias_tensor = new Tensor(bias_dims, NEW_FROM_VECTOR_PTR(bias), dev);
-							Tensor::copy(bias_tensor, dense->bias);
-							delete bias_tensor;
+							copy_values_to_tensor(*bias, dense->bias);
 						}
 						actual_layer = dense;
 					}
@@ -929,7 +1071,7 @@ using namespace std;
 								}
 							}
 							else if (!attr_name.compare("pads")) {
-								for(int h = 0; h < 4; h++){
+								for(int h = 0; h < attribute.ints_size(); h++){
 									pads.push_back(attribute.ints(h));
 								}
 							}
@@ -956,7 +1098,7 @@ using namespace std;
 						string name = node->name();
 
 
-						actual_layer = new LAveragePool(parent, new PoolDescriptor(kernel_shape, strides, pads), name, dev, mem);
+						actual_layer = new LAveragePool(parent, new PoolDescriptor(kernel_shape, strides, onnx_pads_to_eddl(pads)), name, dev, mem);
 					}
 					break;
 
@@ -1422,7 +1564,7 @@ using namespace std;
 								}
 							}
 							else if (!attr_name.compare("pads")) {
-								for(int h = 0; h < 4; h++){
+								for(int h = 0; h < attribute.ints_size(); h++){
 									pads.push_back(attribute.ints(h));
 								}
 							}
@@ -1451,7 +1593,12 @@ using namespace std;
 
 						string name = node->name();
 
-						actual_layer = new LMaxPool(parent, new PoolDescriptor(kernel_shape, strides, pads), name, dev, mem);
+						if(kernel_shape.size() == 1){ //1D pooling is a single-row 2D pooling
+							kernel_shape.insert(kernel_shape.begin(), 1);
+							strides.insert(strides.begin(), 1);
+							actual_layer = new LMaxPool1D(parent, new PoolDescriptor(kernel_shape, strides, onnx_pads_to_eddl(pads)), name, dev, mem);
+						}
+						else actual_layer = new LMaxPool(parent, new PoolDescriptor(kernel_shape, strides, onnx_pads_to_eddl(pads)), name, dev, mem);
 					}
 						break;
 				case ONNX_LAYERS::GLOBMAXPOOL:
@@ -1689,18 +1836,17 @@ using namespace std;
 
 
 	//Returns a map containing the name of the layer as key and a tensor with the values of the model as value
-	map<string, vector<Tensor*> > get_tensors_from_onnx(onnx::ModelProto model){
+	map<string, vector<Tensor*> > get_tensors_from_onnx(const onnx::ModelProto &model){
 
 		map<string, vector<Tensor*> > tensors;
 
-		onnx::GraphProto graph = model.graph(); //Get the graph of the model.
+		const onnx::GraphProto &graph = model.graph(); //Get the graph of the model.
 		//Model needs input and output in the constructor, so we start with that.
 
-		vector<onnx::TensorProto> initializers = get_initializers(graph); // Retrieves the initializers from the graph.
-																		  // The weight for the layers can be found in the initializers.
+		// The weight for the layers can be found in the initializers.
 		map<string, vector<float>> map_init_values;
 		map<string, vector<int>>   map_init_dims;
-		get_initializers_maps(initializers, map_init_values, map_init_dims); // Creates 2 maps
+		get_initializers_maps(graph, map_init_values, map_init_dims); // Creates 2 maps
 																			//  Key: Input Name . Value: Weights
 																			//  Key: Input Name . Value: Dims
 		vector<onnx::NodeProto> nodes = get_graph_nodes(graph);
@@ -1723,6 +1869,7 @@ using namespace std;
 						string weights_name = node.input(1); //Get weights and dims
 						vector<float>* weights = &(map_init_values[weights_name]);
 						vector<int> dims = map_init_dims[weights_name];
+						if(dims.size() == 3) dims.insert(dims.begin() + 2, 1); // 1D kernels have a single row
 
 						conv_tensors.push_back(new Tensor(dims, NEW_FROM_VECTOR_PTR(weights), dev));
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -44,68 +42,60 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_onnx_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[17]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_onnx_2eproto;
 namespace onnx {
 class AttributeProto;
-class AttributeProtoDefaultTypeInternal;
+struct AttributeProtoDefaultTypeInternal;
 extern AttributeProtoDefaultTypeInternal _AttributeProto_default_instance_;
 class GraphProto;
-class GraphProtoDefaultTypeInternal;
+struct GraphProtoDefaultTypeInternal;
 extern GraphProtoDefaultTypeInternal _GraphProto_default_instance_;
 class ModelProto;
-class ModelProtoDefaultTypeInternal;
+struct ModelProtoDefaultTypeInternal;
 extern ModelProtoDefaultTypeInternal _ModelProto_default_instance_;
 class NodeProto;
-class NodeProtoDefaultTypeInternal;
+struct NodeProtoDefaultTypeInternal;
 extern NodeProtoDefaultTypeInternal _NodeProto_default_instance_;
 class OperatorSetIdProto;
-class OperatorSetIdProtoDefaultTypeInternal;
+struct OperatorSetIdProtoDefaultTypeInternal;
 extern OperatorSetIdProtoDefaultTypeInternal _OperatorSetIdProto_default_instance_;
 class SparseTensorProto;
-class SparseTensorProtoDefaultTypeInternal;
+struct SparseTensorProtoDefaultTypeInternal;
 extern SparseTensorProtoDefaultTypeInternal _SparseTensorProto_default_instance_;
 class StringStringEntryProto;
-class StringStringEntryProtoDefaultTypeInternal;
+struct StringStringEntryProtoDefaultTypeInternal;
 extern StringStringEntryProtoDefaultTypeInternal _StringStringEntryProto_default_instance_;
 class TensorAnnotation;
-class TensorAnnotationDefaultTypeInternal;
+struct TensorAnnotationDefaultTypeInternal;
 extern TensorAnnotationDefaultTypeInternal _TensorAnnotation_default_instance_;
 class TensorProto;
-class TensorProtoDefaultTypeInternal;
+struct TensorProtoDefaultTypeInternal;
 extern TensorProtoDefaultTypeInternal _TensorProto_default_instance_;
 class TensorProto_Segment;
-class TensorProto_SegmentDefaultTypeInternal;
+struct TensorProto_SegmentDefaultTypeInternal;
 extern TensorProto_SegmentDefaultTypeInternal _TensorProto_Segment_default_instance_;
 class TensorShapeProto;
-class TensorShapeProtoDefaultTypeInternal;
+struct TensorShapeProtoDefaultTypeInternal;
 extern TensorShapeProtoDefaultTypeInternal _TensorShapeProto_default_instance_;
 class TensorShapeProto_Dimension;
-class TensorShapeProto_DimensionDefaultTypeInternal;
+struct TensorShapeProto_DimensionDefaultTypeInternal;
 extern TensorShapeProto_DimensionDefaultTypeInternal _TensorShapeProto_Dimension_default_instance_;
 class TypeProto;
-class TypeProtoDefaultTypeInternal;
+struct TypeProtoDefaultTypeInternal;
 extern TypeProtoDefaultTypeInternal _TypeProto_default_instance_;
 class TypeProto_Map;
-class TypeProto_MapDefaultTypeInternal;
+struct TypeProto_MapDefaultTypeInternal;
 extern TypeProto_MapDefaultTypeInternal _TypeProto_Map_default_instance_;
 class TypeProto_Sequence;
-class TypeProto_SequenceDefaultTypeInternal;
+struct TypeProto_SequenceDefaultTypeInternal;
 extern TypeProto_SequenceDefaultTypeInternal _TypeProto_Sequence_default_instance_;
 class TypeProto_Tensor;
-class TypeProto_TensorDefaultTypeInternal;
+struct TypeProto_TensorDefaultTypeInternal;
 extern TypeProto_TensorDefaultTypeInternal _TypeProto_Tensor_default_instance_;
 class ValueInfoProto;
-class ValueInfoProtoDefaultTypeInternal;
+struct ValueInfoProtoDefaultTypeInternal;
 extern ValueInfoProtoDefaultTypeInternal _ValueInfoProto_default_instance_;
 }  // namespace onnx
 PROTOBUF_NAMESPACE_OPEN
@@ -159,7 +149,7 @@ inline const std::string& AttributeProto_AttributeType_Name(T enum_t_value) {
     AttributeProto_AttributeType_descriptor(), enum_t_value);
 }
 inline bool AttributeProto_AttributeType_Parse(
-    const std::string& name, AttributeProto_AttributeType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, AttributeProto_AttributeType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<AttributeProto_AttributeType>(
     AttributeProto_AttributeType_descriptor(), name, value);
 }
@@ -197,7 +187,7 @@ inline const std::string& TensorProto_DataType_Name(T enum_t_value) {
     TensorProto_DataType_descriptor(), enum_t_value);
 }
 inline bool TensorProto_DataType_Parse(
-    const std::string& name, TensorProto_DataType* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TensorProto_DataType* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TensorProto_DataType>(
     TensorProto_DataType_descriptor(), name, value);
 }
@@ -220,7 +210,7 @@ inline const std::string& TensorProto_DataLocation_Name(T enum_t_value) {
     TensorProto_DataLocation_descriptor(), enum_t_value);
 }
 inline bool TensorProto_DataLocation_Parse(
-    const std::string& name, TensorProto_DataLocation* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TensorProto_DataLocation* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TensorProto_DataLocation>(
     TensorProto_DataLocation_descriptor(), name, value);
 }
@@ -248,17 +238,18 @@ inline const std::string& Version_Name(T enum_t_value) {
     Version_descriptor(), enum_t_value);
 }
 inline bool Version_Parse(
-    const std::string& name, Version* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Version* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Version>(
     Version_descriptor(), name, value);
 }
 // ===================================================================
 
-class AttributeProto :
+class AttributeProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.AttributeProto) */ {
  public:
-  AttributeProto();
-  virtual ~AttributeProto();
+  inline AttributeProto() : AttributeProto(nullptr) {}
+  ~AttributeProto() override;
+  explicit PROTOBUF_CONSTEXPR AttributeProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AttributeProto(const AttributeProto& from);
   AttributeProto(AttributeProto&& from) noexcept
@@ -271,8 +262,13 @@ class AttributeProto :
     return *this;
   }
   inline AttributeProto& operator=(AttributeProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -280,24 +276,24 @@ class AttributeProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AttributeProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const AttributeProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const AttributeProto* internal_default_instance() {
     return reinterpret_cast<const AttributeProto*>(
                &_AttributeProto_default_instance_);
@@ -310,57 +306,66 @@ class AttributeProto :
   }
   inline void Swap(AttributeProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AttributeProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AttributeProto* New() const final {
-    return CreateMaybeMessage<AttributeProto>(nullptr);
-  }
-
-  AttributeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AttributeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AttributeProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AttributeProto& from);
-  void MergeFrom(const AttributeProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AttributeProto& from) {
+    AttributeProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AttributeProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.AttributeProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit AttributeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -411,7 +416,7 @@ class AttributeProto :
       "Incorrect type passed to function AttributeType_Name.");
     return AttributeProto_AttributeType_Name(enum_t_value);
   }
-  static inline bool AttributeType_Parse(const std::string& name,
+  static inline bool AttributeType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       AttributeType* value) {
     return AttributeProto_AttributeType_Parse(name, value);
   }
@@ -465,19 +470,19 @@ class AttributeProto :
   public:
   void clear_ints();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_ints(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t _internal_ints(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       _internal_ints() const;
-  void _internal_add_ints(::PROTOBUF_NAMESPACE_ID::int64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  void _internal_add_ints(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       _internal_mutable_ints();
   public:
-  ::PROTOBUF_NAMESPACE_ID::int64 ints(int index) const;
-  void set_ints(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
-  void add_ints(::PROTOBUF_NAMESPACE_ID::int64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t ints(int index) const;
+  void set_ints(int index, int64_t value);
+  void add_ints(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       ints() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       mutable_ints();
 
   // repeated bytes strings = 9;
@@ -565,16 +570,14 @@ class AttributeProto :
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -585,16 +588,14 @@ class AttributeProto :
   public:
   void clear_s();
   const std::string& s() const;
-  void set_s(const std::string& value);
-  void set_s(std::string&& value);
-  void set_s(const char* value);
-  void set_s(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_s(ArgT0&& arg0, ArgT... args);
   std::string* mutable_s();
-  std::string* release_s();
+  PROTOBUF_NODISCARD std::string* release_s();
   void set_allocated_s(std::string* s);
   private:
   const std::string& _internal_s() const;
-  void _internal_set_s(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_s(const std::string& value);
   std::string* _internal_mutable_s();
   public:
 
@@ -605,16 +606,14 @@ class AttributeProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -625,16 +624,14 @@ class AttributeProto :
   public:
   void clear_ref_attr_name();
   const std::string& ref_attr_name() const;
-  void set_ref_attr_name(const std::string& value);
-  void set_ref_attr_name(std::string&& value);
-  void set_ref_attr_name(const char* value);
-  void set_ref_attr_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ref_attr_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_ref_attr_name();
-  std::string* release_ref_attr_name();
+  PROTOBUF_NODISCARD std::string* release_ref_attr_name();
   void set_allocated_ref_attr_name(std::string* ref_attr_name);
   private:
   const std::string& _internal_ref_attr_name() const;
-  void _internal_set_ref_attr_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ref_attr_name(const std::string& value);
   std::string* _internal_mutable_ref_attr_name();
   public:
 
@@ -645,13 +642,16 @@ class AttributeProto :
   public:
   void clear_t();
   const ::onnx::TensorProto& t() const;
-  ::onnx::TensorProto* release_t();
+  PROTOBUF_NODISCARD ::onnx::TensorProto* release_t();
   ::onnx::TensorProto* mutable_t();
   void set_allocated_t(::onnx::TensorProto* t);
   private:
   const ::onnx::TensorProto& _internal_t() const;
   ::onnx::TensorProto* _internal_mutable_t();
   public:
+  void unsafe_arena_set_allocated_t(
+      ::onnx::TensorProto* t);
+  ::onnx::TensorProto* unsafe_arena_release_t();
 
   // optional .onnx.GraphProto g = 6;
   bool has_g() const;
@@ -660,13 +660,16 @@ class AttributeProto :
   public:
   void clear_g();
   const ::onnx::GraphProto& g() const;
-  ::onnx::GraphProto* release_g();
+  PROTOBUF_NODISCARD ::onnx::GraphProto* release_g();
   ::onnx::GraphProto* mutable_g();
   void set_allocated_g(::onnx::GraphProto* g);
   private:
   const ::onnx::GraphProto& _internal_g() const;
   ::onnx::GraphProto* _internal_mutable_g();
   public:
+  void unsafe_arena_set_allocated_g(
+      ::onnx::GraphProto* g);
+  ::onnx::GraphProto* unsafe_arena_release_g();
 
   // optional .onnx.SparseTensorProto sparse_tensor = 22;
   bool has_sparse_tensor() const;
@@ -675,13 +678,16 @@ class AttributeProto :
   public:
   void clear_sparse_tensor();
   const ::onnx::SparseTensorProto& sparse_tensor() const;
-  ::onnx::SparseTensorProto* release_sparse_tensor();
+  PROTOBUF_NODISCARD ::onnx::SparseTensorProto* release_sparse_tensor();
   ::onnx::SparseTensorProto* mutable_sparse_tensor();
   void set_allocated_sparse_tensor(::onnx::SparseTensorProto* sparse_tensor);
   private:
   const ::onnx::SparseTensorProto& _internal_sparse_tensor() const;
   ::onnx::SparseTensorProto* _internal_mutable_sparse_tensor();
   public:
+  void unsafe_arena_set_allocated_sparse_tensor(
+      ::onnx::SparseTensorProto* sparse_tensor);
+  ::onnx::SparseTensorProto* unsafe_arena_release_sparse_tensor();
 
   // optional int64 i = 3;
   bool has_i() const;
@@ -689,11 +695,11 @@ class AttributeProto :
   bool _internal_has_i() const;
   public:
   void clear_i();
-  ::PROTOBUF_NAMESPACE_ID::int64 i() const;
-  void set_i(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t i() const;
+  void set_i(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_i() const;
-  void _internal_set_i(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_i() const;
+  void _internal_set_i(int64_t value);
   public:
 
   // optional float f = 2;
@@ -726,34 +732,40 @@ class AttributeProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > floats_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > ints_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> strings_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto > tensors_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::GraphProto > graphs_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto > sparse_tensors_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr s_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ref_attr_name_;
-  ::onnx::TensorProto* t_;
-  ::onnx::GraphProto* g_;
-  ::onnx::SparseTensorProto* sparse_tensor_;
-  ::PROTOBUF_NAMESPACE_ID::int64 i_;
-  float f_;
-  int type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > floats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > ints_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> strings_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto > tensors_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::GraphProto > graphs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto > sparse_tensors_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr s_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ref_attr_name_;
+    ::onnx::TensorProto* t_;
+    ::onnx::GraphProto* g_;
+    ::onnx::SparseTensorProto* sparse_tensor_;
+    int64_t i_;
+    float f_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ValueInfoProto :
+class ValueInfoProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.ValueInfoProto) */ {
  public:
-  ValueInfoProto();
-  virtual ~ValueInfoProto();
+  inline ValueInfoProto() : ValueInfoProto(nullptr) {}
+  ~ValueInfoProto() override;
+  explicit PROTOBUF_CONSTEXPR ValueInfoProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ValueInfoProto(const ValueInfoProto& from);
   ValueInfoProto(ValueInfoProto&& from) noexcept
@@ -766,8 +778,13 @@ class ValueInfoProto :
     return *this;
   }
   inline ValueInfoProto& operator=(ValueInfoProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -775,24 +792,24 @@ class ValueInfoProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ValueInfoProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const ValueInfoProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ValueInfoProto* internal_default_instance() {
     return reinterpret_cast<const ValueInfoProto*>(
                &_ValueInfoProto_default_instance_);
@@ -805,57 +822,66 @@ class ValueInfoProto :
   }
   inline void Swap(ValueInfoProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ValueInfoProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ValueInfoProto* New() const final {
-    return CreateMaybeMessage<ValueInfoProto>(nullptr);
-  }
-
-  ValueInfoProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ValueInfoProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ValueInfoProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ValueInfoProto& from);
-  void MergeFrom(const ValueInfoProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ValueInfoProto& from) {
+    ValueInfoProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ValueInfoProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.ValueInfoProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ValueInfoProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -873,16 +899,14 @@ class ValueInfoProto :
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -893,16 +917,14 @@ class ValueInfoProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -913,33 +935,42 @@ class ValueInfoProto :
   public:
   void clear_type();
   const ::onnx::TypeProto& type() const;
-  ::onnx::TypeProto* release_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto* release_type();
   ::onnx::TypeProto* mutable_type();
   void set_allocated_type(::onnx::TypeProto* type);
   private:
   const ::onnx::TypeProto& _internal_type() const;
   ::onnx::TypeProto* _internal_mutable_type();
   public:
+  void unsafe_arena_set_allocated_type(
+      ::onnx::TypeProto* type);
+  ::onnx::TypeProto* unsafe_arena_release_type();
 
   // @@protoc_insertion_point(class_scope:onnx.ValueInfoProto)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
-  ::onnx::TypeProto* type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+    ::onnx::TypeProto* type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NodeProto :
+class NodeProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.NodeProto) */ {
  public:
-  NodeProto();
-  virtual ~NodeProto();
+  inline NodeProto() : NodeProto(nullptr) {}
+  ~NodeProto() override;
+  explicit PROTOBUF_CONSTEXPR NodeProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NodeProto(const NodeProto& from);
   NodeProto(NodeProto&& from) noexcept
@@ -952,8 +983,13 @@ class NodeProto :
     return *this;
   }
   inline NodeProto& operator=(NodeProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -961,24 +997,24 @@ class NodeProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NodeProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const NodeProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const NodeProto* internal_default_instance() {
     return reinterpret_cast<const NodeProto*>(
                &_NodeProto_default_instance_);
@@ -991,57 +1027,66 @@ class NodeProto :
   }
   inline void Swap(NodeProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NodeProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NodeProto* New() const final {
-    return CreateMaybeMessage<NodeProto>(nullptr);
-  }
-
-  NodeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NodeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NodeProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NodeProto& from);
-  void MergeFrom(const NodeProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NodeProto& from) {
+    NodeProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NodeProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.NodeProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit NodeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1129,16 +1174,14 @@ class NodeProto :
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -1149,16 +1192,14 @@ class NodeProto :
   public:
   void clear_op_type();
   const std::string& op_type() const;
-  void set_op_type(const std::string& value);
-  void set_op_type(std::string&& value);
-  void set_op_type(const char* value);
-  void set_op_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_op_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_op_type();
-  std::string* release_op_type();
+  PROTOBUF_NODISCARD std::string* release_op_type();
   void set_allocated_op_type(std::string* op_type);
   private:
   const std::string& _internal_op_type() const;
-  void _internal_set_op_type(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_op_type(const std::string& value);
   std::string* _internal_mutable_op_type();
   public:
 
@@ -1169,16 +1210,14 @@ class NodeProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -1189,16 +1228,14 @@ class NodeProto :
   public:
   void clear_domain();
   const std::string& domain() const;
-  void set_domain(const std::string& value);
-  void set_domain(std::string&& value);
-  void set_domain(const char* value);
-  void set_domain(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_domain(ArgT0&& arg0, ArgT... args);
   std::string* mutable_domain();
-  std::string* release_domain();
+  PROTOBUF_NODISCARD std::string* release_domain();
   void set_allocated_domain(std::string* domain);
   private:
   const std::string& _internal_domain() const;
-  void _internal_set_domain(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_domain(const std::string& value);
   std::string* _internal_mutable_domain();
   public:
 
@@ -1206,25 +1243,31 @@ class NodeProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> input_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> output_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::AttributeProto > attribute_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> input_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> output_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::AttributeProto > attribute_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr op_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ModelProto :
+class ModelProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.ModelProto) */ {
  public:
-  ModelProto();
-  virtual ~ModelProto();
+  inline ModelProto() : ModelProto(nullptr) {}
+  ~ModelProto() override;
+  explicit PROTOBUF_CONSTEXPR ModelProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ModelProto(const ModelProto& from);
   ModelProto(ModelProto&& from) noexcept
@@ -1237,8 +1280,13 @@ class ModelProto :
     return *this;
   }
   inline ModelProto& operator=(ModelProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1246,24 +1294,24 @@ class ModelProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ModelProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const ModelProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ModelProto* internal_default_instance() {
     return reinterpret_cast<const ModelProto*>(
                &_ModelProto_default_instance_);
@@ -1276,57 +1324,66 @@ class ModelProto :
   }
   inline void Swap(ModelProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ModelProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ModelProto* New() const final {
-    return CreateMaybeMessage<ModelProto>(nullptr);
-  }
-
-  ModelProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ModelProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ModelProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ModelProto& from);
-  void MergeFrom(const ModelProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ModelProto& from) {
+    ModelProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ModelProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.ModelProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ModelProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1386,16 +1443,14 @@ class ModelProto :
   public:
   void clear_producer_name();
   const std::string& producer_name() const;
-  void set_producer_name(const std::string& value);
-  void set_producer_name(std::string&& value);
-  void set_producer_name(const char* value);
-  void set_producer_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_producer_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_producer_name();
-  std::string* release_producer_name();
+  PROTOBUF_NODISCARD std::string* release_producer_name();
   void set_allocated_producer_name(std::string* producer_name);
   private:
   const std::string& _internal_producer_name() const;
-  void _internal_set_producer_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_producer_name(const std::string& value);
   std::string* _internal_mutable_producer_name();
   public:
 
@@ -1406,16 +1461,14 @@ class ModelProto :
   public:
   void clear_producer_version();
   const std::string& producer_version() const;
-  void set_producer_version(const std::string& value);
-  void set_producer_version(std::string&& value);
-  void set_producer_version(const char* value);
-  void set_producer_version(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_producer_version(ArgT0&& arg0, ArgT... args);
   std::string* mutable_producer_version();
-  std::string* release_producer_version();
+  PROTOBUF_NODISCARD std::string* release_producer_version();
   void set_allocated_producer_version(std::string* producer_version);
   private:
   const std::string& _internal_producer_version() const;
-  void _internal_set_producer_version(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_producer_version(const std::string& value);
   std::string* _internal_mutable_producer_version();
   public:
 
@@ -1426,16 +1479,14 @@ class ModelProto :
   public:
   void clear_domain();
   const std::string& domain() const;
-  void set_domain(const std::string& value);
-  void set_domain(std::string&& value);
-  void set_domain(const char* value);
-  void set_domain(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_domain(ArgT0&& arg0, ArgT... args);
   std::string* mutable_domain();
-  std::string* release_domain();
+  PROTOBUF_NODISCARD std::string* release_domain();
   void set_allocated_domain(std::string* domain);
   private:
   const std::string& _internal_domain() const;
-  void _internal_set_domain(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_domain(const std::string& value);
   std::string* _internal_mutable_domain();
   public:
 
@@ -1446,16 +1497,14 @@ class ModelProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -1466,13 +1515,16 @@ class ModelProto :
   public:
   void clear_graph();
   const ::onnx::GraphProto& graph() const;
-  ::onnx::GraphProto* release_graph();
+  PROTOBUF_NODISCARD ::onnx::GraphProto* release_graph();
   ::onnx::GraphProto* mutable_graph();
   void set_allocated_graph(::onnx::GraphProto* graph);
   private:
   const ::onnx::GraphProto& _internal_graph() const;
   ::onnx::GraphProto* _internal_mutable_graph();
   public:
+  void unsafe_arena_set_allocated_graph(
+      ::onnx::GraphProto* graph);
+  ::onnx::GraphProto* unsafe_arena_release_graph();
 
   // optional int64 ir_version = 1;
   bool has_ir_version() const;
@@ -1480,11 +1532,11 @@ class ModelProto :
   bool _internal_has_ir_version() const;
   public:
   void clear_ir_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 ir_version() const;
-  void set_ir_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t ir_version() const;
+  void set_ir_version(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_ir_version() const;
-  void _internal_set_ir_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_ir_version() const;
+  void _internal_set_ir_version(int64_t value);
   public:
 
   // optional int64 model_version = 5;
@@ -1493,38 +1545,44 @@ class ModelProto :
   bool _internal_has_model_version() const;
   public:
   void clear_model_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 model_version() const;
-  void set_model_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t model_version() const;
+  void set_model_version(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_model_version() const;
-  void _internal_set_model_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_model_version() const;
+  void _internal_set_model_version(int64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:onnx.ModelProto)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::OperatorSetIdProto > opset_import_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > metadata_props_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr producer_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr producer_version_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
-  ::onnx::GraphProto* graph_;
-  ::PROTOBUF_NAMESPACE_ID::int64 ir_version_;
-  ::PROTOBUF_NAMESPACE_ID::int64 model_version_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::OperatorSetIdProto > opset_import_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > metadata_props_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr producer_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr producer_version_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+    ::onnx::GraphProto* graph_;
+    int64_t ir_version_;
+    int64_t model_version_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StringStringEntryProto :
+class StringStringEntryProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.StringStringEntryProto) */ {
  public:
-  StringStringEntryProto();
-  virtual ~StringStringEntryProto();
+  inline StringStringEntryProto() : StringStringEntryProto(nullptr) {}
+  ~StringStringEntryProto() override;
+  explicit PROTOBUF_CONSTEXPR StringStringEntryProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StringStringEntryProto(const StringStringEntryProto& from);
   StringStringEntryProto(StringStringEntryProto&& from) noexcept
@@ -1537,8 +1595,13 @@ class StringStringEntryProto :
     return *this;
   }
   inline StringStringEntryProto& operator=(StringStringEntryProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1546,24 +1609,24 @@ class StringStringEntryProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StringStringEntryProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const StringStringEntryProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const StringStringEntryProto* internal_default_instance() {
     return reinterpret_cast<const StringStringEntryProto*>(
                &_StringStringEntryProto_default_instance_);
@@ -1576,57 +1639,66 @@ class StringStringEntryProto :
   }
   inline void Swap(StringStringEntryProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StringStringEntryProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StringStringEntryProto* New() const final {
-    return CreateMaybeMessage<StringStringEntryProto>(nullptr);
-  }
-
-  StringStringEntryProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StringStringEntryProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StringStringEntryProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StringStringEntryProto& from);
-  void MergeFrom(const StringStringEntryProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StringStringEntryProto& from) {
+    StringStringEntryProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StringStringEntryProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.StringStringEntryProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit StringStringEntryProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1643,16 +1715,14 @@ class StringStringEntryProto :
   public:
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
@@ -1663,16 +1733,14 @@ class StringStringEntryProto :
   public:
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -1680,20 +1748,26 @@ class StringStringEntryProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TensorAnnotation :
+class TensorAnnotation final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TensorAnnotation) */ {
  public:
-  TensorAnnotation();
-  virtual ~TensorAnnotation();
+  inline TensorAnnotation() : TensorAnnotation(nullptr) {}
+  ~TensorAnnotation() override;
+  explicit PROTOBUF_CONSTEXPR TensorAnnotation(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TensorAnnotation(const TensorAnnotation& from);
   TensorAnnotation(TensorAnnotation&& from) noexcept
@@ -1706,8 +1780,13 @@ class TensorAnnotation :
     return *this;
   }
   inline TensorAnnotation& operator=(TensorAnnotation&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1715,24 +1794,24 @@ class TensorAnnotation :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorAnnotation& default_instance() {
+    return *internal_default_instance();
   }
-  static const TensorAnnotation& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TensorAnnotation* internal_default_instance() {
     return reinterpret_cast<const TensorAnnotation*>(
                &_TensorAnnotation_default_instance_);
@@ -1745,57 +1824,66 @@ class TensorAnnotation :
   }
   inline void Swap(TensorAnnotation* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorAnnotation* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TensorAnnotation* New() const final {
-    return CreateMaybeMessage<TensorAnnotation>(nullptr);
-  }
-
-  TensorAnnotation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TensorAnnotation* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TensorAnnotation>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TensorAnnotation& from);
-  void MergeFrom(const TensorAnnotation& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorAnnotation& from) {
+    TensorAnnotation::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TensorAnnotation* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TensorAnnotation";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TensorAnnotation(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1830,16 +1918,14 @@ class TensorAnnotation :
   public:
   void clear_tensor_name();
   const std::string& tensor_name() const;
-  void set_tensor_name(const std::string& value);
-  void set_tensor_name(std::string&& value);
-  void set_tensor_name(const char* value);
-  void set_tensor_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tensor_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_tensor_name();
-  std::string* release_tensor_name();
+  PROTOBUF_NODISCARD std::string* release_tensor_name();
   void set_allocated_tensor_name(std::string* tensor_name);
   private:
   const std::string& _internal_tensor_name() const;
-  void _internal_set_tensor_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tensor_name(const std::string& value);
   std::string* _internal_mutable_tensor_name();
   public:
 
@@ -1847,20 +1933,26 @@ class TensorAnnotation :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > quant_parameter_tensor_names_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tensor_name_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > quant_parameter_tensor_names_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tensor_name_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GraphProto :
+class GraphProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.GraphProto) */ {
  public:
-  GraphProto();
-  virtual ~GraphProto();
+  inline GraphProto() : GraphProto(nullptr) {}
+  ~GraphProto() override;
+  explicit PROTOBUF_CONSTEXPR GraphProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GraphProto(const GraphProto& from);
   GraphProto(GraphProto&& from) noexcept
@@ -1873,8 +1965,13 @@ class GraphProto :
     return *this;
   }
   inline GraphProto& operator=(GraphProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1882,24 +1979,24 @@ class GraphProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GraphProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const GraphProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GraphProto* internal_default_instance() {
     return reinterpret_cast<const GraphProto*>(
                &_GraphProto_default_instance_);
@@ -1912,57 +2009,66 @@ class GraphProto :
   }
   inline void Swap(GraphProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GraphProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline GraphProto* New() const final {
-    return CreateMaybeMessage<GraphProto>(nullptr);
-  }
-
-  GraphProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  GraphProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GraphProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GraphProto& from);
-  void MergeFrom(const GraphProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GraphProto& from) {
+    GraphProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GraphProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.GraphProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit GraphProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2112,16 +2218,14 @@ class GraphProto :
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -2132,16 +2236,14 @@ class GraphProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -2149,27 +2251,33 @@ class GraphProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::NodeProto > node_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto > initializer_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > input_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > output_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > value_info_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorAnnotation > quantization_annotation_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto > sparse_initializer_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::NodeProto > node_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto > initializer_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > input_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > output_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto > value_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorAnnotation > quantization_annotation_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto > sparse_initializer_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TensorProto_Segment :
+class TensorProto_Segment final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TensorProto.Segment) */ {
  public:
-  TensorProto_Segment();
-  virtual ~TensorProto_Segment();
+  inline TensorProto_Segment() : TensorProto_Segment(nullptr) {}
+  ~TensorProto_Segment() override;
+  explicit PROTOBUF_CONSTEXPR TensorProto_Segment(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TensorProto_Segment(const TensorProto_Segment& from);
   TensorProto_Segment(TensorProto_Segment&& from) noexcept
@@ -2182,8 +2290,13 @@ class TensorProto_Segment :
     return *this;
   }
   inline TensorProto_Segment& operator=(TensorProto_Segment&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2191,24 +2304,24 @@ class TensorProto_Segment :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorProto_Segment& default_instance() {
+    return *internal_default_instance();
   }
-  static const TensorProto_Segment& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TensorProto_Segment* internal_default_instance() {
     return reinterpret_cast<const TensorProto_Segment*>(
                &_TensorProto_Segment_default_instance_);
@@ -2221,57 +2334,66 @@ class TensorProto_Segment :
   }
   inline void Swap(TensorProto_Segment* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorProto_Segment* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TensorProto_Segment* New() const final {
-    return CreateMaybeMessage<TensorProto_Segment>(nullptr);
-  }
-
-  TensorProto_Segment* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TensorProto_Segment* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TensorProto_Segment>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TensorProto_Segment& from);
-  void MergeFrom(const TensorProto_Segment& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorProto_Segment& from) {
+    TensorProto_Segment::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TensorProto_Segment* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TensorProto.Segment";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TensorProto_Segment(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2287,11 +2409,11 @@ class TensorProto_Segment :
   bool _internal_has_begin() const;
   public:
   void clear_begin();
-  ::PROTOBUF_NAMESPACE_ID::int64 begin() const;
-  void set_begin(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t begin() const;
+  void set_begin(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_begin() const;
-  void _internal_set_begin(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_begin() const;
+  void _internal_set_begin(int64_t value);
   public:
 
   // optional int64 end = 2;
@@ -2300,31 +2422,37 @@ class TensorProto_Segment :
   bool _internal_has_end() const;
   public:
   void clear_end();
-  ::PROTOBUF_NAMESPACE_ID::int64 end() const;
-  void set_end(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t end() const;
+  void set_end(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_end() const;
-  void _internal_set_end(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_end() const;
+  void _internal_set_end(int64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:onnx.TensorProto.Segment)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::int64 begin_;
-  ::PROTOBUF_NAMESPACE_ID::int64 end_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int64_t begin_;
+    int64_t end_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TensorProto :
+class TensorProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TensorProto) */ {
  public:
-  TensorProto();
-  virtual ~TensorProto();
+  inline TensorProto() : TensorProto(nullptr) {}
+  ~TensorProto() override;
+  explicit PROTOBUF_CONSTEXPR TensorProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TensorProto(const TensorProto& from);
   TensorProto(TensorProto&& from) noexcept
@@ -2337,8 +2465,13 @@ class TensorProto :
     return *this;
   }
   inline TensorProto& operator=(TensorProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2346,24 +2479,24 @@ class TensorProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const TensorProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TensorProto* internal_default_instance() {
     return reinterpret_cast<const TensorProto*>(
                &_TensorProto_default_instance_);
@@ -2376,57 +2509,66 @@ class TensorProto :
   }
   inline void Swap(TensorProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TensorProto* New() const final {
-    return CreateMaybeMessage<TensorProto>(nullptr);
-  }
-
-  TensorProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TensorProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TensorProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TensorProto& from);
-  void MergeFrom(const TensorProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorProto& from) {
+    TensorProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TensorProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TensorProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TensorProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2487,7 +2629,7 @@ class TensorProto :
       "Incorrect type passed to function DataType_Name.");
     return TensorProto_DataType_Name(enum_t_value);
   }
-  static inline bool DataType_Parse(const std::string& name,
+  static inline bool DataType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DataType* value) {
     return TensorProto_DataType_Parse(name, value);
   }
@@ -2517,7 +2659,7 @@ class TensorProto :
       "Incorrect type passed to function DataLocation_Name.");
     return TensorProto_DataLocation_Name(enum_t_value);
   }
-  static inline bool DataLocation_Parse(const std::string& name,
+  static inline bool DataLocation_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DataLocation* value) {
     return TensorProto_DataLocation_Parse(name, value);
   }
@@ -2547,19 +2689,19 @@ class TensorProto :
   public:
   void clear_dims();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_dims(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t _internal_dims(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       _internal_dims() const;
-  void _internal_add_dims(::PROTOBUF_NAMESPACE_ID::int64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  void _internal_add_dims(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       _internal_mutable_dims();
   public:
-  ::PROTOBUF_NAMESPACE_ID::int64 dims(int index) const;
-  void set_dims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
-  void add_dims(::PROTOBUF_NAMESPACE_ID::int64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t dims(int index) const;
+  void set_dims(int index, int64_t value);
+  void add_dims(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       dims() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       mutable_dims();
 
   // repeated float float_data = 4 [packed = true];
@@ -2591,19 +2733,19 @@ class TensorProto :
   public:
   void clear_int32_data();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_int32_data(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+  int32_t _internal_int32_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       _internal_int32_data() const;
-  void _internal_add_int32_data(::PROTOBUF_NAMESPACE_ID::int32 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+  void _internal_add_int32_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       _internal_mutable_int32_data();
   public:
-  ::PROTOBUF_NAMESPACE_ID::int32 int32_data(int index) const;
-  void set_int32_data(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
-  void add_int32_data(::PROTOBUF_NAMESPACE_ID::int32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+  int32_t int32_data(int index) const;
+  void set_int32_data(int index, int32_t value);
+  void add_int32_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       int32_data() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_int32_data();
 
   // repeated bytes string_data = 6;
@@ -2637,19 +2779,19 @@ class TensorProto :
   public:
   void clear_int64_data();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_int64_data(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t _internal_int64_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       _internal_int64_data() const;
-  void _internal_add_int64_data(::PROTOBUF_NAMESPACE_ID::int64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  void _internal_add_int64_data(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       _internal_mutable_int64_data();
   public:
-  ::PROTOBUF_NAMESPACE_ID::int64 int64_data(int index) const;
-  void set_int64_data(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
-  void add_int64_data(::PROTOBUF_NAMESPACE_ID::int64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t int64_data(int index) const;
+  void set_int64_data(int index, int64_t value);
+  void add_int64_data(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       int64_data() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       mutable_int64_data();
 
   // repeated double double_data = 10 [packed = true];
@@ -2681,19 +2823,19 @@ class TensorProto :
   public:
   void clear_uint64_data();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_uint64_data(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t _internal_uint64_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       _internal_uint64_data() const;
-  void _internal_add_uint64_data(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  void _internal_add_uint64_data(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       _internal_mutable_uint64_data();
   public:
-  ::PROTOBUF_NAMESPACE_ID::uint64 uint64_data(int index) const;
-  void set_uint64_data(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
-  void add_uint64_data(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t uint64_data(int index) const;
+  void set_uint64_data(int index, uint64_t value);
+  void add_uint64_data(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       uint64_data() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_uint64_data();
 
   // repeated .onnx.StringStringEntryProto external_data = 13;
@@ -2721,16 +2863,14 @@ class TensorProto :
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -2741,16 +2881,14 @@ class TensorProto :
   public:
   void clear_raw_data();
   const std::string& raw_data() const;
-  void set_raw_data(const std::string& value);
-  void set_raw_data(std::string&& value);
-  void set_raw_data(const char* value);
-  void set_raw_data(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_raw_data(ArgT0&& arg0, ArgT... args);
   std::string* mutable_raw_data();
-  std::string* release_raw_data();
+  PROTOBUF_NODISCARD std::string* release_raw_data();
   void set_allocated_raw_data(std::string* raw_data);
   private:
   const std::string& _internal_raw_data() const;
-  void _internal_set_raw_data(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_raw_data(const std::string& value);
   std::string* _internal_mutable_raw_data();
   public:
 
@@ -2761,16 +2899,14 @@ class TensorProto :
   public:
   void clear_doc_string();
   const std::string& doc_string() const;
-  void set_doc_string(const std::string& value);
-  void set_doc_string(std::string&& value);
-  void set_doc_string(const char* value);
-  void set_doc_string(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_doc_string(ArgT0&& arg0, ArgT... args);
   std::string* mutable_doc_string();
-  std::string* release_doc_string();
+  PROTOBUF_NODISCARD std::string* release_doc_string();
   void set_allocated_doc_string(std::string* doc_string);
   private:
   const std::string& _internal_doc_string() const;
-  void _internal_set_doc_string(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_doc_string(const std::string& value);
   std::string* _internal_mutable_doc_string();
   public:
 
@@ -2781,13 +2917,16 @@ class TensorProto :
   public:
   void clear_segment();
   const ::onnx::TensorProto_Segment& segment() const;
-  ::onnx::TensorProto_Segment* release_segment();
+  PROTOBUF_NODISCARD ::onnx::TensorProto_Segment* release_segment();
   ::onnx::TensorProto_Segment* mutable_segment();
   void set_allocated_segment(::onnx::TensorProto_Segment* segment);
   private:
   const ::onnx::TensorProto_Segment& _internal_segment() const;
   ::onnx::TensorProto_Segment* _internal_mutable_segment();
   public:
+  void unsafe_arena_set_allocated_segment(
+      ::onnx::TensorProto_Segment* segment);
+  ::onnx::TensorProto_Segment* unsafe_arena_release_segment();
 
   // optional int32 data_type = 2;
   bool has_data_type() const;
@@ -2795,11 +2934,11 @@ class TensorProto :
   bool _internal_has_data_type() const;
   public:
   void clear_data_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 data_type() const;
-  void set_data_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t data_type() const;
+  void set_data_type(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_data_type() const;
-  void _internal_set_data_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_data_type() const;
+  void _internal_set_data_type(int32_t value);
   public:
 
   // optional .onnx.TensorProto.DataLocation data_location = 14;
@@ -2819,37 +2958,41 @@ class TensorProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > dims_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > float_data_;
-  mutable std::atomic<int> _float_data_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > int32_data_;
-  mutable std::atomic<int> _int32_data_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> string_data_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > int64_data_;
-  mutable std::atomic<int> _int64_data_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > double_data_;
-  mutable std::atomic<int> _double_data_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > uint64_data_;
-  mutable std::atomic<int> _uint64_data_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > external_data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr raw_data_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
-  ::onnx::TensorProto_Segment* segment_;
-  ::PROTOBUF_NAMESPACE_ID::int32 data_type_;
-  int data_location_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dims_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > float_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > int32_data_;
+    mutable std::atomic<int> _int32_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> string_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > int64_data_;
+    mutable std::atomic<int> _int64_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > double_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > uint64_data_;
+    mutable std::atomic<int> _uint64_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto > external_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr raw_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr doc_string_;
+    ::onnx::TensorProto_Segment* segment_;
+    int32_t data_type_;
+    int data_location_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SparseTensorProto :
+class SparseTensorProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.SparseTensorProto) */ {
  public:
-  SparseTensorProto();
-  virtual ~SparseTensorProto();
+  inline SparseTensorProto() : SparseTensorProto(nullptr) {}
+  ~SparseTensorProto() override;
+  explicit PROTOBUF_CONSTEXPR SparseTensorProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SparseTensorProto(const SparseTensorProto& from);
   SparseTensorProto(SparseTensorProto&& from) noexcept
@@ -2862,8 +3005,13 @@ class SparseTensorProto :
     return *this;
   }
   inline SparseTensorProto& operator=(SparseTensorProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2871,24 +3019,24 @@ class SparseTensorProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SparseTensorProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const SparseTensorProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const SparseTensorProto* internal_default_instance() {
     return reinterpret_cast<const SparseTensorProto*>(
                &_SparseTensorProto_default_instance_);
@@ -2901,57 +3049,66 @@ class SparseTensorProto :
   }
   inline void Swap(SparseTensorProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SparseTensorProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SparseTensorProto* New() const final {
-    return CreateMaybeMessage<SparseTensorProto>(nullptr);
-  }
-
-  SparseTensorProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SparseTensorProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SparseTensorProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SparseTensorProto& from);
-  void MergeFrom(const SparseTensorProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SparseTensorProto& from) {
+    SparseTensorProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SparseTensorProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.SparseTensorProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit SparseTensorProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -2969,19 +3126,19 @@ class SparseTensorProto :
   public:
   void clear_dims();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_dims(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t _internal_dims(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       _internal_dims() const;
-  void _internal_add_dims(::PROTOBUF_NAMESPACE_ID::int64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  void _internal_add_dims(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       _internal_mutable_dims();
   public:
-  ::PROTOBUF_NAMESPACE_ID::int64 dims(int index) const;
-  void set_dims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
-  void add_dims(::PROTOBUF_NAMESPACE_ID::int64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+  int64_t dims(int index) const;
+  void set_dims(int index, int64_t value);
+  void add_dims(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
       dims() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
       mutable_dims();
 
   // optional .onnx.TensorProto values = 1;
@@ -2991,13 +3148,16 @@ class SparseTensorProto :
   public:
   void clear_values();
   const ::onnx::TensorProto& values() const;
-  ::onnx::TensorProto* release_values();
+  PROTOBUF_NODISCARD ::onnx::TensorProto* release_values();
   ::onnx::TensorProto* mutable_values();
   void set_allocated_values(::onnx::TensorProto* values);
   private:
   const ::onnx::TensorProto& _internal_values() const;
   ::onnx::TensorProto* _internal_mutable_values();
   public:
+  void unsafe_arena_set_allocated_values(
+      ::onnx::TensorProto* values);
+  ::onnx::TensorProto* unsafe_arena_release_values();
 
   // optional .onnx.TensorProto indices = 2;
   bool has_indices() const;
@@ -3006,33 +3166,42 @@ class SparseTensorProto :
   public:
   void clear_indices();
   const ::onnx::TensorProto& indices() const;
-  ::onnx::TensorProto* release_indices();
+  PROTOBUF_NODISCARD ::onnx::TensorProto* release_indices();
   ::onnx::TensorProto* mutable_indices();
   void set_allocated_indices(::onnx::TensorProto* indices);
   private:
   const ::onnx::TensorProto& _internal_indices() const;
   ::onnx::TensorProto* _internal_mutable_indices();
   public:
+  void unsafe_arena_set_allocated_indices(
+      ::onnx::TensorProto* indices);
+  ::onnx::TensorProto* unsafe_arena_release_indices();
 
   // @@protoc_insertion_point(class_scope:onnx.SparseTensorProto)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > dims_;
-  ::onnx::TensorProto* values_;
-  ::onnx::TensorProto* indices_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > dims_;
+    ::onnx::TensorProto* values_;
+    ::onnx::TensorProto* indices_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TensorShapeProto_Dimension :
+class TensorShapeProto_Dimension final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TensorShapeProto.Dimension) */ {
  public:
-  TensorShapeProto_Dimension();
-  virtual ~TensorShapeProto_Dimension();
+  inline TensorShapeProto_Dimension() : TensorShapeProto_Dimension(nullptr) {}
+  ~TensorShapeProto_Dimension() override;
+  explicit PROTOBUF_CONSTEXPR TensorShapeProto_Dimension(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TensorShapeProto_Dimension(const TensorShapeProto_Dimension& from);
   TensorShapeProto_Dimension(TensorShapeProto_Dimension&& from) noexcept
@@ -3045,8 +3214,13 @@ class TensorShapeProto_Dimension :
     return *this;
   }
   inline TensorShapeProto_Dimension& operator=(TensorShapeProto_Dimension&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3054,30 +3228,30 @@ class TensorShapeProto_Dimension :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorShapeProto_Dimension& default_instance() {
+    return *internal_default_instance();
   }
-  static const TensorShapeProto_Dimension& default_instance();
-
   enum ValueCase {
     kDimValue = 1,
     kDimParam = 2,
     VALUE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TensorShapeProto_Dimension* internal_default_instance() {
     return reinterpret_cast<const TensorShapeProto_Dimension*>(
                &_TensorShapeProto_Dimension_default_instance_);
@@ -3090,57 +3264,66 @@ class TensorShapeProto_Dimension :
   }
   inline void Swap(TensorShapeProto_Dimension* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorShapeProto_Dimension* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TensorShapeProto_Dimension* New() const final {
-    return CreateMaybeMessage<TensorShapeProto_Dimension>(nullptr);
-  }
-
-  TensorShapeProto_Dimension* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TensorShapeProto_Dimension* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TensorShapeProto_Dimension>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TensorShapeProto_Dimension& from);
-  void MergeFrom(const TensorShapeProto_Dimension& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorShapeProto_Dimension& from) {
+    TensorShapeProto_Dimension::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TensorShapeProto_Dimension* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TensorShapeProto.Dimension";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TensorShapeProto_Dimension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3158,49 +3341,45 @@ class TensorShapeProto_Dimension :
   public:
   void clear_denotation();
   const std::string& denotation() const;
-  void set_denotation(const std::string& value);
-  void set_denotation(std::string&& value);
-  void set_denotation(const char* value);
-  void set_denotation(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_denotation(ArgT0&& arg0, ArgT... args);
   std::string* mutable_denotation();
-  std::string* release_denotation();
+  PROTOBUF_NODISCARD std::string* release_denotation();
   void set_allocated_denotation(std::string* denotation);
   private:
   const std::string& _internal_denotation() const;
-  void _internal_set_denotation(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_denotation(const std::string& value);
   std::string* _internal_mutable_denotation();
   public:
 
-  // optional int64 dim_value = 1;
+  // int64 dim_value = 1;
   bool has_dim_value() const;
   private:
   bool _internal_has_dim_value() const;
   public:
   void clear_dim_value();
-  ::PROTOBUF_NAMESPACE_ID::int64 dim_value() const;
-  void set_dim_value(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t dim_value() const;
+  void set_dim_value(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_dim_value() const;
-  void _internal_set_dim_value(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_dim_value() const;
+  void _internal_set_dim_value(int64_t value);
   public:
 
-  // optional string dim_param = 2;
+  // string dim_param = 2;
   bool has_dim_param() const;
   private:
   bool _internal_has_dim_param() const;
   public:
   void clear_dim_param();
   const std::string& dim_param() const;
-  void set_dim_param(const std::string& value);
-  void set_dim_param(std::string&& value);
-  void set_dim_param(const char* value);
-  void set_dim_param(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dim_param(ArgT0&& arg0, ArgT... args);
   std::string* mutable_dim_param();
-  std::string* release_dim_param();
+  PROTOBUF_NODISCARD std::string* release_dim_param();
   void set_allocated_dim_param(std::string* dim_param);
   private:
   const std::string& _internal_dim_param() const;
-  void _internal_set_dim_param(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dim_param(const std::string& value);
   std::string* _internal_mutable_dim_param();
   public:
 
@@ -3215,26 +3394,33 @@ class TensorShapeProto_Dimension :
   inline bool has_value() const;
   inline void clear_has_value();
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr denotation_;
-  union ValueUnion {
-    ValueUnion() {}
-    ::PROTOBUF_NAMESPACE_ID::int64 dim_value_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dim_param_;
-  } value_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr denotation_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      int64_t dim_value_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dim_param_;
+    } value_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TensorShapeProto :
+class TensorShapeProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TensorShapeProto) */ {
  public:
-  TensorShapeProto();
-  virtual ~TensorShapeProto();
+  inline TensorShapeProto() : TensorShapeProto(nullptr) {}
+  ~TensorShapeProto() override;
+  explicit PROTOBUF_CONSTEXPR TensorShapeProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TensorShapeProto(const TensorShapeProto& from);
   TensorShapeProto(TensorShapeProto&& from) noexcept
@@ -3247,8 +3433,13 @@ class TensorShapeProto :
     return *this;
   }
   inline TensorShapeProto& operator=(TensorShapeProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3256,24 +3447,24 @@ class TensorShapeProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorShapeProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const TensorShapeProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TensorShapeProto* internal_default_instance() {
     return reinterpret_cast<const TensorShapeProto*>(
                &_TensorShapeProto_default_instance_);
@@ -3286,57 +3477,66 @@ class TensorShapeProto :
   }
   inline void Swap(TensorShapeProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorShapeProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TensorShapeProto* New() const final {
-    return CreateMaybeMessage<TensorShapeProto>(nullptr);
-  }
-
-  TensorShapeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TensorShapeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TensorShapeProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TensorShapeProto& from);
-  void MergeFrom(const TensorShapeProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorShapeProto& from) {
+    TensorShapeProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TensorShapeProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TensorShapeProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TensorShapeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3369,19 +3569,24 @@ class TensorShapeProto :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorShapeProto_Dimension > dim_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorShapeProto_Dimension > dim_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TypeProto_Tensor :
+class TypeProto_Tensor final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TypeProto.Tensor) */ {
  public:
-  TypeProto_Tensor();
-  virtual ~TypeProto_Tensor();
+  inline TypeProto_Tensor() : TypeProto_Tensor(nullptr) {}
+  ~TypeProto_Tensor() override;
+  explicit PROTOBUF_CONSTEXPR TypeProto_Tensor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TypeProto_Tensor(const TypeProto_Tensor& from);
   TypeProto_Tensor(TypeProto_Tensor&& from) noexcept
@@ -3394,8 +3599,13 @@ class TypeProto_Tensor :
     return *this;
   }
   inline TypeProto_Tensor& operator=(TypeProto_Tensor&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3403,24 +3613,24 @@ class TypeProto_Tensor :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TypeProto_Tensor& default_instance() {
+    return *internal_default_instance();
   }
-  static const TypeProto_Tensor& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TypeProto_Tensor* internal_default_instance() {
     return reinterpret_cast<const TypeProto_Tensor*>(
                &_TypeProto_Tensor_default_instance_);
@@ -3433,57 +3643,66 @@ class TypeProto_Tensor :
   }
   inline void Swap(TypeProto_Tensor* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TypeProto_Tensor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TypeProto_Tensor* New() const final {
-    return CreateMaybeMessage<TypeProto_Tensor>(nullptr);
-  }
-
-  TypeProto_Tensor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TypeProto_Tensor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TypeProto_Tensor>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TypeProto_Tensor& from);
-  void MergeFrom(const TypeProto_Tensor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TypeProto_Tensor& from) {
+    TypeProto_Tensor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TypeProto_Tensor* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TypeProto.Tensor";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TypeProto_Tensor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3500,13 +3719,16 @@ class TypeProto_Tensor :
   public:
   void clear_shape();
   const ::onnx::TensorShapeProto& shape() const;
-  ::onnx::TensorShapeProto* release_shape();
+  PROTOBUF_NODISCARD ::onnx::TensorShapeProto* release_shape();
   ::onnx::TensorShapeProto* mutable_shape();
   void set_allocated_shape(::onnx::TensorShapeProto* shape);
   private:
   const ::onnx::TensorShapeProto& _internal_shape() const;
   ::onnx::TensorShapeProto* _internal_mutable_shape();
   public:
+  void unsafe_arena_set_allocated_shape(
+      ::onnx::TensorShapeProto* shape);
+  ::onnx::TensorShapeProto* unsafe_arena_release_shape();
 
   // optional int32 elem_type = 1;
   bool has_elem_type() const;
@@ -3514,31 +3736,37 @@ class TypeProto_Tensor :
   bool _internal_has_elem_type() const;
   public:
   void clear_elem_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 elem_type() const;
-  void set_elem_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t elem_type() const;
+  void set_elem_type(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_elem_type() const;
-  void _internal_set_elem_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_elem_type() const;
+  void _internal_set_elem_type(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:onnx.TypeProto.Tensor)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::onnx::TensorShapeProto* shape_;
-  ::PROTOBUF_NAMESPACE_ID::int32 elem_type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::onnx::TensorShapeProto* shape_;
+    int32_t elem_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TypeProto_Sequence :
+class TypeProto_Sequence final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TypeProto.Sequence) */ {
  public:
-  TypeProto_Sequence();
-  virtual ~TypeProto_Sequence();
+  inline TypeProto_Sequence() : TypeProto_Sequence(nullptr) {}
+  ~TypeProto_Sequence() override;
+  explicit PROTOBUF_CONSTEXPR TypeProto_Sequence(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TypeProto_Sequence(const TypeProto_Sequence& from);
   TypeProto_Sequence(TypeProto_Sequence&& from) noexcept
@@ -3551,8 +3779,13 @@ class TypeProto_Sequence :
     return *this;
   }
   inline TypeProto_Sequence& operator=(TypeProto_Sequence&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3560,24 +3793,24 @@ class TypeProto_Sequence :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TypeProto_Sequence& default_instance() {
+    return *internal_default_instance();
   }
-  static const TypeProto_Sequence& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TypeProto_Sequence* internal_default_instance() {
     return reinterpret_cast<const TypeProto_Sequence*>(
                &_TypeProto_Sequence_default_instance_);
@@ -3590,57 +3823,66 @@ class TypeProto_Sequence :
   }
   inline void Swap(TypeProto_Sequence* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TypeProto_Sequence* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TypeProto_Sequence* New() const final {
-    return CreateMaybeMessage<TypeProto_Sequence>(nullptr);
-  }
-
-  TypeProto_Sequence* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TypeProto_Sequence* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TypeProto_Sequence>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TypeProto_Sequence& from);
-  void MergeFrom(const TypeProto_Sequence& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TypeProto_Sequence& from) {
+    TypeProto_Sequence::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TypeProto_Sequence* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TypeProto.Sequence";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TypeProto_Sequence(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3656,31 +3898,40 @@ class TypeProto_Sequence :
   public:
   void clear_elem_type();
   const ::onnx::TypeProto& elem_type() const;
-  ::onnx::TypeProto* release_elem_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto* release_elem_type();
   ::onnx::TypeProto* mutable_elem_type();
   void set_allocated_elem_type(::onnx::TypeProto* elem_type);
   private:
   const ::onnx::TypeProto& _internal_elem_type() const;
   ::onnx::TypeProto* _internal_mutable_elem_type();
   public:
+  void unsafe_arena_set_allocated_elem_type(
+      ::onnx::TypeProto* elem_type);
+  ::onnx::TypeProto* unsafe_arena_release_elem_type();
 
   // @@protoc_insertion_point(class_scope:onnx.TypeProto.Sequence)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::onnx::TypeProto* elem_type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::onnx::TypeProto* elem_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TypeProto_Map :
+class TypeProto_Map final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TypeProto.Map) */ {
  public:
-  TypeProto_Map();
-  virtual ~TypeProto_Map();
+  inline TypeProto_Map() : TypeProto_Map(nullptr) {}
+  ~TypeProto_Map() override;
+  explicit PROTOBUF_CONSTEXPR TypeProto_Map(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TypeProto_Map(const TypeProto_Map& from);
   TypeProto_Map(TypeProto_Map&& from) noexcept
@@ -3693,8 +3944,13 @@ class TypeProto_Map :
     return *this;
   }
   inline TypeProto_Map& operator=(TypeProto_Map&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3702,24 +3958,24 @@ class TypeProto_Map :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TypeProto_Map& default_instance() {
+    return *internal_default_instance();
   }
-  static const TypeProto_Map& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TypeProto_Map* internal_default_instance() {
     return reinterpret_cast<const TypeProto_Map*>(
                &_TypeProto_Map_default_instance_);
@@ -3732,57 +3988,66 @@ class TypeProto_Map :
   }
   inline void Swap(TypeProto_Map* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TypeProto_Map* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TypeProto_Map* New() const final {
-    return CreateMaybeMessage<TypeProto_Map>(nullptr);
-  }
-
-  TypeProto_Map* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TypeProto_Map* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TypeProto_Map>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TypeProto_Map& from);
-  void MergeFrom(const TypeProto_Map& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TypeProto_Map& from) {
+    TypeProto_Map::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TypeProto_Map* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TypeProto.Map";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TypeProto_Map(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3799,13 +4064,16 @@ class TypeProto_Map :
   public:
   void clear_value_type();
   const ::onnx::TypeProto& value_type() const;
-  ::onnx::TypeProto* release_value_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto* release_value_type();
   ::onnx::TypeProto* mutable_value_type();
   void set_allocated_value_type(::onnx::TypeProto* value_type);
   private:
   const ::onnx::TypeProto& _internal_value_type() const;
   ::onnx::TypeProto* _internal_mutable_value_type();
   public:
+  void unsafe_arena_set_allocated_value_type(
+      ::onnx::TypeProto* value_type);
+  ::onnx::TypeProto* unsafe_arena_release_value_type();
 
   // optional int32 key_type = 1;
   bool has_key_type() const;
@@ -3813,31 +4081,37 @@ class TypeProto_Map :
   bool _internal_has_key_type() const;
   public:
   void clear_key_type();
-  ::PROTOBUF_NAMESPACE_ID::int32 key_type() const;
-  void set_key_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t key_type() const;
+  void set_key_type(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_key_type() const;
-  void _internal_set_key_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_key_type() const;
+  void _internal_set_key_type(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:onnx.TypeProto.Map)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::onnx::TypeProto* value_type_;
-  ::PROTOBUF_NAMESPACE_ID::int32 key_type_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::onnx::TypeProto* value_type_;
+    int32_t key_type_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TypeProto :
+class TypeProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.TypeProto) */ {
  public:
-  TypeProto();
-  virtual ~TypeProto();
+  inline TypeProto() : TypeProto(nullptr) {}
+  ~TypeProto() override;
+  explicit PROTOBUF_CONSTEXPR TypeProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TypeProto(const TypeProto& from);
   TypeProto(TypeProto&& from) noexcept
@@ -3850,8 +4124,13 @@ class TypeProto :
     return *this;
   }
   inline TypeProto& operator=(TypeProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -3859,23 +4138,24 @@ class TypeProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TypeProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const TypeProto& default_instance();
-
   enum ValueCase {
     kTensorType = 1,
     kSequenceType = 4,
@@ -3883,7 +4163,6 @@ class TypeProto :
     VALUE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const TypeProto* internal_default_instance() {
     return reinterpret_cast<const TypeProto*>(
                &_TypeProto_default_instance_);
@@ -3896,57 +4175,66 @@ class TypeProto :
   }
   inline void Swap(TypeProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TypeProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TypeProto* New() const final {
-    return CreateMaybeMessage<TypeProto>(nullptr);
-  }
-
-  TypeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TypeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TypeProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TypeProto& from);
-  void MergeFrom(const TypeProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TypeProto& from) {
+    TypeProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TypeProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.TypeProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit TypeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3969,63 +4257,70 @@ class TypeProto :
   public:
   void clear_denotation();
   const std::string& denotation() const;
-  void set_denotation(const std::string& value);
-  void set_denotation(std::string&& value);
-  void set_denotation(const char* value);
-  void set_denotation(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_denotation(ArgT0&& arg0, ArgT... args);
   std::string* mutable_denotation();
-  std::string* release_denotation();
+  PROTOBUF_NODISCARD std::string* release_denotation();
   void set_allocated_denotation(std::string* denotation);
   private:
   const std::string& _internal_denotation() const;
-  void _internal_set_denotation(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_denotation(const std::string& value);
   std::string* _internal_mutable_denotation();
   public:
 
-  // optional .onnx.TypeProto.Tensor tensor_type = 1;
+  // .onnx.TypeProto.Tensor tensor_type = 1;
   bool has_tensor_type() const;
   private:
   bool _internal_has_tensor_type() const;
   public:
   void clear_tensor_type();
   const ::onnx::TypeProto_Tensor& tensor_type() const;
-  ::onnx::TypeProto_Tensor* release_tensor_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto_Tensor* release_tensor_type();
   ::onnx::TypeProto_Tensor* mutable_tensor_type();
   void set_allocated_tensor_type(::onnx::TypeProto_Tensor* tensor_type);
   private:
   const ::onnx::TypeProto_Tensor& _internal_tensor_type() const;
   ::onnx::TypeProto_Tensor* _internal_mutable_tensor_type();
   public:
+  void unsafe_arena_set_allocated_tensor_type(
+      ::onnx::TypeProto_Tensor* tensor_type);
+  ::onnx::TypeProto_Tensor* unsafe_arena_release_tensor_type();
 
-  // optional .onnx.TypeProto.Sequence sequence_type = 4;
+  // .onnx.TypeProto.Sequence sequence_type = 4;
   bool has_sequence_type() const;
   private:
   bool _internal_has_sequence_type() const;
   public:
   void clear_sequence_type();
   const ::onnx::TypeProto_Sequence& sequence_type() const;
-  ::onnx::TypeProto_Sequence* release_sequence_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto_Sequence* release_sequence_type();
   ::onnx::TypeProto_Sequence* mutable_sequence_type();
   void set_allocated_sequence_type(::onnx::TypeProto_Sequence* sequence_type);
   private:
   const ::onnx::TypeProto_Sequence& _internal_sequence_type() const;
   ::onnx::TypeProto_Sequence* _internal_mutable_sequence_type();
   public:
+  void unsafe_arena_set_allocated_sequence_type(
+      ::onnx::TypeProto_Sequence* sequence_type);
+  ::onnx::TypeProto_Sequence* unsafe_arena_release_sequence_type();
 
-  // optional .onnx.TypeProto.Map map_type = 5;
+  // .onnx.TypeProto.Map map_type = 5;
   bool has_map_type() const;
   private:
   bool _internal_has_map_type() const;
   public:
   void clear_map_type();
   const ::onnx::TypeProto_Map& map_type() const;
-  ::onnx::TypeProto_Map* release_map_type();
+  PROTOBUF_NODISCARD ::onnx::TypeProto_Map* release_map_type();
   ::onnx::TypeProto_Map* mutable_map_type();
   void set_allocated_map_type(::onnx::TypeProto_Map* map_type);
   private:
   const ::onnx::TypeProto_Map& _internal_map_type() const;
   ::onnx::TypeProto_Map* _internal_mutable_map_type();
   public:
+  void unsafe_arena_set_allocated_map_type(
+      ::onnx::TypeProto_Map* map_type);
+  ::onnx::TypeProto_Map* unsafe_arena_release_map_type();
 
   void clear_value();
   ValueCase value_case() const;
@@ -4039,27 +4334,34 @@ class TypeProto :
   inline bool has_value() const;
   inline void clear_has_value();
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr denotation_;
-  union ValueUnion {
-    ValueUnion() {}
-    ::onnx::TypeProto_Tensor* tensor_type_;
-    ::onnx::TypeProto_Sequence* sequence_type_;
-    ::onnx::TypeProto_Map* map_type_;
-  } value_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr denotation_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::onnx::TypeProto_Tensor* tensor_type_;
+      ::onnx::TypeProto_Sequence* sequence_type_;
+      ::onnx::TypeProto_Map* map_type_;
+    } value_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OperatorSetIdProto :
+class OperatorSetIdProto final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:onnx.OperatorSetIdProto) */ {
  public:
-  OperatorSetIdProto();
-  virtual ~OperatorSetIdProto();
+  inline OperatorSetIdProto() : OperatorSetIdProto(nullptr) {}
+  ~OperatorSetIdProto() override;
+  explicit PROTOBUF_CONSTEXPR OperatorSetIdProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   OperatorSetIdProto(const OperatorSetIdProto& from);
   OperatorSetIdProto(OperatorSetIdProto&& from) noexcept
@@ -4072,8 +4374,13 @@ class OperatorSetIdProto :
     return *this;
   }
   inline OperatorSetIdProto& operator=(OperatorSetIdProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -4081,24 +4388,24 @@ class OperatorSetIdProto :
   }
 
   inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
   inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OperatorSetIdProto& default_instance() {
+    return *internal_default_instance();
   }
-  static const OperatorSetIdProto& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const OperatorSetIdProto* internal_default_instance() {
     return reinterpret_cast<const OperatorSetIdProto*>(
                &_OperatorSetIdProto_default_instance_);
@@ -4111,57 +4418,66 @@ class OperatorSetIdProto :
   }
   inline void Swap(OperatorSetIdProto* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OperatorSetIdProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline OperatorSetIdProto* New() const final {
-    return CreateMaybeMessage<OperatorSetIdProto>(nullptr);
-  }
-
-  OperatorSetIdProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  OperatorSetIdProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<OperatorSetIdProto>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const OperatorSetIdProto& from);
-  void MergeFrom(const OperatorSetIdProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OperatorSetIdProto& from) {
+    OperatorSetIdProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(OperatorSetIdProto* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "onnx.OperatorSetIdProto";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit OperatorSetIdProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_onnx_2eproto);
-    return ::descriptor_table_onnx_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4178,16 +4494,14 @@ class OperatorSetIdProto :
   public:
   void clear_domain();
   const std::string& domain() const;
-  void set_domain(const std::string& value);
-  void set_domain(std::string&& value);
-  void set_domain(const char* value);
-  void set_domain(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_domain(ArgT0&& arg0, ArgT... args);
   std::string* mutable_domain();
-  std::string* release_domain();
+  PROTOBUF_NODISCARD std::string* release_domain();
   void set_allocated_domain(std::string* domain);
   private:
   const std::string& _internal_domain() const;
-  void _internal_set_domain(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_domain(const std::string& value);
   std::string* _internal_mutable_domain();
   public:
 
@@ -4197,22 +4511,27 @@ class OperatorSetIdProto :
   bool _internal_has_version() const;
   public:
   void clear_version();
-  ::PROTOBUF_NAMESPACE_ID::int64 version() const;
-  void set_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t version() const;
+  void set_version(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_version() const;
-  void _internal_set_version(::PROTOBUF_NAMESPACE_ID::int64 value);
+  int64_t _internal_version() const;
+  void _internal_set_version(int64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:onnx.OperatorSetIdProto)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
-  ::PROTOBUF_NAMESPACE_ID::int64 version_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr domain_;
+    int64_t version_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_onnx_2eproto;
 };
 // ===================================================================
@@ -4228,231 +4547,222 @@ class OperatorSetIdProto :
 
 // optional string name = 1;
 inline bool AttributeProto::_internal_has_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool AttributeProto::has_name() const {
   return _internal_has_name();
 }
 inline void AttributeProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& AttributeProto::name() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.name)
   return _internal_name();
 }
-inline void AttributeProto::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttributeProto::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.name)
 }
 inline std::string* AttributeProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& AttributeProto::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void AttributeProto::_internal_set_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void AttributeProto::set_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.AttributeProto.name)
-}
-inline void AttributeProto::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.AttributeProto.name)
-}
-inline void AttributeProto::set_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.AttributeProto.name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AttributeProto::_internal_mutable_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AttributeProto::release_name() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void AttributeProto::set_allocated_name(std::string* name) {
   if (name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.name)
 }
 
 // optional string ref_attr_name = 21;
 inline bool AttributeProto::_internal_has_ref_attr_name() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool AttributeProto::has_ref_attr_name() const {
   return _internal_has_ref_attr_name();
 }
 inline void AttributeProto::clear_ref_attr_name() {
-  ref_attr_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.ref_attr_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& AttributeProto::ref_attr_name() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.ref_attr_name)
   return _internal_ref_attr_name();
 }
-inline void AttributeProto::set_ref_attr_name(const std::string& value) {
-  _internal_set_ref_attr_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttributeProto::set_ref_attr_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.ref_attr_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.ref_attr_name)
 }
 inline std::string* AttributeProto::mutable_ref_attr_name() {
+  std::string* _s = _internal_mutable_ref_attr_name();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.ref_attr_name)
-  return _internal_mutable_ref_attr_name();
+  return _s;
 }
 inline const std::string& AttributeProto::_internal_ref_attr_name() const {
-  return ref_attr_name_.GetNoArena();
+  return _impl_.ref_attr_name_.Get();
 }
 inline void AttributeProto::_internal_set_ref_attr_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  ref_attr_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void AttributeProto::set_ref_attr_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  ref_attr_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.AttributeProto.ref_attr_name)
-}
-inline void AttributeProto::set_ref_attr_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  ref_attr_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.AttributeProto.ref_attr_name)
-}
-inline void AttributeProto::set_ref_attr_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  ref_attr_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.AttributeProto.ref_attr_name)
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.ref_attr_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AttributeProto::_internal_mutable_ref_attr_name() {
-  _has_bits_[0] |= 0x00000008u;
-  return ref_attr_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.ref_attr_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AttributeProto::release_ref_attr_name() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.ref_attr_name)
   if (!_internal_has_ref_attr_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  return ref_attr_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.ref_attr_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ref_attr_name_.IsDefault()) {
+    _impl_.ref_attr_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void AttributeProto::set_allocated_ref_attr_name(std::string* ref_attr_name) {
   if (ref_attr_name != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.ref_attr_name_.SetAllocated(ref_attr_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ref_attr_name_.IsDefault()) {
+    _impl_.ref_attr_name_.Set("", GetArenaForAllocation());
   }
-  ref_attr_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ref_attr_name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.ref_attr_name)
 }
 
 // optional string doc_string = 13;
 inline bool AttributeProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool AttributeProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void AttributeProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& AttributeProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.doc_string)
   return _internal_doc_string();
 }
-inline void AttributeProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttributeProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.doc_string)
 }
 inline std::string* AttributeProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& AttributeProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void AttributeProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void AttributeProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.AttributeProto.doc_string)
-}
-inline void AttributeProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.AttributeProto.doc_string)
-}
-inline void AttributeProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.AttributeProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AttributeProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000004u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AttributeProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void AttributeProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.doc_string)
 }
 
 // optional .onnx.AttributeProto.AttributeType type = 20;
 inline bool AttributeProto::_internal_has_type() const {
-  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
   return value;
 }
 inline bool AttributeProto::has_type() const {
   return _internal_has_type();
 }
 inline void AttributeProto::clear_type() {
-  type_ = 0;
-  _has_bits_[0] &= ~0x00000200u;
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
 }
 inline ::onnx::AttributeProto_AttributeType AttributeProto::_internal_type() const {
-  return static_cast< ::onnx::AttributeProto_AttributeType >(type_);
+  return static_cast< ::onnx::AttributeProto_AttributeType >(_impl_.type_);
 }
 inline ::onnx::AttributeProto_AttributeType AttributeProto::type() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.type)
@@ -4460,8 +4770,8 @@ inline ::onnx::AttributeProto_AttributeType AttributeProto::type() const {
 }
 inline void AttributeProto::_internal_set_type(::onnx::AttributeProto_AttributeType value) {
   assert(::onnx::AttributeProto_AttributeType_IsValid(value));
-  _has_bits_[0] |= 0x00000200u;
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.type_ = value;
 }
 inline void AttributeProto::set_type(::onnx::AttributeProto_AttributeType value) {
   _internal_set_type(value);
@@ -4470,26 +4780,26 @@ inline void AttributeProto::set_type(::onnx::AttributeProto_AttributeType value)
 
 // optional float f = 2;
 inline bool AttributeProto::_internal_has_f() const {
-  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
   return value;
 }
 inline bool AttributeProto::has_f() const {
   return _internal_has_f();
 }
 inline void AttributeProto::clear_f() {
-  f_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
+  _impl_.f_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
 inline float AttributeProto::_internal_f() const {
-  return f_;
+  return _impl_.f_;
 }
 inline float AttributeProto::f() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.f)
   return _internal_f();
 }
 inline void AttributeProto::_internal_set_f(float value) {
-  _has_bits_[0] |= 0x00000100u;
-  f_ = value;
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.f_ = value;
 }
 inline void AttributeProto::set_f(float value) {
   _internal_set_f(value);
@@ -4498,306 +4808,393 @@ inline void AttributeProto::set_f(float value) {
 
 // optional int64 i = 3;
 inline bool AttributeProto::_internal_has_i() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool AttributeProto::has_i() const {
   return _internal_has_i();
 }
 inline void AttributeProto::clear_i() {
-  i_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000080u;
+  _impl_.i_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 AttributeProto::_internal_i() const {
-  return i_;
+inline int64_t AttributeProto::_internal_i() const {
+  return _impl_.i_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 AttributeProto::i() const {
+inline int64_t AttributeProto::i() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.i)
   return _internal_i();
 }
-inline void AttributeProto::_internal_set_i(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000080u;
-  i_ = value;
+inline void AttributeProto::_internal_set_i(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.i_ = value;
 }
-inline void AttributeProto::set_i(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void AttributeProto::set_i(int64_t value) {
   _internal_set_i(value);
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.i)
 }
 
 // optional bytes s = 4;
 inline bool AttributeProto::_internal_has_s() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool AttributeProto::has_s() const {
   return _internal_has_s();
 }
 inline void AttributeProto::clear_s() {
-  s_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.s_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& AttributeProto::s() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.s)
   return _internal_s();
 }
-inline void AttributeProto::set_s(const std::string& value) {
-  _internal_set_s(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AttributeProto::set_s(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.s_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.s)
 }
 inline std::string* AttributeProto::mutable_s() {
+  std::string* _s = _internal_mutable_s();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.s)
-  return _internal_mutable_s();
+  return _s;
 }
 inline const std::string& AttributeProto::_internal_s() const {
-  return s_.GetNoArena();
+  return _impl_.s_.Get();
 }
 inline void AttributeProto::_internal_set_s(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  s_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void AttributeProto::set_s(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  s_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.AttributeProto.s)
-}
-inline void AttributeProto::set_s(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  s_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.AttributeProto.s)
-}
-inline void AttributeProto::set_s(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  s_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.AttributeProto.s)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.s_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AttributeProto::_internal_mutable_s() {
-  _has_bits_[0] |= 0x00000002u;
-  return s_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.s_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AttributeProto::release_s() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.s)
   if (!_internal_has_s()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return s_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.s_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.s_.IsDefault()) {
+    _impl_.s_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void AttributeProto::set_allocated_s(std::string* s) {
   if (s != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.s_.SetAllocated(s, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.s_.IsDefault()) {
+    _impl_.s_.Set("", GetArenaForAllocation());
   }
-  s_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), s);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.s)
 }
 
 // optional .onnx.TensorProto t = 5;
 inline bool AttributeProto::_internal_has_t() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || t_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.t_ != nullptr);
   return value;
 }
 inline bool AttributeProto::has_t() const {
   return _internal_has_t();
 }
 inline void AttributeProto::clear_t() {
-  if (t_ != nullptr) t_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  if (_impl_.t_ != nullptr) _impl_.t_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::onnx::TensorProto& AttributeProto::_internal_t() const {
-  const ::onnx::TensorProto* p = t_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TensorProto*>(
-      &::onnx::_TensorProto_default_instance_);
+  const ::onnx::TensorProto* p = _impl_.t_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TensorProto&>(
+      ::onnx::_TensorProto_default_instance_);
 }
 inline const ::onnx::TensorProto& AttributeProto::t() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.t)
   return _internal_t();
 }
+inline void AttributeProto::unsafe_arena_set_allocated_t(
+    ::onnx::TensorProto* t) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.t_);
+  }
+  _impl_.t_ = t;
+  if (t) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.AttributeProto.t)
+}
 inline ::onnx::TensorProto* AttributeProto::release_t() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::onnx::TensorProto* temp = _impl_.t_;
+  _impl_.t_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TensorProto* AttributeProto::unsafe_arena_release_t() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.t)
-  _has_bits_[0] &= ~0x00000010u;
-  ::onnx::TensorProto* temp = t_;
-  t_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::onnx::TensorProto* temp = _impl_.t_;
+  _impl_.t_ = nullptr;
   return temp;
 }
 inline ::onnx::TensorProto* AttributeProto::_internal_mutable_t() {
-  _has_bits_[0] |= 0x00000010u;
-  if (t_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaNoVirtual());
-    t_ = p;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.t_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaForAllocation());
+    _impl_.t_ = p;
   }
-  return t_;
+  return _impl_.t_;
 }
 inline ::onnx::TensorProto* AttributeProto::mutable_t() {
+  ::onnx::TensorProto* _msg = _internal_mutable_t();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.t)
-  return _internal_mutable_t();
+  return _msg;
 }
 inline void AttributeProto::set_allocated_t(::onnx::TensorProto* t) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete t_;
+    delete _impl_.t_;
   }
   if (t) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(t);
     if (message_arena != submessage_arena) {
       t = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, t, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  t_ = t;
+  _impl_.t_ = t;
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.t)
 }
 
 // optional .onnx.GraphProto g = 6;
 inline bool AttributeProto::_internal_has_g() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
-  PROTOBUF_ASSUME(!value || g_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.g_ != nullptr);
   return value;
 }
 inline bool AttributeProto::has_g() const {
   return _internal_has_g();
 }
 inline void AttributeProto::clear_g() {
-  if (g_ != nullptr) g_->Clear();
-  _has_bits_[0] &= ~0x00000020u;
+  if (_impl_.g_ != nullptr) _impl_.g_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline const ::onnx::GraphProto& AttributeProto::_internal_g() const {
-  const ::onnx::GraphProto* p = g_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::GraphProto*>(
-      &::onnx::_GraphProto_default_instance_);
+  const ::onnx::GraphProto* p = _impl_.g_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::GraphProto&>(
+      ::onnx::_GraphProto_default_instance_);
 }
 inline const ::onnx::GraphProto& AttributeProto::g() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.g)
   return _internal_g();
 }
+inline void AttributeProto::unsafe_arena_set_allocated_g(
+    ::onnx::GraphProto* g) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.g_);
+  }
+  _impl_.g_ = g;
+  if (g) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.AttributeProto.g)
+}
 inline ::onnx::GraphProto* AttributeProto::release_g() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::onnx::GraphProto* temp = _impl_.g_;
+  _impl_.g_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::GraphProto* AttributeProto::unsafe_arena_release_g() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.g)
-  _has_bits_[0] &= ~0x00000020u;
-  ::onnx::GraphProto* temp = g_;
-  g_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::onnx::GraphProto* temp = _impl_.g_;
+  _impl_.g_ = nullptr;
   return temp;
 }
 inline ::onnx::GraphProto* AttributeProto::_internal_mutable_g() {
-  _has_bits_[0] |= 0x00000020u;
-  if (g_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::GraphProto>(GetArenaNoVirtual());
-    g_ = p;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.g_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::GraphProto>(GetArenaForAllocation());
+    _impl_.g_ = p;
   }
-  return g_;
+  return _impl_.g_;
 }
 inline ::onnx::GraphProto* AttributeProto::mutable_g() {
+  ::onnx::GraphProto* _msg = _internal_mutable_g();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.g)
-  return _internal_mutable_g();
+  return _msg;
 }
 inline void AttributeProto::set_allocated_g(::onnx::GraphProto* g) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete g_;
+    delete _impl_.g_;
   }
   if (g) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(g);
     if (message_arena != submessage_arena) {
       g = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, g, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000020u;
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
-  g_ = g;
+  _impl_.g_ = g;
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.g)
 }
 
 // optional .onnx.SparseTensorProto sparse_tensor = 22;
 inline bool AttributeProto::_internal_has_sparse_tensor() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
-  PROTOBUF_ASSUME(!value || sparse_tensor_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.sparse_tensor_ != nullptr);
   return value;
 }
 inline bool AttributeProto::has_sparse_tensor() const {
   return _internal_has_sparse_tensor();
 }
 inline void AttributeProto::clear_sparse_tensor() {
-  if (sparse_tensor_ != nullptr) sparse_tensor_->Clear();
-  _has_bits_[0] &= ~0x00000040u;
+  if (_impl_.sparse_tensor_ != nullptr) _impl_.sparse_tensor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
 inline const ::onnx::SparseTensorProto& AttributeProto::_internal_sparse_tensor() const {
-  const ::onnx::SparseTensorProto* p = sparse_tensor_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::SparseTensorProto*>(
-      &::onnx::_SparseTensorProto_default_instance_);
+  const ::onnx::SparseTensorProto* p = _impl_.sparse_tensor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::SparseTensorProto&>(
+      ::onnx::_SparseTensorProto_default_instance_);
 }
 inline const ::onnx::SparseTensorProto& AttributeProto::sparse_tensor() const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.sparse_tensor)
   return _internal_sparse_tensor();
 }
+inline void AttributeProto::unsafe_arena_set_allocated_sparse_tensor(
+    ::onnx::SparseTensorProto* sparse_tensor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.sparse_tensor_);
+  }
+  _impl_.sparse_tensor_ = sparse_tensor;
+  if (sparse_tensor) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.AttributeProto.sparse_tensor)
+}
 inline ::onnx::SparseTensorProto* AttributeProto::release_sparse_tensor() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::onnx::SparseTensorProto* temp = _impl_.sparse_tensor_;
+  _impl_.sparse_tensor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::SparseTensorProto* AttributeProto::unsafe_arena_release_sparse_tensor() {
   // @@protoc_insertion_point(field_release:onnx.AttributeProto.sparse_tensor)
-  _has_bits_[0] &= ~0x00000040u;
-  ::onnx::SparseTensorProto* temp = sparse_tensor_;
-  sparse_tensor_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::onnx::SparseTensorProto* temp = _impl_.sparse_tensor_;
+  _impl_.sparse_tensor_ = nullptr;
   return temp;
 }
 inline ::onnx::SparseTensorProto* AttributeProto::_internal_mutable_sparse_tensor() {
-  _has_bits_[0] |= 0x00000040u;
-  if (sparse_tensor_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::SparseTensorProto>(GetArenaNoVirtual());
-    sparse_tensor_ = p;
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.sparse_tensor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::SparseTensorProto>(GetArenaForAllocation());
+    _impl_.sparse_tensor_ = p;
   }
-  return sparse_tensor_;
+  return _impl_.sparse_tensor_;
 }
 inline ::onnx::SparseTensorProto* AttributeProto::mutable_sparse_tensor() {
+  ::onnx::SparseTensorProto* _msg = _internal_mutable_sparse_tensor();
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.sparse_tensor)
-  return _internal_mutable_sparse_tensor();
+  return _msg;
 }
 inline void AttributeProto::set_allocated_sparse_tensor(::onnx::SparseTensorProto* sparse_tensor) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete sparse_tensor_;
+    delete _impl_.sparse_tensor_;
   }
   if (sparse_tensor) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(sparse_tensor);
     if (message_arena != submessage_arena) {
       sparse_tensor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, sparse_tensor, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000040u;
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
-  sparse_tensor_ = sparse_tensor;
+  _impl_.sparse_tensor_ = sparse_tensor;
   // @@protoc_insertion_point(field_set_allocated:onnx.AttributeProto.sparse_tensor)
 }
 
 // repeated float floats = 7;
 inline int AttributeProto::_internal_floats_size() const {
-  return floats_.size();
+  return _impl_.floats_.size();
 }
 inline int AttributeProto::floats_size() const {
   return _internal_floats_size();
 }
 inline void AttributeProto::clear_floats() {
-  floats_.Clear();
+  _impl_.floats_.Clear();
 }
 inline float AttributeProto::_internal_floats(int index) const {
-  return floats_.Get(index);
+  return _impl_.floats_.Get(index);
 }
 inline float AttributeProto::floats(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.floats)
   return _internal_floats(index);
 }
 inline void AttributeProto::set_floats(int index, float value) {
-  floats_.Set(index, value);
+  _impl_.floats_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.floats)
 }
 inline void AttributeProto::_internal_add_floats(float value) {
-  floats_.Add(value);
+  _impl_.floats_.Add(value);
 }
 inline void AttributeProto::add_floats(float value) {
   _internal_add_floats(value);
@@ -4805,7 +5202,7 @@ inline void AttributeProto::add_floats(float value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 AttributeProto::_internal_floats() const {
-  return floats_;
+  return _impl_.floats_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 AttributeProto::floats() const {
@@ -4814,7 +5211,7 @@ AttributeProto::floats() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 AttributeProto::_internal_mutable_floats() {
-  return &floats_;
+  return &_impl_.floats_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 AttributeProto::mutable_floats() {
@@ -4824,46 +5221,46 @@ AttributeProto::mutable_floats() {
 
 // repeated int64 ints = 8;
 inline int AttributeProto::_internal_ints_size() const {
-  return ints_.size();
+  return _impl_.ints_.size();
 }
 inline int AttributeProto::ints_size() const {
   return _internal_ints_size();
 }
 inline void AttributeProto::clear_ints() {
-  ints_.Clear();
+  _impl_.ints_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 AttributeProto::_internal_ints(int index) const {
-  return ints_.Get(index);
+inline int64_t AttributeProto::_internal_ints(int index) const {
+  return _impl_.ints_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 AttributeProto::ints(int index) const {
+inline int64_t AttributeProto::ints(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.ints)
   return _internal_ints(index);
 }
-inline void AttributeProto::set_ints(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  ints_.Set(index, value);
+inline void AttributeProto::set_ints(int index, int64_t value) {
+  _impl_.ints_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.ints)
 }
-inline void AttributeProto::_internal_add_ints(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  ints_.Add(value);
+inline void AttributeProto::_internal_add_ints(int64_t value) {
+  _impl_.ints_.Add(value);
 }
-inline void AttributeProto::add_ints(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void AttributeProto::add_ints(int64_t value) {
   _internal_add_ints(value);
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.ints)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 AttributeProto::_internal_ints() const {
-  return ints_;
+  return _impl_.ints_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 AttributeProto::ints() const {
   // @@protoc_insertion_point(field_list:onnx.AttributeProto.ints)
   return _internal_ints();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 AttributeProto::_internal_mutable_ints() {
-  return &ints_;
+  return &_impl_.ints_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 AttributeProto::mutable_ints() {
   // @@protoc_insertion_point(field_mutable_list:onnx.AttributeProto.ints)
   return _internal_mutable_ints();
@@ -4871,20 +5268,21 @@ AttributeProto::mutable_ints() {
 
 // repeated bytes strings = 9;
 inline int AttributeProto::_internal_strings_size() const {
-  return strings_.size();
+  return _impl_.strings_.size();
 }
 inline int AttributeProto::strings_size() const {
   return _internal_strings_size();
 }
 inline void AttributeProto::clear_strings() {
-  strings_.Clear();
+  _impl_.strings_.Clear();
 }
 inline std::string* AttributeProto::add_strings() {
+  std::string* _s = _internal_add_strings();
   // @@protoc_insertion_point(field_add_mutable:onnx.AttributeProto.strings)
-  return _internal_add_strings();
+  return _s;
 }
 inline const std::string& AttributeProto::_internal_strings(int index) const {
-  return strings_.Get(index);
+  return _impl_.strings_.Get(index);
 }
 inline const std::string& AttributeProto::strings(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.strings)
@@ -4892,172 +5290,175 @@ inline const std::string& AttributeProto::strings(int index) const {
 }
 inline std::string* AttributeProto::mutable_strings(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.strings)
-  return strings_.Mutable(index);
+  return _impl_.strings_.Mutable(index);
 }
 inline void AttributeProto::set_strings(int index, const std::string& value) {
+  _impl_.strings_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.strings)
-  strings_.Mutable(index)->assign(value);
 }
 inline void AttributeProto::set_strings(int index, std::string&& value) {
+  _impl_.strings_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:onnx.AttributeProto.strings)
-  strings_.Mutable(index)->assign(std::move(value));
 }
 inline void AttributeProto::set_strings(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  strings_.Mutable(index)->assign(value);
+  _impl_.strings_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:onnx.AttributeProto.strings)
 }
 inline void AttributeProto::set_strings(int index, const void* value, size_t size) {
-  strings_.Mutable(index)->assign(
+  _impl_.strings_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:onnx.AttributeProto.strings)
 }
 inline std::string* AttributeProto::_internal_add_strings() {
-  return strings_.Add();
+  return _impl_.strings_.Add();
 }
 inline void AttributeProto::add_strings(const std::string& value) {
-  strings_.Add()->assign(value);
+  _impl_.strings_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.strings)
 }
 inline void AttributeProto::add_strings(std::string&& value) {
-  strings_.Add(std::move(value));
+  _impl_.strings_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.strings)
 }
 inline void AttributeProto::add_strings(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  strings_.Add()->assign(value);
+  _impl_.strings_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:onnx.AttributeProto.strings)
 }
 inline void AttributeProto::add_strings(const void* value, size_t size) {
-  strings_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.strings_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:onnx.AttributeProto.strings)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 AttributeProto::strings() const {
   // @@protoc_insertion_point(field_list:onnx.AttributeProto.strings)
-  return strings_;
+  return _impl_.strings_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 AttributeProto::mutable_strings() {
   // @@protoc_insertion_point(field_mutable_list:onnx.AttributeProto.strings)
-  return &strings_;
+  return &_impl_.strings_;
 }
 
 // repeated .onnx.TensorProto tensors = 10;
 inline int AttributeProto::_internal_tensors_size() const {
-  return tensors_.size();
+  return _impl_.tensors_.size();
 }
 inline int AttributeProto::tensors_size() const {
   return _internal_tensors_size();
 }
 inline void AttributeProto::clear_tensors() {
-  tensors_.Clear();
+  _impl_.tensors_.Clear();
 }
 inline ::onnx::TensorProto* AttributeProto::mutable_tensors(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.tensors)
-  return tensors_.Mutable(index);
+  return _impl_.tensors_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto >*
 AttributeProto::mutable_tensors() {
   // @@protoc_insertion_point(field_mutable_list:onnx.AttributeProto.tensors)
-  return &tensors_;
+  return &_impl_.tensors_;
 }
 inline const ::onnx::TensorProto& AttributeProto::_internal_tensors(int index) const {
-  return tensors_.Get(index);
+  return _impl_.tensors_.Get(index);
 }
 inline const ::onnx::TensorProto& AttributeProto::tensors(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.tensors)
   return _internal_tensors(index);
 }
 inline ::onnx::TensorProto* AttributeProto::_internal_add_tensors() {
-  return tensors_.Add();
+  return _impl_.tensors_.Add();
 }
 inline ::onnx::TensorProto* AttributeProto::add_tensors() {
+  ::onnx::TensorProto* _add = _internal_add_tensors();
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.tensors)
-  return _internal_add_tensors();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto >&
 AttributeProto::tensors() const {
   // @@protoc_insertion_point(field_list:onnx.AttributeProto.tensors)
-  return tensors_;
+  return _impl_.tensors_;
 }
 
 // repeated .onnx.GraphProto graphs = 11;
 inline int AttributeProto::_internal_graphs_size() const {
-  return graphs_.size();
+  return _impl_.graphs_.size();
 }
 inline int AttributeProto::graphs_size() const {
   return _internal_graphs_size();
 }
 inline void AttributeProto::clear_graphs() {
-  graphs_.Clear();
+  _impl_.graphs_.Clear();
 }
 inline ::onnx::GraphProto* AttributeProto::mutable_graphs(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.graphs)
-  return graphs_.Mutable(index);
+  return _impl_.graphs_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::GraphProto >*
 AttributeProto::mutable_graphs() {
   // @@protoc_insertion_point(field_mutable_list:onnx.AttributeProto.graphs)
-  return &graphs_;
+  return &_impl_.graphs_;
 }
 inline const ::onnx::GraphProto& AttributeProto::_internal_graphs(int index) const {
-  return graphs_.Get(index);
+  return _impl_.graphs_.Get(index);
 }
 inline const ::onnx::GraphProto& AttributeProto::graphs(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.graphs)
   return _internal_graphs(index);
 }
 inline ::onnx::GraphProto* AttributeProto::_internal_add_graphs() {
-  return graphs_.Add();
+  return _impl_.graphs_.Add();
 }
 inline ::onnx::GraphProto* AttributeProto::add_graphs() {
+  ::onnx::GraphProto* _add = _internal_add_graphs();
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.graphs)
-  return _internal_add_graphs();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::GraphProto >&
 AttributeProto::graphs() const {
   // @@protoc_insertion_point(field_list:onnx.AttributeProto.graphs)
-  return graphs_;
+  return _impl_.graphs_;
 }
 
 // repeated .onnx.SparseTensorProto sparse_tensors = 23;
 inline int AttributeProto::_internal_sparse_tensors_size() const {
-  return sparse_tensors_.size();
+  return _impl_.sparse_tensors_.size();
 }
 inline int AttributeProto::sparse_tensors_size() const {
   return _internal_sparse_tensors_size();
 }
 inline void AttributeProto::clear_sparse_tensors() {
-  sparse_tensors_.Clear();
+  _impl_.sparse_tensors_.Clear();
 }
 inline ::onnx::SparseTensorProto* AttributeProto::mutable_sparse_tensors(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.AttributeProto.sparse_tensors)
-  return sparse_tensors_.Mutable(index);
+  return _impl_.sparse_tensors_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto >*
 AttributeProto::mutable_sparse_tensors() {
   // @@protoc_insertion_point(field_mutable_list:onnx.AttributeProto.sparse_tensors)
-  return &sparse_tensors_;
+  return &_impl_.sparse_tensors_;
 }
 inline const ::onnx::SparseTensorProto& AttributeProto::_internal_sparse_tensors(int index) const {
-  return sparse_tensors_.Get(index);
+  return _impl_.sparse_tensors_.Get(index);
 }
 inline const ::onnx::SparseTensorProto& AttributeProto::sparse_tensors(int index) const {
   // @@protoc_insertion_point(field_get:onnx.AttributeProto.sparse_tensors)
   return _internal_sparse_tensors(index);
 }
 inline ::onnx::SparseTensorProto* AttributeProto::_internal_add_sparse_tensors() {
-  return sparse_tensors_.Add();
+  return _impl_.sparse_tensors_.Add();
 }
 inline ::onnx::SparseTensorProto* AttributeProto::add_sparse_tensors() {
+  ::onnx::SparseTensorProto* _add = _internal_add_sparse_tensors();
   // @@protoc_insertion_point(field_add:onnx.AttributeProto.sparse_tensors)
-  return _internal_add_sparse_tensors();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto >&
 AttributeProto::sparse_tensors() const {
   // @@protoc_insertion_point(field_list:onnx.AttributeProto.sparse_tensors)
-  return sparse_tensors_;
+  return _impl_.sparse_tensors_;
 }
 
 // -------------------------------------------------------------------
@@ -5066,203 +5467,227 @@ AttributeProto::sparse_tensors() const {
 
 // optional string name = 1;
 inline bool ValueInfoProto::_internal_has_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool ValueInfoProto::has_name() const {
   return _internal_has_name();
 }
 inline void ValueInfoProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ValueInfoProto::name() const {
   // @@protoc_insertion_point(field_get:onnx.ValueInfoProto.name)
   return _internal_name();
 }
-inline void ValueInfoProto::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ValueInfoProto::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ValueInfoProto.name)
 }
 inline std::string* ValueInfoProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:onnx.ValueInfoProto.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& ValueInfoProto::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void ValueInfoProto::_internal_set_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ValueInfoProto::set_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ValueInfoProto.name)
-}
-inline void ValueInfoProto::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ValueInfoProto.name)
-}
-inline void ValueInfoProto::set_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ValueInfoProto.name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ValueInfoProto::_internal_mutable_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ValueInfoProto::release_name() {
   // @@protoc_insertion_point(field_release:onnx.ValueInfoProto.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ValueInfoProto::set_allocated_name(std::string* name) {
   if (name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ValueInfoProto.name)
 }
 
 // optional .onnx.TypeProto type = 2;
 inline bool ValueInfoProto::_internal_has_type() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || type_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.type_ != nullptr);
   return value;
 }
 inline bool ValueInfoProto::has_type() const {
   return _internal_has_type();
 }
 inline void ValueInfoProto::clear_type() {
-  if (type_ != nullptr) type_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+  if (_impl_.type_ != nullptr) _impl_.type_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const ::onnx::TypeProto& ValueInfoProto::_internal_type() const {
-  const ::onnx::TypeProto* p = type_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TypeProto*>(
-      &::onnx::_TypeProto_default_instance_);
+  const ::onnx::TypeProto* p = _impl_.type_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TypeProto&>(
+      ::onnx::_TypeProto_default_instance_);
 }
 inline const ::onnx::TypeProto& ValueInfoProto::type() const {
   // @@protoc_insertion_point(field_get:onnx.ValueInfoProto.type)
   return _internal_type();
 }
+inline void ValueInfoProto::unsafe_arena_set_allocated_type(
+    ::onnx::TypeProto* type) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.type_);
+  }
+  _impl_.type_ = type;
+  if (type) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.ValueInfoProto.type)
+}
 inline ::onnx::TypeProto* ValueInfoProto::release_type() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::onnx::TypeProto* temp = _impl_.type_;
+  _impl_.type_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TypeProto* ValueInfoProto::unsafe_arena_release_type() {
   // @@protoc_insertion_point(field_release:onnx.ValueInfoProto.type)
-  _has_bits_[0] &= ~0x00000004u;
-  ::onnx::TypeProto* temp = type_;
-  type_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::onnx::TypeProto* temp = _impl_.type_;
+  _impl_.type_ = nullptr;
   return temp;
 }
 inline ::onnx::TypeProto* ValueInfoProto::_internal_mutable_type() {
-  _has_bits_[0] |= 0x00000004u;
-  if (type_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaNoVirtual());
-    type_ = p;
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.type_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaForAllocation());
+    _impl_.type_ = p;
   }
-  return type_;
+  return _impl_.type_;
 }
 inline ::onnx::TypeProto* ValueInfoProto::mutable_type() {
+  ::onnx::TypeProto* _msg = _internal_mutable_type();
   // @@protoc_insertion_point(field_mutable:onnx.ValueInfoProto.type)
-  return _internal_mutable_type();
+  return _msg;
 }
 inline void ValueInfoProto::set_allocated_type(::onnx::TypeProto* type) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete type_;
+    delete _impl_.type_;
   }
   if (type) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(type);
     if (message_arena != submessage_arena) {
       type = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, type, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  type_ = type;
+  _impl_.type_ = type;
   // @@protoc_insertion_point(field_set_allocated:onnx.ValueInfoProto.type)
 }
 
 // optional string doc_string = 3;
 inline bool ValueInfoProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool ValueInfoProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void ValueInfoProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& ValueInfoProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.ValueInfoProto.doc_string)
   return _internal_doc_string();
 }
-inline void ValueInfoProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ValueInfoProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ValueInfoProto.doc_string)
 }
 inline std::string* ValueInfoProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.ValueInfoProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& ValueInfoProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void ValueInfoProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ValueInfoProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ValueInfoProto.doc_string)
-}
-inline void ValueInfoProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ValueInfoProto.doc_string)
-}
-inline void ValueInfoProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ValueInfoProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ValueInfoProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000002u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ValueInfoProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.ValueInfoProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ValueInfoProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ValueInfoProto.doc_string)
 }
 
@@ -5272,20 +5697,21 @@ inline void ValueInfoProto::set_allocated_doc_string(std::string* doc_string) {
 
 // repeated string input = 1;
 inline int NodeProto::_internal_input_size() const {
-  return input_.size();
+  return _impl_.input_.size();
 }
 inline int NodeProto::input_size() const {
   return _internal_input_size();
 }
 inline void NodeProto::clear_input() {
-  input_.Clear();
+  _impl_.input_.Clear();
 }
 inline std::string* NodeProto::add_input() {
+  std::string* _s = _internal_add_input();
   // @@protoc_insertion_point(field_add_mutable:onnx.NodeProto.input)
-  return _internal_add_input();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_input(int index) const {
-  return input_.Get(index);
+  return _impl_.input_.Get(index);
 }
 inline const std::string& NodeProto::input(int index) const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.input)
@@ -5293,73 +5719,74 @@ inline const std::string& NodeProto::input(int index) const {
 }
 inline std::string* NodeProto::mutable_input(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.input)
-  return input_.Mutable(index);
+  return _impl_.input_.Mutable(index);
 }
 inline void NodeProto::set_input(int index, const std::string& value) {
+  _impl_.input_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:onnx.NodeProto.input)
-  input_.Mutable(index)->assign(value);
 }
 inline void NodeProto::set_input(int index, std::string&& value) {
+  _impl_.input_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:onnx.NodeProto.input)
-  input_.Mutable(index)->assign(std::move(value));
 }
 inline void NodeProto::set_input(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  input_.Mutable(index)->assign(value);
+  _impl_.input_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:onnx.NodeProto.input)
 }
 inline void NodeProto::set_input(int index, const char* value, size_t size) {
-  input_.Mutable(index)->assign(
+  _impl_.input_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.input)
 }
 inline std::string* NodeProto::_internal_add_input() {
-  return input_.Add();
+  return _impl_.input_.Add();
 }
 inline void NodeProto::add_input(const std::string& value) {
-  input_.Add()->assign(value);
+  _impl_.input_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:onnx.NodeProto.input)
 }
 inline void NodeProto::add_input(std::string&& value) {
-  input_.Add(std::move(value));
+  _impl_.input_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:onnx.NodeProto.input)
 }
 inline void NodeProto::add_input(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  input_.Add()->assign(value);
+  _impl_.input_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:onnx.NodeProto.input)
 }
 inline void NodeProto::add_input(const char* value, size_t size) {
-  input_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.input_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:onnx.NodeProto.input)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 NodeProto::input() const {
   // @@protoc_insertion_point(field_list:onnx.NodeProto.input)
-  return input_;
+  return _impl_.input_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 NodeProto::mutable_input() {
   // @@protoc_insertion_point(field_mutable_list:onnx.NodeProto.input)
-  return &input_;
+  return &_impl_.input_;
 }
 
 // repeated string output = 2;
 inline int NodeProto::_internal_output_size() const {
-  return output_.size();
+  return _impl_.output_.size();
 }
 inline int NodeProto::output_size() const {
   return _internal_output_size();
 }
 inline void NodeProto::clear_output() {
-  output_.Clear();
+  _impl_.output_.Clear();
 }
 inline std::string* NodeProto::add_output() {
+  std::string* _s = _internal_add_output();
   // @@protoc_insertion_point(field_add_mutable:onnx.NodeProto.output)
-  return _internal_add_output();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_output(int index) const {
-  return output_.Get(index);
+  return _impl_.output_.Get(index);
 }
 inline const std::string& NodeProto::output(int index) const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.output)
@@ -5367,377 +5794,366 @@ inline const std::string& NodeProto::output(int index) const {
 }
 inline std::string* NodeProto::mutable_output(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.output)
-  return output_.Mutable(index);
+  return _impl_.output_.Mutable(index);
 }
 inline void NodeProto::set_output(int index, const std::string& value) {
+  _impl_.output_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:onnx.NodeProto.output)
-  output_.Mutable(index)->assign(value);
 }
 inline void NodeProto::set_output(int index, std::string&& value) {
+  _impl_.output_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:onnx.NodeProto.output)
-  output_.Mutable(index)->assign(std::move(value));
 }
 inline void NodeProto::set_output(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  output_.Mutable(index)->assign(value);
+  _impl_.output_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:onnx.NodeProto.output)
 }
 inline void NodeProto::set_output(int index, const char* value, size_t size) {
-  output_.Mutable(index)->assign(
+  _impl_.output_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.output)
 }
 inline std::string* NodeProto::_internal_add_output() {
-  return output_.Add();
+  return _impl_.output_.Add();
 }
 inline void NodeProto::add_output(const std::string& value) {
-  output_.Add()->assign(value);
+  _impl_.output_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:onnx.NodeProto.output)
 }
 inline void NodeProto::add_output(std::string&& value) {
-  output_.Add(std::move(value));
+  _impl_.output_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:onnx.NodeProto.output)
 }
 inline void NodeProto::add_output(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  output_.Add()->assign(value);
+  _impl_.output_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:onnx.NodeProto.output)
 }
 inline void NodeProto::add_output(const char* value, size_t size) {
-  output_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.output_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:onnx.NodeProto.output)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 NodeProto::output() const {
   // @@protoc_insertion_point(field_list:onnx.NodeProto.output)
-  return output_;
+  return _impl_.output_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 NodeProto::mutable_output() {
   // @@protoc_insertion_point(field_mutable_list:onnx.NodeProto.output)
-  return &output_;
+  return &_impl_.output_;
 }
 
 // optional string name = 3;
 inline bool NodeProto::_internal_has_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool NodeProto::has_name() const {
   return _internal_has_name();
 }
 inline void NodeProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& NodeProto::name() const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.name)
   return _internal_name();
 }
-inline void NodeProto::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeProto::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.NodeProto.name)
 }
 inline std::string* NodeProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void NodeProto::_internal_set_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void NodeProto::set_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.NodeProto.name)
-}
-inline void NodeProto::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.NodeProto.name)
-}
-inline void NodeProto::set_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* NodeProto::_internal_mutable_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NodeProto::release_name() {
   // @@protoc_insertion_point(field_release:onnx.NodeProto.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NodeProto::set_allocated_name(std::string* name) {
   if (name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.NodeProto.name)
 }
 
 // optional string op_type = 4;
 inline bool NodeProto::_internal_has_op_type() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool NodeProto::has_op_type() const {
   return _internal_has_op_type();
 }
 inline void NodeProto::clear_op_type() {
-  op_type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.op_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& NodeProto::op_type() const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.op_type)
   return _internal_op_type();
 }
-inline void NodeProto::set_op_type(const std::string& value) {
-  _internal_set_op_type(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeProto::set_op_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.op_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.NodeProto.op_type)
 }
 inline std::string* NodeProto::mutable_op_type() {
+  std::string* _s = _internal_mutable_op_type();
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.op_type)
-  return _internal_mutable_op_type();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_op_type() const {
-  return op_type_.GetNoArena();
+  return _impl_.op_type_.Get();
 }
 inline void NodeProto::_internal_set_op_type(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  op_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void NodeProto::set_op_type(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  op_type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.NodeProto.op_type)
-}
-inline void NodeProto::set_op_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  op_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.NodeProto.op_type)
-}
-inline void NodeProto::set_op_type(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  op_type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.op_type)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.op_type_.Set(value, GetArenaForAllocation());
 }
 inline std::string* NodeProto::_internal_mutable_op_type() {
-  _has_bits_[0] |= 0x00000002u;
-  return op_type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.op_type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NodeProto::release_op_type() {
   // @@protoc_insertion_point(field_release:onnx.NodeProto.op_type)
   if (!_internal_has_op_type()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return op_type_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.op_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_type_.IsDefault()) {
+    _impl_.op_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NodeProto::set_allocated_op_type(std::string* op_type) {
   if (op_type != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.op_type_.SetAllocated(op_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.op_type_.IsDefault()) {
+    _impl_.op_type_.Set("", GetArenaForAllocation());
   }
-  op_type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), op_type);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.NodeProto.op_type)
 }
 
 // optional string domain = 7;
 inline bool NodeProto::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool NodeProto::has_domain() const {
   return _internal_has_domain();
 }
 inline void NodeProto::clear_domain() {
-  domain_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.domain_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& NodeProto::domain() const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.domain)
   return _internal_domain();
 }
-inline void NodeProto::set_domain(const std::string& value) {
-  _internal_set_domain(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeProto::set_domain(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.domain_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.NodeProto.domain)
 }
 inline std::string* NodeProto::mutable_domain() {
+  std::string* _s = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.domain)
-  return _internal_mutable_domain();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_domain() const {
-  return domain_.GetNoArena();
+  return _impl_.domain_.Get();
 }
 inline void NodeProto::_internal_set_domain(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void NodeProto::set_domain(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  domain_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.NodeProto.domain)
-}
-inline void NodeProto::set_domain(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.NodeProto.domain)
-}
-inline void NodeProto::set_domain(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.domain)
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.domain_.Set(value, GetArenaForAllocation());
 }
 inline std::string* NodeProto::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000008u;
-  return domain_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.domain_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NodeProto::release_domain() {
   // @@protoc_insertion_point(field_release:onnx.NodeProto.domain)
   if (!_internal_has_domain()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  return domain_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.domain_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NodeProto::set_allocated_domain(std::string* domain) {
   if (domain != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.domain_.SetAllocated(domain, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
   }
-  domain_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), domain);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.NodeProto.domain)
 }
 
 // repeated .onnx.AttributeProto attribute = 5;
 inline int NodeProto::_internal_attribute_size() const {
-  return attribute_.size();
+  return _impl_.attribute_.size();
 }
 inline int NodeProto::attribute_size() const {
   return _internal_attribute_size();
 }
 inline void NodeProto::clear_attribute() {
-  attribute_.Clear();
+  _impl_.attribute_.Clear();
 }
 inline ::onnx::AttributeProto* NodeProto::mutable_attribute(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.attribute)
-  return attribute_.Mutable(index);
+  return _impl_.attribute_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::AttributeProto >*
 NodeProto::mutable_attribute() {
   // @@protoc_insertion_point(field_mutable_list:onnx.NodeProto.attribute)
-  return &attribute_;
+  return &_impl_.attribute_;
 }
 inline const ::onnx::AttributeProto& NodeProto::_internal_attribute(int index) const {
-  return attribute_.Get(index);
+  return _impl_.attribute_.Get(index);
 }
 inline const ::onnx::AttributeProto& NodeProto::attribute(int index) const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.attribute)
   return _internal_attribute(index);
 }
 inline ::onnx::AttributeProto* NodeProto::_internal_add_attribute() {
-  return attribute_.Add();
+  return _impl_.attribute_.Add();
 }
 inline ::onnx::AttributeProto* NodeProto::add_attribute() {
+  ::onnx::AttributeProto* _add = _internal_add_attribute();
   // @@protoc_insertion_point(field_add:onnx.NodeProto.attribute)
-  return _internal_add_attribute();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::AttributeProto >&
 NodeProto::attribute() const {
   // @@protoc_insertion_point(field_list:onnx.NodeProto.attribute)
-  return attribute_;
+  return _impl_.attribute_;
 }
 
 // optional string doc_string = 6;
 inline bool NodeProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool NodeProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void NodeProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& NodeProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.NodeProto.doc_string)
   return _internal_doc_string();
 }
-inline void NodeProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NodeProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.NodeProto.doc_string)
 }
 inline std::string* NodeProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.NodeProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& NodeProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void NodeProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void NodeProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.NodeProto.doc_string)
-}
-inline void NodeProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.NodeProto.doc_string)
-}
-inline void NodeProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.NodeProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* NodeProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000004u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NodeProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.NodeProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void NodeProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.NodeProto.doc_string)
 }
 
@@ -5747,480 +6163,500 @@ inline void NodeProto::set_allocated_doc_string(std::string* doc_string) {
 
 // optional int64 ir_version = 1;
 inline bool ModelProto::_internal_has_ir_version() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool ModelProto::has_ir_version() const {
   return _internal_has_ir_version();
 }
 inline void ModelProto::clear_ir_version() {
-  ir_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.ir_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ModelProto::_internal_ir_version() const {
-  return ir_version_;
+inline int64_t ModelProto::_internal_ir_version() const {
+  return _impl_.ir_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ModelProto::ir_version() const {
+inline int64_t ModelProto::ir_version() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.ir_version)
   return _internal_ir_version();
 }
-inline void ModelProto::_internal_set_ir_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000020u;
-  ir_version_ = value;
+inline void ModelProto::_internal_set_ir_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.ir_version_ = value;
 }
-inline void ModelProto::set_ir_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void ModelProto::set_ir_version(int64_t value) {
   _internal_set_ir_version(value);
   // @@protoc_insertion_point(field_set:onnx.ModelProto.ir_version)
 }
 
 // repeated .onnx.OperatorSetIdProto opset_import = 8;
 inline int ModelProto::_internal_opset_import_size() const {
-  return opset_import_.size();
+  return _impl_.opset_import_.size();
 }
 inline int ModelProto::opset_import_size() const {
   return _internal_opset_import_size();
 }
 inline void ModelProto::clear_opset_import() {
-  opset_import_.Clear();
+  _impl_.opset_import_.Clear();
 }
 inline ::onnx::OperatorSetIdProto* ModelProto::mutable_opset_import(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.opset_import)
-  return opset_import_.Mutable(index);
+  return _impl_.opset_import_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::OperatorSetIdProto >*
 ModelProto::mutable_opset_import() {
   // @@protoc_insertion_point(field_mutable_list:onnx.ModelProto.opset_import)
-  return &opset_import_;
+  return &_impl_.opset_import_;
 }
 inline const ::onnx::OperatorSetIdProto& ModelProto::_internal_opset_import(int index) const {
-  return opset_import_.Get(index);
+  return _impl_.opset_import_.Get(index);
 }
 inline const ::onnx::OperatorSetIdProto& ModelProto::opset_import(int index) const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.opset_import)
   return _internal_opset_import(index);
 }
 inline ::onnx::OperatorSetIdProto* ModelProto::_internal_add_opset_import() {
-  return opset_import_.Add();
+  return _impl_.opset_import_.Add();
 }
 inline ::onnx::OperatorSetIdProto* ModelProto::add_opset_import() {
+  ::onnx::OperatorSetIdProto* _add = _internal_add_opset_import();
   // @@protoc_insertion_point(field_add:onnx.ModelProto.opset_import)
-  return _internal_add_opset_import();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::OperatorSetIdProto >&
 ModelProto::opset_import() const {
   // @@protoc_insertion_point(field_list:onnx.ModelProto.opset_import)
-  return opset_import_;
+  return _impl_.opset_import_;
 }
 
 // optional string producer_name = 2;
 inline bool ModelProto::_internal_has_producer_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool ModelProto::has_producer_name() const {
   return _internal_has_producer_name();
 }
 inline void ModelProto::clear_producer_name() {
-  producer_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.producer_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ModelProto::producer_name() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.producer_name)
   return _internal_producer_name();
 }
-inline void ModelProto::set_producer_name(const std::string& value) {
-  _internal_set_producer_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModelProto::set_producer_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.producer_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ModelProto.producer_name)
 }
 inline std::string* ModelProto::mutable_producer_name() {
+  std::string* _s = _internal_mutable_producer_name();
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.producer_name)
-  return _internal_mutable_producer_name();
+  return _s;
 }
 inline const std::string& ModelProto::_internal_producer_name() const {
-  return producer_name_.GetNoArena();
+  return _impl_.producer_name_.Get();
 }
 inline void ModelProto::_internal_set_producer_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  producer_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ModelProto::set_producer_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  producer_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ModelProto.producer_name)
-}
-inline void ModelProto::set_producer_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  producer_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ModelProto.producer_name)
-}
-inline void ModelProto::set_producer_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  producer_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ModelProto.producer_name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.producer_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ModelProto::_internal_mutable_producer_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return producer_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.producer_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ModelProto::release_producer_name() {
   // @@protoc_insertion_point(field_release:onnx.ModelProto.producer_name)
   if (!_internal_has_producer_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return producer_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.producer_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.producer_name_.IsDefault()) {
+    _impl_.producer_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ModelProto::set_allocated_producer_name(std::string* producer_name) {
   if (producer_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.producer_name_.SetAllocated(producer_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.producer_name_.IsDefault()) {
+    _impl_.producer_name_.Set("", GetArenaForAllocation());
   }
-  producer_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), producer_name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ModelProto.producer_name)
 }
 
 // optional string producer_version = 3;
 inline bool ModelProto::_internal_has_producer_version() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool ModelProto::has_producer_version() const {
   return _internal_has_producer_version();
 }
 inline void ModelProto::clear_producer_version() {
-  producer_version_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.producer_version_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& ModelProto::producer_version() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.producer_version)
   return _internal_producer_version();
 }
-inline void ModelProto::set_producer_version(const std::string& value) {
-  _internal_set_producer_version(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModelProto::set_producer_version(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.producer_version_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ModelProto.producer_version)
 }
 inline std::string* ModelProto::mutable_producer_version() {
+  std::string* _s = _internal_mutable_producer_version();
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.producer_version)
-  return _internal_mutable_producer_version();
+  return _s;
 }
 inline const std::string& ModelProto::_internal_producer_version() const {
-  return producer_version_.GetNoArena();
+  return _impl_.producer_version_.Get();
 }
 inline void ModelProto::_internal_set_producer_version(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  producer_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ModelProto::set_producer_version(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  producer_version_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ModelProto.producer_version)
-}
-inline void ModelProto::set_producer_version(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  producer_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ModelProto.producer_version)
-}
-inline void ModelProto::set_producer_version(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  producer_version_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ModelProto.producer_version)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.producer_version_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ModelProto::_internal_mutable_producer_version() {
-  _has_bits_[0] |= 0x00000002u;
-  return producer_version_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.producer_version_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ModelProto::release_producer_version() {
   // @@protoc_insertion_point(field_release:onnx.ModelProto.producer_version)
   if (!_internal_has_producer_version()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return producer_version_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.producer_version_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.producer_version_.IsDefault()) {
+    _impl_.producer_version_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ModelProto::set_allocated_producer_version(std::string* producer_version) {
   if (producer_version != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.producer_version_.SetAllocated(producer_version, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.producer_version_.IsDefault()) {
+    _impl_.producer_version_.Set("", GetArenaForAllocation());
   }
-  producer_version_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), producer_version);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ModelProto.producer_version)
 }
 
 // optional string domain = 4;
 inline bool ModelProto::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool ModelProto::has_domain() const {
   return _internal_has_domain();
 }
 inline void ModelProto::clear_domain() {
-  domain_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.domain_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& ModelProto::domain() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.domain)
   return _internal_domain();
 }
-inline void ModelProto::set_domain(const std::string& value) {
-  _internal_set_domain(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModelProto::set_domain(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.domain_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ModelProto.domain)
 }
 inline std::string* ModelProto::mutable_domain() {
+  std::string* _s = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.domain)
-  return _internal_mutable_domain();
+  return _s;
 }
 inline const std::string& ModelProto::_internal_domain() const {
-  return domain_.GetNoArena();
+  return _impl_.domain_.Get();
 }
 inline void ModelProto::_internal_set_domain(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ModelProto::set_domain(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  domain_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ModelProto.domain)
-}
-inline void ModelProto::set_domain(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ModelProto.domain)
-}
-inline void ModelProto::set_domain(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ModelProto.domain)
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.domain_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ModelProto::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000004u;
-  return domain_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.domain_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ModelProto::release_domain() {
   // @@protoc_insertion_point(field_release:onnx.ModelProto.domain)
   if (!_internal_has_domain()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return domain_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.domain_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ModelProto::set_allocated_domain(std::string* domain) {
   if (domain != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.domain_.SetAllocated(domain, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
   }
-  domain_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), domain);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ModelProto.domain)
 }
 
 // optional int64 model_version = 5;
 inline bool ModelProto::_internal_has_model_version() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
   return value;
 }
 inline bool ModelProto::has_model_version() const {
   return _internal_has_model_version();
 }
 inline void ModelProto::clear_model_version() {
-  model_version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000040u;
+  _impl_.model_version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ModelProto::_internal_model_version() const {
-  return model_version_;
+inline int64_t ModelProto::_internal_model_version() const {
+  return _impl_.model_version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 ModelProto::model_version() const {
+inline int64_t ModelProto::model_version() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.model_version)
   return _internal_model_version();
 }
-inline void ModelProto::_internal_set_model_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000040u;
-  model_version_ = value;
+inline void ModelProto::_internal_set_model_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.model_version_ = value;
 }
-inline void ModelProto::set_model_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void ModelProto::set_model_version(int64_t value) {
   _internal_set_model_version(value);
   // @@protoc_insertion_point(field_set:onnx.ModelProto.model_version)
 }
 
 // optional string doc_string = 6;
 inline bool ModelProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool ModelProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void ModelProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000008u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const std::string& ModelProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.doc_string)
   return _internal_doc_string();
 }
-inline void ModelProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ModelProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.ModelProto.doc_string)
 }
 inline std::string* ModelProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& ModelProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void ModelProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ModelProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000008u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.ModelProto.doc_string)
-}
-inline void ModelProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000008u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.ModelProto.doc_string)
-}
-inline void ModelProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000008u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.ModelProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ModelProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000008u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ModelProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.ModelProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000008u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void ModelProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.ModelProto.doc_string)
 }
 
 // optional .onnx.GraphProto graph = 7;
 inline bool ModelProto::_internal_has_graph() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || graph_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.graph_ != nullptr);
   return value;
 }
 inline bool ModelProto::has_graph() const {
   return _internal_has_graph();
 }
 inline void ModelProto::clear_graph() {
-  if (graph_ != nullptr) graph_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  if (_impl_.graph_ != nullptr) _impl_.graph_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::onnx::GraphProto& ModelProto::_internal_graph() const {
-  const ::onnx::GraphProto* p = graph_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::GraphProto*>(
-      &::onnx::_GraphProto_default_instance_);
+  const ::onnx::GraphProto* p = _impl_.graph_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::GraphProto&>(
+      ::onnx::_GraphProto_default_instance_);
 }
 inline const ::onnx::GraphProto& ModelProto::graph() const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.graph)
   return _internal_graph();
 }
+inline void ModelProto::unsafe_arena_set_allocated_graph(
+    ::onnx::GraphProto* graph) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.graph_);
+  }
+  _impl_.graph_ = graph;
+  if (graph) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.ModelProto.graph)
+}
 inline ::onnx::GraphProto* ModelProto::release_graph() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::onnx::GraphProto* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::GraphProto* ModelProto::unsafe_arena_release_graph() {
   // @@protoc_insertion_point(field_release:onnx.ModelProto.graph)
-  _has_bits_[0] &= ~0x00000010u;
-  ::onnx::GraphProto* temp = graph_;
-  graph_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::onnx::GraphProto* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
   return temp;
 }
 inline ::onnx::GraphProto* ModelProto::_internal_mutable_graph() {
-  _has_bits_[0] |= 0x00000010u;
-  if (graph_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::GraphProto>(GetArenaNoVirtual());
-    graph_ = p;
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.graph_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::GraphProto>(GetArenaForAllocation());
+    _impl_.graph_ = p;
   }
-  return graph_;
+  return _impl_.graph_;
 }
 inline ::onnx::GraphProto* ModelProto::mutable_graph() {
+  ::onnx::GraphProto* _msg = _internal_mutable_graph();
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.graph)
-  return _internal_mutable_graph();
+  return _msg;
 }
 inline void ModelProto::set_allocated_graph(::onnx::GraphProto* graph) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete graph_;
+    delete _impl_.graph_;
   }
   if (graph) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(graph);
     if (message_arena != submessage_arena) {
       graph = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, graph, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
-  graph_ = graph;
+  _impl_.graph_ = graph;
   // @@protoc_insertion_point(field_set_allocated:onnx.ModelProto.graph)
 }
 
 // repeated .onnx.StringStringEntryProto metadata_props = 14;
 inline int ModelProto::_internal_metadata_props_size() const {
-  return metadata_props_.size();
+  return _impl_.metadata_props_.size();
 }
 inline int ModelProto::metadata_props_size() const {
   return _internal_metadata_props_size();
 }
 inline void ModelProto::clear_metadata_props() {
-  metadata_props_.Clear();
+  _impl_.metadata_props_.Clear();
 }
 inline ::onnx::StringStringEntryProto* ModelProto::mutable_metadata_props(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.ModelProto.metadata_props)
-  return metadata_props_.Mutable(index);
+  return _impl_.metadata_props_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >*
 ModelProto::mutable_metadata_props() {
   // @@protoc_insertion_point(field_mutable_list:onnx.ModelProto.metadata_props)
-  return &metadata_props_;
+  return &_impl_.metadata_props_;
 }
 inline const ::onnx::StringStringEntryProto& ModelProto::_internal_metadata_props(int index) const {
-  return metadata_props_.Get(index);
+  return _impl_.metadata_props_.Get(index);
 }
 inline const ::onnx::StringStringEntryProto& ModelProto::metadata_props(int index) const {
   // @@protoc_insertion_point(field_get:onnx.ModelProto.metadata_props)
   return _internal_metadata_props(index);
 }
 inline ::onnx::StringStringEntryProto* ModelProto::_internal_add_metadata_props() {
-  return metadata_props_.Add();
+  return _impl_.metadata_props_.Add();
 }
 inline ::onnx::StringStringEntryProto* ModelProto::add_metadata_props() {
+  ::onnx::StringStringEntryProto* _add = _internal_add_metadata_props();
   // @@protoc_insertion_point(field_add:onnx.ModelProto.metadata_props)
-  return _internal_add_metadata_props();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >&
 ModelProto::metadata_props() const {
   // @@protoc_insertion_point(field_list:onnx.ModelProto.metadata_props)
-  return metadata_props_;
+  return _impl_.metadata_props_;
 }
 
 // -------------------------------------------------------------------
@@ -6229,143 +6665,137 @@ ModelProto::metadata_props() const {
 
 // optional string key = 1;
 inline bool StringStringEntryProto::_internal_has_key() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool StringStringEntryProto::has_key() const {
   return _internal_has_key();
 }
 inline void StringStringEntryProto::clear_key() {
-  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& StringStringEntryProto::key() const {
   // @@protoc_insertion_point(field_get:onnx.StringStringEntryProto.key)
   return _internal_key();
 }
-inline void StringStringEntryProto::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StringStringEntryProto::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.StringStringEntryProto.key)
 }
 inline std::string* StringStringEntryProto::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:onnx.StringStringEntryProto.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& StringStringEntryProto::_internal_key() const {
-  return key_.GetNoArena();
+  return _impl_.key_.Get();
 }
 inline void StringStringEntryProto::_internal_set_key(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void StringStringEntryProto::set_key(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  key_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.StringStringEntryProto.key)
-}
-inline void StringStringEntryProto::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.StringStringEntryProto.key)
-}
-inline void StringStringEntryProto::set_key(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.StringStringEntryProto.key)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StringStringEntryProto::_internal_mutable_key() {
-  _has_bits_[0] |= 0x00000001u;
-  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StringStringEntryProto::release_key() {
   // @@protoc_insertion_point(field_release:onnx.StringStringEntryProto.key)
   if (!_internal_has_key()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return key_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void StringStringEntryProto::set_allocated_key(std::string* key) {
   if (key != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.StringStringEntryProto.key)
 }
 
 // optional string value = 2;
 inline bool StringStringEntryProto::_internal_has_value() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool StringStringEntryProto::has_value() const {
   return _internal_has_value();
 }
 inline void StringStringEntryProto::clear_value() {
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& StringStringEntryProto::value() const {
   // @@protoc_insertion_point(field_get:onnx.StringStringEntryProto.value)
   return _internal_value();
 }
-inline void StringStringEntryProto::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StringStringEntryProto::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.StringStringEntryProto.value)
 }
 inline std::string* StringStringEntryProto::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:onnx.StringStringEntryProto.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& StringStringEntryProto::_internal_value() const {
-  return value_.GetNoArena();
+  return _impl_.value_.Get();
 }
 inline void StringStringEntryProto::_internal_set_value(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void StringStringEntryProto::set_value(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  value_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.StringStringEntryProto.value)
-}
-inline void StringStringEntryProto::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.StringStringEntryProto.value)
-}
-inline void StringStringEntryProto::set_value(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.StringStringEntryProto.value)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StringStringEntryProto::_internal_mutable_value() {
-  _has_bits_[0] |= 0x00000002u;
-  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StringStringEntryProto::release_value() {
   // @@protoc_insertion_point(field_release:onnx.StringStringEntryProto.value)
   if (!_internal_has_value()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return value_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void StringStringEntryProto::set_allocated_value(std::string* value) {
   if (value != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.StringStringEntryProto.value)
 }
 
@@ -6375,112 +6805,110 @@ inline void StringStringEntryProto::set_allocated_value(std::string* value) {
 
 // optional string tensor_name = 1;
 inline bool TensorAnnotation::_internal_has_tensor_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool TensorAnnotation::has_tensor_name() const {
   return _internal_has_tensor_name();
 }
 inline void TensorAnnotation::clear_tensor_name() {
-  tensor_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.tensor_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TensorAnnotation::tensor_name() const {
   // @@protoc_insertion_point(field_get:onnx.TensorAnnotation.tensor_name)
   return _internal_tensor_name();
 }
-inline void TensorAnnotation::set_tensor_name(const std::string& value) {
-  _internal_set_tensor_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorAnnotation::set_tensor_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.tensor_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorAnnotation.tensor_name)
 }
 inline std::string* TensorAnnotation::mutable_tensor_name() {
+  std::string* _s = _internal_mutable_tensor_name();
   // @@protoc_insertion_point(field_mutable:onnx.TensorAnnotation.tensor_name)
-  return _internal_mutable_tensor_name();
+  return _s;
 }
 inline const std::string& TensorAnnotation::_internal_tensor_name() const {
-  return tensor_name_.GetNoArena();
+  return _impl_.tensor_name_.Get();
 }
 inline void TensorAnnotation::_internal_set_tensor_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  tensor_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorAnnotation::set_tensor_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  tensor_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorAnnotation.tensor_name)
-}
-inline void TensorAnnotation::set_tensor_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  tensor_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorAnnotation.tensor_name)
-}
-inline void TensorAnnotation::set_tensor_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  tensor_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorAnnotation.tensor_name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tensor_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorAnnotation::_internal_mutable_tensor_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return tensor_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.tensor_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TensorAnnotation::release_tensor_name() {
   // @@protoc_insertion_point(field_release:onnx.TensorAnnotation.tensor_name)
   if (!_internal_has_tensor_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return tensor_name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.tensor_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tensor_name_.IsDefault()) {
+    _impl_.tensor_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TensorAnnotation::set_allocated_tensor_name(std::string* tensor_name) {
   if (tensor_name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  tensor_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), tensor_name);
+  _impl_.tensor_name_.SetAllocated(tensor_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tensor_name_.IsDefault()) {
+    _impl_.tensor_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorAnnotation.tensor_name)
 }
 
 // repeated .onnx.StringStringEntryProto quant_parameter_tensor_names = 2;
 inline int TensorAnnotation::_internal_quant_parameter_tensor_names_size() const {
-  return quant_parameter_tensor_names_.size();
+  return _impl_.quant_parameter_tensor_names_.size();
 }
 inline int TensorAnnotation::quant_parameter_tensor_names_size() const {
   return _internal_quant_parameter_tensor_names_size();
 }
 inline void TensorAnnotation::clear_quant_parameter_tensor_names() {
-  quant_parameter_tensor_names_.Clear();
+  _impl_.quant_parameter_tensor_names_.Clear();
 }
 inline ::onnx::StringStringEntryProto* TensorAnnotation::mutable_quant_parameter_tensor_names(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.TensorAnnotation.quant_parameter_tensor_names)
-  return quant_parameter_tensor_names_.Mutable(index);
+  return _impl_.quant_parameter_tensor_names_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >*
 TensorAnnotation::mutable_quant_parameter_tensor_names() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorAnnotation.quant_parameter_tensor_names)
-  return &quant_parameter_tensor_names_;
+  return &_impl_.quant_parameter_tensor_names_;
 }
 inline const ::onnx::StringStringEntryProto& TensorAnnotation::_internal_quant_parameter_tensor_names(int index) const {
-  return quant_parameter_tensor_names_.Get(index);
+  return _impl_.quant_parameter_tensor_names_.Get(index);
 }
 inline const ::onnx::StringStringEntryProto& TensorAnnotation::quant_parameter_tensor_names(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorAnnotation.quant_parameter_tensor_names)
   return _internal_quant_parameter_tensor_names(index);
 }
 inline ::onnx::StringStringEntryProto* TensorAnnotation::_internal_add_quant_parameter_tensor_names() {
-  return quant_parameter_tensor_names_.Add();
+  return _impl_.quant_parameter_tensor_names_.Add();
 }
 inline ::onnx::StringStringEntryProto* TensorAnnotation::add_quant_parameter_tensor_names() {
+  ::onnx::StringStringEntryProto* _add = _internal_add_quant_parameter_tensor_names();
   // @@protoc_insertion_point(field_add:onnx.TensorAnnotation.quant_parameter_tensor_names)
-  return _internal_add_quant_parameter_tensor_names();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >&
 TensorAnnotation::quant_parameter_tensor_names() const {
   // @@protoc_insertion_point(field_list:onnx.TensorAnnotation.quant_parameter_tensor_names)
-  return quant_parameter_tensor_names_;
+  return _impl_.quant_parameter_tensor_names_;
 }
 
 // -------------------------------------------------------------------
@@ -6489,417 +6917,418 @@ TensorAnnotation::quant_parameter_tensor_names() const {
 
 // repeated .onnx.NodeProto node = 1;
 inline int GraphProto::_internal_node_size() const {
-  return node_.size();
+  return _impl_.node_.size();
 }
 inline int GraphProto::node_size() const {
   return _internal_node_size();
 }
 inline void GraphProto::clear_node() {
-  node_.Clear();
+  _impl_.node_.Clear();
 }
 inline ::onnx::NodeProto* GraphProto::mutable_node(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.node)
-  return node_.Mutable(index);
+  return _impl_.node_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::NodeProto >*
 GraphProto::mutable_node() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.node)
-  return &node_;
+  return &_impl_.node_;
 }
 inline const ::onnx::NodeProto& GraphProto::_internal_node(int index) const {
-  return node_.Get(index);
+  return _impl_.node_.Get(index);
 }
 inline const ::onnx::NodeProto& GraphProto::node(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.node)
   return _internal_node(index);
 }
 inline ::onnx::NodeProto* GraphProto::_internal_add_node() {
-  return node_.Add();
+  return _impl_.node_.Add();
 }
 inline ::onnx::NodeProto* GraphProto::add_node() {
+  ::onnx::NodeProto* _add = _internal_add_node();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.node)
-  return _internal_add_node();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::NodeProto >&
 GraphProto::node() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.node)
-  return node_;
+  return _impl_.node_;
 }
 
 // optional string name = 2;
 inline bool GraphProto::_internal_has_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool GraphProto::has_name() const {
   return _internal_has_name();
 }
 inline void GraphProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& GraphProto::name() const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.name)
   return _internal_name();
 }
-inline void GraphProto::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GraphProto::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.GraphProto.name)
 }
 inline std::string* GraphProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& GraphProto::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void GraphProto::_internal_set_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GraphProto::set_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.GraphProto.name)
-}
-inline void GraphProto::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.GraphProto.name)
-}
-inline void GraphProto::set_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.GraphProto.name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GraphProto::_internal_mutable_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GraphProto::release_name() {
   // @@protoc_insertion_point(field_release:onnx.GraphProto.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void GraphProto::set_allocated_name(std::string* name) {
   if (name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.GraphProto.name)
 }
 
 // repeated .onnx.TensorProto initializer = 5;
 inline int GraphProto::_internal_initializer_size() const {
-  return initializer_.size();
+  return _impl_.initializer_.size();
 }
 inline int GraphProto::initializer_size() const {
   return _internal_initializer_size();
 }
 inline void GraphProto::clear_initializer() {
-  initializer_.Clear();
+  _impl_.initializer_.Clear();
 }
 inline ::onnx::TensorProto* GraphProto::mutable_initializer(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.initializer)
-  return initializer_.Mutable(index);
+  return _impl_.initializer_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto >*
 GraphProto::mutable_initializer() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.initializer)
-  return &initializer_;
+  return &_impl_.initializer_;
 }
 inline const ::onnx::TensorProto& GraphProto::_internal_initializer(int index) const {
-  return initializer_.Get(index);
+  return _impl_.initializer_.Get(index);
 }
 inline const ::onnx::TensorProto& GraphProto::initializer(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.initializer)
   return _internal_initializer(index);
 }
 inline ::onnx::TensorProto* GraphProto::_internal_add_initializer() {
-  return initializer_.Add();
+  return _impl_.initializer_.Add();
 }
 inline ::onnx::TensorProto* GraphProto::add_initializer() {
+  ::onnx::TensorProto* _add = _internal_add_initializer();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.initializer)
-  return _internal_add_initializer();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorProto >&
 GraphProto::initializer() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.initializer)
-  return initializer_;
+  return _impl_.initializer_;
 }
 
 // repeated .onnx.SparseTensorProto sparse_initializer = 15;
 inline int GraphProto::_internal_sparse_initializer_size() const {
-  return sparse_initializer_.size();
+  return _impl_.sparse_initializer_.size();
 }
 inline int GraphProto::sparse_initializer_size() const {
   return _internal_sparse_initializer_size();
 }
 inline void GraphProto::clear_sparse_initializer() {
-  sparse_initializer_.Clear();
+  _impl_.sparse_initializer_.Clear();
 }
 inline ::onnx::SparseTensorProto* GraphProto::mutable_sparse_initializer(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.sparse_initializer)
-  return sparse_initializer_.Mutable(index);
+  return _impl_.sparse_initializer_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto >*
 GraphProto::mutable_sparse_initializer() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.sparse_initializer)
-  return &sparse_initializer_;
+  return &_impl_.sparse_initializer_;
 }
 inline const ::onnx::SparseTensorProto& GraphProto::_internal_sparse_initializer(int index) const {
-  return sparse_initializer_.Get(index);
+  return _impl_.sparse_initializer_.Get(index);
 }
 inline const ::onnx::SparseTensorProto& GraphProto::sparse_initializer(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.sparse_initializer)
   return _internal_sparse_initializer(index);
 }
 inline ::onnx::SparseTensorProto* GraphProto::_internal_add_sparse_initializer() {
-  return sparse_initializer_.Add();
+  return _impl_.sparse_initializer_.Add();
 }
 inline ::onnx::SparseTensorProto* GraphProto::add_sparse_initializer() {
+  ::onnx::SparseTensorProto* _add = _internal_add_sparse_initializer();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.sparse_initializer)
-  return _internal_add_sparse_initializer();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::SparseTensorProto >&
 GraphProto::sparse_initializer() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.sparse_initializer)
-  return sparse_initializer_;
+  return _impl_.sparse_initializer_;
 }
 
 // optional string doc_string = 10;
 inline bool GraphProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool GraphProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void GraphProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& GraphProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.doc_string)
   return _internal_doc_string();
 }
-inline void GraphProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GraphProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.GraphProto.doc_string)
 }
 inline std::string* GraphProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& GraphProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void GraphProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GraphProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.GraphProto.doc_string)
-}
-inline void GraphProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.GraphProto.doc_string)
-}
-inline void GraphProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.GraphProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* GraphProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000002u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* GraphProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.GraphProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void GraphProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.GraphProto.doc_string)
 }
 
 // repeated .onnx.ValueInfoProto input = 11;
 inline int GraphProto::_internal_input_size() const {
-  return input_.size();
+  return _impl_.input_.size();
 }
 inline int GraphProto::input_size() const {
   return _internal_input_size();
 }
 inline void GraphProto::clear_input() {
-  input_.Clear();
+  _impl_.input_.Clear();
 }
 inline ::onnx::ValueInfoProto* GraphProto::mutable_input(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.input)
-  return input_.Mutable(index);
+  return _impl_.input_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >*
 GraphProto::mutable_input() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.input)
-  return &input_;
+  return &_impl_.input_;
 }
 inline const ::onnx::ValueInfoProto& GraphProto::_internal_input(int index) const {
-  return input_.Get(index);
+  return _impl_.input_.Get(index);
 }
 inline const ::onnx::ValueInfoProto& GraphProto::input(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.input)
   return _internal_input(index);
 }
 inline ::onnx::ValueInfoProto* GraphProto::_internal_add_input() {
-  return input_.Add();
+  return _impl_.input_.Add();
 }
 inline ::onnx::ValueInfoProto* GraphProto::add_input() {
+  ::onnx::ValueInfoProto* _add = _internal_add_input();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.input)
-  return _internal_add_input();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >&
 GraphProto::input() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.input)
-  return input_;
+  return _impl_.input_;
 }
 
 // repeated .onnx.ValueInfoProto output = 12;
 inline int GraphProto::_internal_output_size() const {
-  return output_.size();
+  return _impl_.output_.size();
 }
 inline int GraphProto::output_size() const {
   return _internal_output_size();
 }
 inline void GraphProto::clear_output() {
-  output_.Clear();
+  _impl_.output_.Clear();
 }
 inline ::onnx::ValueInfoProto* GraphProto::mutable_output(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.output)
-  return output_.Mutable(index);
+  return _impl_.output_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >*
 GraphProto::mutable_output() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.output)
-  return &output_;
+  return &_impl_.output_;
 }
 inline const ::onnx::ValueInfoProto& GraphProto::_internal_output(int index) const {
-  return output_.Get(index);
+  return _impl_.output_.Get(index);
 }
 inline const ::onnx::ValueInfoProto& GraphProto::output(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.output)
   return _internal_output(index);
 }
 inline ::onnx::ValueInfoProto* GraphProto::_internal_add_output() {
-  return output_.Add();
+  return _impl_.output_.Add();
 }
 inline ::onnx::ValueInfoProto* GraphProto::add_output() {
+  ::onnx::ValueInfoProto* _add = _internal_add_output();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.output)
-  return _internal_add_output();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >&
 GraphProto::output() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.output)
-  return output_;
+  return _impl_.output_;
 }
 
 // repeated .onnx.ValueInfoProto value_info = 13;
 inline int GraphProto::_internal_value_info_size() const {
-  return value_info_.size();
+  return _impl_.value_info_.size();
 }
 inline int GraphProto::value_info_size() const {
   return _internal_value_info_size();
 }
 inline void GraphProto::clear_value_info() {
-  value_info_.Clear();
+  _impl_.value_info_.Clear();
 }
 inline ::onnx::ValueInfoProto* GraphProto::mutable_value_info(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.value_info)
-  return value_info_.Mutable(index);
+  return _impl_.value_info_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >*
 GraphProto::mutable_value_info() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.value_info)
-  return &value_info_;
+  return &_impl_.value_info_;
 }
 inline const ::onnx::ValueInfoProto& GraphProto::_internal_value_info(int index) const {
-  return value_info_.Get(index);
+  return _impl_.value_info_.Get(index);
 }
 inline const ::onnx::ValueInfoProto& GraphProto::value_info(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.value_info)
   return _internal_value_info(index);
 }
 inline ::onnx::ValueInfoProto* GraphProto::_internal_add_value_info() {
-  return value_info_.Add();
+  return _impl_.value_info_.Add();
 }
 inline ::onnx::ValueInfoProto* GraphProto::add_value_info() {
+  ::onnx::ValueInfoProto* _add = _internal_add_value_info();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.value_info)
-  return _internal_add_value_info();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::ValueInfoProto >&
 GraphProto::value_info() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.value_info)
-  return value_info_;
+  return _impl_.value_info_;
 }
 
 // repeated .onnx.TensorAnnotation quantization_annotation = 14;
 inline int GraphProto::_internal_quantization_annotation_size() const {
-  return quantization_annotation_.size();
+  return _impl_.quantization_annotation_.size();
 }
 inline int GraphProto::quantization_annotation_size() const {
   return _internal_quantization_annotation_size();
 }
 inline void GraphProto::clear_quantization_annotation() {
-  quantization_annotation_.Clear();
+  _impl_.quantization_annotation_.Clear();
 }
 inline ::onnx::TensorAnnotation* GraphProto::mutable_quantization_annotation(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.GraphProto.quantization_annotation)
-  return quantization_annotation_.Mutable(index);
+  return _impl_.quantization_annotation_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorAnnotation >*
 GraphProto::mutable_quantization_annotation() {
   // @@protoc_insertion_point(field_mutable_list:onnx.GraphProto.quantization_annotation)
-  return &quantization_annotation_;
+  return &_impl_.quantization_annotation_;
 }
 inline const ::onnx::TensorAnnotation& GraphProto::_internal_quantization_annotation(int index) const {
-  return quantization_annotation_.Get(index);
+  return _impl_.quantization_annotation_.Get(index);
 }
 inline const ::onnx::TensorAnnotation& GraphProto::quantization_annotation(int index) const {
   // @@protoc_insertion_point(field_get:onnx.GraphProto.quantization_annotation)
   return _internal_quantization_annotation(index);
 }
 inline ::onnx::TensorAnnotation* GraphProto::_internal_add_quantization_annotation() {
-  return quantization_annotation_.Add();
+  return _impl_.quantization_annotation_.Add();
 }
 inline ::onnx::TensorAnnotation* GraphProto::add_quantization_annotation() {
+  ::onnx::TensorAnnotation* _add = _internal_add_quantization_annotation();
   // @@protoc_insertion_point(field_add:onnx.GraphProto.quantization_annotation)
-  return _internal_add_quantization_annotation();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorAnnotation >&
 GraphProto::quantization_annotation() const {
   // @@protoc_insertion_point(field_list:onnx.GraphProto.quantization_annotation)
-  return quantization_annotation_;
+  return _impl_.quantization_annotation_;
 }
 
 // -------------------------------------------------------------------
@@ -6908,56 +7337,56 @@ GraphProto::quantization_annotation() const {
 
 // optional int64 begin = 1;
 inline bool TensorProto_Segment::_internal_has_begin() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool TensorProto_Segment::has_begin() const {
   return _internal_has_begin();
 }
 inline void TensorProto_Segment::clear_begin() {
-  begin_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.begin_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto_Segment::_internal_begin() const {
-  return begin_;
+inline int64_t TensorProto_Segment::_internal_begin() const {
+  return _impl_.begin_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto_Segment::begin() const {
+inline int64_t TensorProto_Segment::begin() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.Segment.begin)
   return _internal_begin();
 }
-inline void TensorProto_Segment::_internal_set_begin(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000001u;
-  begin_ = value;
+inline void TensorProto_Segment::_internal_set_begin(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.begin_ = value;
 }
-inline void TensorProto_Segment::set_begin(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorProto_Segment::set_begin(int64_t value) {
   _internal_set_begin(value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.Segment.begin)
 }
 
 // optional int64 end = 2;
 inline bool TensorProto_Segment::_internal_has_end() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool TensorProto_Segment::has_end() const {
   return _internal_has_end();
 }
 inline void TensorProto_Segment::clear_end() {
-  end_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.end_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto_Segment::_internal_end() const {
-  return end_;
+inline int64_t TensorProto_Segment::_internal_end() const {
+  return _impl_.end_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto_Segment::end() const {
+inline int64_t TensorProto_Segment::end() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.Segment.end)
   return _internal_end();
 }
-inline void TensorProto_Segment::_internal_set_end(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  end_ = value;
+inline void TensorProto_Segment::_internal_set_end(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_ = value;
 }
-inline void TensorProto_Segment::set_end(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorProto_Segment::set_end(int64_t value) {
   _internal_set_end(value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.Segment.end)
 }
@@ -6968,46 +7397,46 @@ inline void TensorProto_Segment::set_end(::PROTOBUF_NAMESPACE_ID::int64 value) {
 
 // repeated int64 dims = 1;
 inline int TensorProto::_internal_dims_size() const {
-  return dims_.size();
+  return _impl_.dims_.size();
 }
 inline int TensorProto::dims_size() const {
   return _internal_dims_size();
 }
 inline void TensorProto::clear_dims() {
-  dims_.Clear();
+  _impl_.dims_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto::_internal_dims(int index) const {
-  return dims_.Get(index);
+inline int64_t TensorProto::_internal_dims(int index) const {
+  return _impl_.dims_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto::dims(int index) const {
+inline int64_t TensorProto::dims(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.dims)
   return _internal_dims(index);
 }
-inline void TensorProto::set_dims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  dims_.Set(index, value);
+inline void TensorProto::set_dims(int index, int64_t value) {
+  _impl_.dims_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.dims)
 }
-inline void TensorProto::_internal_add_dims(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  dims_.Add(value);
+inline void TensorProto::_internal_add_dims(int64_t value) {
+  _impl_.dims_.Add(value);
 }
-inline void TensorProto::add_dims(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorProto::add_dims(int64_t value) {
   _internal_add_dims(value);
   // @@protoc_insertion_point(field_add:onnx.TensorProto.dims)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 TensorProto::_internal_dims() const {
-  return dims_;
+  return _impl_.dims_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 TensorProto::dims() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.dims)
   return _internal_dims();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 TensorProto::_internal_mutable_dims() {
-  return &dims_;
+  return &_impl_.dims_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 TensorProto::mutable_dims() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.dims)
   return _internal_mutable_dims();
@@ -7015,115 +7444,145 @@ TensorProto::mutable_dims() {
 
 // optional int32 data_type = 2;
 inline bool TensorProto::_internal_has_data_type() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool TensorProto::has_data_type() const {
   return _internal_has_data_type();
 }
 inline void TensorProto::clear_data_type() {
-  data_type_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _impl_.data_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TensorProto::_internal_data_type() const {
-  return data_type_;
+inline int32_t TensorProto::_internal_data_type() const {
+  return _impl_.data_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TensorProto::data_type() const {
+inline int32_t TensorProto::data_type() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.data_type)
   return _internal_data_type();
 }
-inline void TensorProto::_internal_set_data_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000010u;
-  data_type_ = value;
+inline void TensorProto::_internal_set_data_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.data_type_ = value;
 }
-inline void TensorProto::set_data_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TensorProto::set_data_type(int32_t value) {
   _internal_set_data_type(value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.data_type)
 }
 
 // optional .onnx.TensorProto.Segment segment = 3;
 inline bool TensorProto::_internal_has_segment() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || segment_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.segment_ != nullptr);
   return value;
 }
 inline bool TensorProto::has_segment() const {
   return _internal_has_segment();
 }
 inline void TensorProto::clear_segment() {
-  if (segment_ != nullptr) segment_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+  if (_impl_.segment_ != nullptr) _impl_.segment_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::onnx::TensorProto_Segment& TensorProto::_internal_segment() const {
-  const ::onnx::TensorProto_Segment* p = segment_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TensorProto_Segment*>(
-      &::onnx::_TensorProto_Segment_default_instance_);
+  const ::onnx::TensorProto_Segment* p = _impl_.segment_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TensorProto_Segment&>(
+      ::onnx::_TensorProto_Segment_default_instance_);
 }
 inline const ::onnx::TensorProto_Segment& TensorProto::segment() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.segment)
   return _internal_segment();
 }
+inline void TensorProto::unsafe_arena_set_allocated_segment(
+    ::onnx::TensorProto_Segment* segment) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.segment_);
+  }
+  _impl_.segment_ = segment;
+  if (segment) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TensorProto.segment)
+}
 inline ::onnx::TensorProto_Segment* TensorProto::release_segment() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::onnx::TensorProto_Segment* temp = _impl_.segment_;
+  _impl_.segment_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TensorProto_Segment* TensorProto::unsafe_arena_release_segment() {
   // @@protoc_insertion_point(field_release:onnx.TensorProto.segment)
-  _has_bits_[0] &= ~0x00000008u;
-  ::onnx::TensorProto_Segment* temp = segment_;
-  segment_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::onnx::TensorProto_Segment* temp = _impl_.segment_;
+  _impl_.segment_ = nullptr;
   return temp;
 }
 inline ::onnx::TensorProto_Segment* TensorProto::_internal_mutable_segment() {
-  _has_bits_[0] |= 0x00000008u;
-  if (segment_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TensorProto_Segment>(GetArenaNoVirtual());
-    segment_ = p;
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.segment_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TensorProto_Segment>(GetArenaForAllocation());
+    _impl_.segment_ = p;
   }
-  return segment_;
+  return _impl_.segment_;
 }
 inline ::onnx::TensorProto_Segment* TensorProto::mutable_segment() {
+  ::onnx::TensorProto_Segment* _msg = _internal_mutable_segment();
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.segment)
-  return _internal_mutable_segment();
+  return _msg;
 }
 inline void TensorProto::set_allocated_segment(::onnx::TensorProto_Segment* segment) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete segment_;
+    delete _impl_.segment_;
   }
   if (segment) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(segment);
     if (message_arena != submessage_arena) {
       segment = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, segment, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  segment_ = segment;
+  _impl_.segment_ = segment;
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorProto.segment)
 }
 
 // repeated float float_data = 4 [packed = true];
 inline int TensorProto::_internal_float_data_size() const {
-  return float_data_.size();
+  return _impl_.float_data_.size();
 }
 inline int TensorProto::float_data_size() const {
   return _internal_float_data_size();
 }
 inline void TensorProto::clear_float_data() {
-  float_data_.Clear();
+  _impl_.float_data_.Clear();
 }
 inline float TensorProto::_internal_float_data(int index) const {
-  return float_data_.Get(index);
+  return _impl_.float_data_.Get(index);
 }
 inline float TensorProto::float_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.float_data)
   return _internal_float_data(index);
 }
 inline void TensorProto::set_float_data(int index, float value) {
-  float_data_.Set(index, value);
+  _impl_.float_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.float_data)
 }
 inline void TensorProto::_internal_add_float_data(float value) {
-  float_data_.Add(value);
+  _impl_.float_data_.Add(value);
 }
 inline void TensorProto::add_float_data(float value) {
   _internal_add_float_data(value);
@@ -7131,7 +7590,7 @@ inline void TensorProto::add_float_data(float value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 TensorProto::_internal_float_data() const {
-  return float_data_;
+  return _impl_.float_data_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 TensorProto::float_data() const {
@@ -7140,7 +7599,7 @@ TensorProto::float_data() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 TensorProto::_internal_mutable_float_data() {
-  return &float_data_;
+  return &_impl_.float_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 TensorProto::mutable_float_data() {
@@ -7150,46 +7609,46 @@ TensorProto::mutable_float_data() {
 
 // repeated int32 int32_data = 5 [packed = true];
 inline int TensorProto::_internal_int32_data_size() const {
-  return int32_data_.size();
+  return _impl_.int32_data_.size();
 }
 inline int TensorProto::int32_data_size() const {
   return _internal_int32_data_size();
 }
 inline void TensorProto::clear_int32_data() {
-  int32_data_.Clear();
+  _impl_.int32_data_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TensorProto::_internal_int32_data(int index) const {
-  return int32_data_.Get(index);
+inline int32_t TensorProto::_internal_int32_data(int index) const {
+  return _impl_.int32_data_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TensorProto::int32_data(int index) const {
+inline int32_t TensorProto::int32_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.int32_data)
   return _internal_int32_data(index);
 }
-inline void TensorProto::set_int32_data(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
-  int32_data_.Set(index, value);
+inline void TensorProto::set_int32_data(int index, int32_t value) {
+  _impl_.int32_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.int32_data)
 }
-inline void TensorProto::_internal_add_int32_data(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  int32_data_.Add(value);
+inline void TensorProto::_internal_add_int32_data(int32_t value) {
+  _impl_.int32_data_.Add(value);
 }
-inline void TensorProto::add_int32_data(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TensorProto::add_int32_data(int32_t value) {
   _internal_add_int32_data(value);
   // @@protoc_insertion_point(field_add:onnx.TensorProto.int32_data)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TensorProto::_internal_int32_data() const {
-  return int32_data_;
+  return _impl_.int32_data_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TensorProto::int32_data() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.int32_data)
   return _internal_int32_data();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TensorProto::_internal_mutable_int32_data() {
-  return &int32_data_;
+  return &_impl_.int32_data_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TensorProto::mutable_int32_data() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.int32_data)
   return _internal_mutable_int32_data();
@@ -7197,20 +7656,21 @@ TensorProto::mutable_int32_data() {
 
 // repeated bytes string_data = 6;
 inline int TensorProto::_internal_string_data_size() const {
-  return string_data_.size();
+  return _impl_.string_data_.size();
 }
 inline int TensorProto::string_data_size() const {
   return _internal_string_data_size();
 }
 inline void TensorProto::clear_string_data() {
-  string_data_.Clear();
+  _impl_.string_data_.Clear();
 }
 inline std::string* TensorProto::add_string_data() {
+  std::string* _s = _internal_add_string_data();
   // @@protoc_insertion_point(field_add_mutable:onnx.TensorProto.string_data)
-  return _internal_add_string_data();
+  return _s;
 }
 inline const std::string& TensorProto::_internal_string_data(int index) const {
-  return string_data_.Get(index);
+  return _impl_.string_data_.Get(index);
 }
 inline const std::string& TensorProto::string_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.string_data)
@@ -7218,99 +7678,99 @@ inline const std::string& TensorProto::string_data(int index) const {
 }
 inline std::string* TensorProto::mutable_string_data(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.string_data)
-  return string_data_.Mutable(index);
+  return _impl_.string_data_.Mutable(index);
 }
 inline void TensorProto::set_string_data(int index, const std::string& value) {
+  _impl_.string_data_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.string_data)
-  string_data_.Mutable(index)->assign(value);
 }
 inline void TensorProto::set_string_data(int index, std::string&& value) {
+  _impl_.string_data_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:onnx.TensorProto.string_data)
-  string_data_.Mutable(index)->assign(std::move(value));
 }
 inline void TensorProto::set_string_data(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  string_data_.Mutable(index)->assign(value);
+  _impl_.string_data_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:onnx.TensorProto.string_data)
 }
 inline void TensorProto::set_string_data(int index, const void* value, size_t size) {
-  string_data_.Mutable(index)->assign(
+  _impl_.string_data_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:onnx.TensorProto.string_data)
 }
 inline std::string* TensorProto::_internal_add_string_data() {
-  return string_data_.Add();
+  return _impl_.string_data_.Add();
 }
 inline void TensorProto::add_string_data(const std::string& value) {
-  string_data_.Add()->assign(value);
+  _impl_.string_data_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:onnx.TensorProto.string_data)
 }
 inline void TensorProto::add_string_data(std::string&& value) {
-  string_data_.Add(std::move(value));
+  _impl_.string_data_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:onnx.TensorProto.string_data)
 }
 inline void TensorProto::add_string_data(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  string_data_.Add()->assign(value);
+  _impl_.string_data_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:onnx.TensorProto.string_data)
 }
 inline void TensorProto::add_string_data(const void* value, size_t size) {
-  string_data_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.string_data_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:onnx.TensorProto.string_data)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 TensorProto::string_data() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.string_data)
-  return string_data_;
+  return _impl_.string_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 TensorProto::mutable_string_data() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.string_data)
-  return &string_data_;
+  return &_impl_.string_data_;
 }
 
 // repeated int64 int64_data = 7 [packed = true];
 inline int TensorProto::_internal_int64_data_size() const {
-  return int64_data_.size();
+  return _impl_.int64_data_.size();
 }
 inline int TensorProto::int64_data_size() const {
   return _internal_int64_data_size();
 }
 inline void TensorProto::clear_int64_data() {
-  int64_data_.Clear();
+  _impl_.int64_data_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto::_internal_int64_data(int index) const {
-  return int64_data_.Get(index);
+inline int64_t TensorProto::_internal_int64_data(int index) const {
+  return _impl_.int64_data_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorProto::int64_data(int index) const {
+inline int64_t TensorProto::int64_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.int64_data)
   return _internal_int64_data(index);
 }
-inline void TensorProto::set_int64_data(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  int64_data_.Set(index, value);
+inline void TensorProto::set_int64_data(int index, int64_t value) {
+  _impl_.int64_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.int64_data)
 }
-inline void TensorProto::_internal_add_int64_data(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  int64_data_.Add(value);
+inline void TensorProto::_internal_add_int64_data(int64_t value) {
+  _impl_.int64_data_.Add(value);
 }
-inline void TensorProto::add_int64_data(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorProto::add_int64_data(int64_t value) {
   _internal_add_int64_data(value);
   // @@protoc_insertion_point(field_add:onnx.TensorProto.int64_data)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 TensorProto::_internal_int64_data() const {
-  return int64_data_;
+  return _impl_.int64_data_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 TensorProto::int64_data() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.int64_data)
   return _internal_int64_data();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 TensorProto::_internal_mutable_int64_data() {
-  return &int64_data_;
+  return &_impl_.int64_data_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 TensorProto::mutable_int64_data() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.int64_data)
   return _internal_mutable_int64_data();
@@ -7318,270 +7778,262 @@ TensorProto::mutable_int64_data() {
 
 // optional string name = 8;
 inline bool TensorProto::_internal_has_name() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool TensorProto::has_name() const {
   return _internal_has_name();
 }
 inline void TensorProto::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TensorProto::name() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.name)
   return _internal_name();
 }
-inline void TensorProto::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorProto::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorProto.name)
 }
 inline std::string* TensorProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& TensorProto::_internal_name() const {
-  return name_.GetNoArena();
+  return _impl_.name_.Get();
 }
 inline void TensorProto::_internal_set_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorProto::set_name(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorProto.name)
-}
-inline void TensorProto::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorProto.name)
-}
-inline void TensorProto::set_name(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorProto.name)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorProto::_internal_mutable_name() {
-  _has_bits_[0] |= 0x00000001u;
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TensorProto::release_name() {
   // @@protoc_insertion_point(field_release:onnx.TensorProto.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return name_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TensorProto::set_allocated_name(std::string* name) {
   if (name != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorProto.name)
 }
 
 // optional string doc_string = 12;
 inline bool TensorProto::_internal_has_doc_string() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool TensorProto::has_doc_string() const {
   return _internal_has_doc_string();
 }
 inline void TensorProto::clear_doc_string() {
-  doc_string_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000004u;
+  _impl_.doc_string_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline const std::string& TensorProto::doc_string() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.doc_string)
   return _internal_doc_string();
 }
-inline void TensorProto::set_doc_string(const std::string& value) {
-  _internal_set_doc_string(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorProto::set_doc_string(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.doc_string_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorProto.doc_string)
 }
 inline std::string* TensorProto::mutable_doc_string() {
+  std::string* _s = _internal_mutable_doc_string();
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.doc_string)
-  return _internal_mutable_doc_string();
+  return _s;
 }
 inline const std::string& TensorProto::_internal_doc_string() const {
-  return doc_string_.GetNoArena();
+  return _impl_.doc_string_.Get();
 }
 inline void TensorProto::_internal_set_doc_string(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorProto::set_doc_string(std::string&& value) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorProto.doc_string)
-}
-inline void TensorProto::set_doc_string(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorProto.doc_string)
-}
-inline void TensorProto::set_doc_string(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000004u;
-  doc_string_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorProto.doc_string)
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.doc_string_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorProto::_internal_mutable_doc_string() {
-  _has_bits_[0] |= 0x00000004u;
-  return doc_string_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.doc_string_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TensorProto::release_doc_string() {
   // @@protoc_insertion_point(field_release:onnx.TensorProto.doc_string)
   if (!_internal_has_doc_string()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  return doc_string_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.doc_string_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TensorProto::set_allocated_doc_string(std::string* doc_string) {
   if (doc_string != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.doc_string_.SetAllocated(doc_string, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.doc_string_.IsDefault()) {
+    _impl_.doc_string_.Set("", GetArenaForAllocation());
   }
-  doc_string_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), doc_string);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorProto.doc_string)
 }
 
 // optional bytes raw_data = 9;
 inline bool TensorProto::_internal_has_raw_data() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool TensorProto::has_raw_data() const {
   return _internal_has_raw_data();
 }
 inline void TensorProto::clear_raw_data() {
-  raw_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.raw_data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const std::string& TensorProto::raw_data() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.raw_data)
   return _internal_raw_data();
 }
-inline void TensorProto::set_raw_data(const std::string& value) {
-  _internal_set_raw_data(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorProto::set_raw_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.raw_data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorProto.raw_data)
 }
 inline std::string* TensorProto::mutable_raw_data() {
+  std::string* _s = _internal_mutable_raw_data();
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.raw_data)
-  return _internal_mutable_raw_data();
+  return _s;
 }
 inline const std::string& TensorProto::_internal_raw_data() const {
-  return raw_data_.GetNoArena();
+  return _impl_.raw_data_.Get();
 }
 inline void TensorProto::_internal_set_raw_data(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  raw_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorProto::set_raw_data(std::string&& value) {
-  _has_bits_[0] |= 0x00000002u;
-  raw_data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorProto.raw_data)
-}
-inline void TensorProto::set_raw_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000002u;
-  raw_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorProto.raw_data)
-}
-inline void TensorProto::set_raw_data(const void* value, size_t size) {
-  _has_bits_[0] |= 0x00000002u;
-  raw_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorProto.raw_data)
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.raw_data_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorProto::_internal_mutable_raw_data() {
-  _has_bits_[0] |= 0x00000002u;
-  return raw_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.raw_data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TensorProto::release_raw_data() {
   // @@protoc_insertion_point(field_release:onnx.TensorProto.raw_data)
   if (!_internal_has_raw_data()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000002u;
-  return raw_data_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.raw_data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_data_.IsDefault()) {
+    _impl_.raw_data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TensorProto::set_allocated_raw_data(std::string* raw_data) {
   if (raw_data != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.raw_data_.SetAllocated(raw_data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.raw_data_.IsDefault()) {
+    _impl_.raw_data_.Set("", GetArenaForAllocation());
   }
-  raw_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), raw_data);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorProto.raw_data)
 }
 
 // repeated .onnx.StringStringEntryProto external_data = 13;
 inline int TensorProto::_internal_external_data_size() const {
-  return external_data_.size();
+  return _impl_.external_data_.size();
 }
 inline int TensorProto::external_data_size() const {
   return _internal_external_data_size();
 }
 inline void TensorProto::clear_external_data() {
-  external_data_.Clear();
+  _impl_.external_data_.Clear();
 }
 inline ::onnx::StringStringEntryProto* TensorProto::mutable_external_data(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.TensorProto.external_data)
-  return external_data_.Mutable(index);
+  return _impl_.external_data_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >*
 TensorProto::mutable_external_data() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.external_data)
-  return &external_data_;
+  return &_impl_.external_data_;
 }
 inline const ::onnx::StringStringEntryProto& TensorProto::_internal_external_data(int index) const {
-  return external_data_.Get(index);
+  return _impl_.external_data_.Get(index);
 }
 inline const ::onnx::StringStringEntryProto& TensorProto::external_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.external_data)
   return _internal_external_data(index);
 }
 inline ::onnx::StringStringEntryProto* TensorProto::_internal_add_external_data() {
-  return external_data_.Add();
+  return _impl_.external_data_.Add();
 }
 inline ::onnx::StringStringEntryProto* TensorProto::add_external_data() {
+  ::onnx::StringStringEntryProto* _add = _internal_add_external_data();
   // @@protoc_insertion_point(field_add:onnx.TensorProto.external_data)
-  return _internal_add_external_data();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::StringStringEntryProto >&
 TensorProto::external_data() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.external_data)
-  return external_data_;
+  return _impl_.external_data_;
 }
 
 // optional .onnx.TensorProto.DataLocation data_location = 14;
 inline bool TensorProto::_internal_has_data_location() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool TensorProto::has_data_location() const {
   return _internal_has_data_location();
 }
 inline void TensorProto::clear_data_location() {
-  data_location_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _impl_.data_location_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
 inline ::onnx::TensorProto_DataLocation TensorProto::_internal_data_location() const {
-  return static_cast< ::onnx::TensorProto_DataLocation >(data_location_);
+  return static_cast< ::onnx::TensorProto_DataLocation >(_impl_.data_location_);
 }
 inline ::onnx::TensorProto_DataLocation TensorProto::data_location() const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.data_location)
@@ -7589,8 +8041,8 @@ inline ::onnx::TensorProto_DataLocation TensorProto::data_location() const {
 }
 inline void TensorProto::_internal_set_data_location(::onnx::TensorProto_DataLocation value) {
   assert(::onnx::TensorProto_DataLocation_IsValid(value));
-  _has_bits_[0] |= 0x00000020u;
-  data_location_ = value;
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.data_location_ = value;
 }
 inline void TensorProto::set_data_location(::onnx::TensorProto_DataLocation value) {
   _internal_set_data_location(value);
@@ -7599,27 +8051,27 @@ inline void TensorProto::set_data_location(::onnx::TensorProto_DataLocation valu
 
 // repeated double double_data = 10 [packed = true];
 inline int TensorProto::_internal_double_data_size() const {
-  return double_data_.size();
+  return _impl_.double_data_.size();
 }
 inline int TensorProto::double_data_size() const {
   return _internal_double_data_size();
 }
 inline void TensorProto::clear_double_data() {
-  double_data_.Clear();
+  _impl_.double_data_.Clear();
 }
 inline double TensorProto::_internal_double_data(int index) const {
-  return double_data_.Get(index);
+  return _impl_.double_data_.Get(index);
 }
 inline double TensorProto::double_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.double_data)
   return _internal_double_data(index);
 }
 inline void TensorProto::set_double_data(int index, double value) {
-  double_data_.Set(index, value);
+  _impl_.double_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.double_data)
 }
 inline void TensorProto::_internal_add_double_data(double value) {
-  double_data_.Add(value);
+  _impl_.double_data_.Add(value);
 }
 inline void TensorProto::add_double_data(double value) {
   _internal_add_double_data(value);
@@ -7627,7 +8079,7 @@ inline void TensorProto::add_double_data(double value) {
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 TensorProto::_internal_double_data() const {
-  return double_data_;
+  return _impl_.double_data_;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
 TensorProto::double_data() const {
@@ -7636,7 +8088,7 @@ TensorProto::double_data() const {
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 TensorProto::_internal_mutable_double_data() {
-  return &double_data_;
+  return &_impl_.double_data_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
 TensorProto::mutable_double_data() {
@@ -7646,46 +8098,46 @@ TensorProto::mutable_double_data() {
 
 // repeated uint64 uint64_data = 11 [packed = true];
 inline int TensorProto::_internal_uint64_data_size() const {
-  return uint64_data_.size();
+  return _impl_.uint64_data_.size();
 }
 inline int TensorProto::uint64_data_size() const {
   return _internal_uint64_data_size();
 }
 inline void TensorProto::clear_uint64_data() {
-  uint64_data_.Clear();
+  _impl_.uint64_data_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 TensorProto::_internal_uint64_data(int index) const {
-  return uint64_data_.Get(index);
+inline uint64_t TensorProto::_internal_uint64_data(int index) const {
+  return _impl_.uint64_data_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 TensorProto::uint64_data(int index) const {
+inline uint64_t TensorProto::uint64_data(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorProto.uint64_data)
   return _internal_uint64_data(index);
 }
-inline void TensorProto::set_uint64_data(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  uint64_data_.Set(index, value);
+inline void TensorProto::set_uint64_data(int index, uint64_t value) {
+  _impl_.uint64_data_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.TensorProto.uint64_data)
 }
-inline void TensorProto::_internal_add_uint64_data(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  uint64_data_.Add(value);
+inline void TensorProto::_internal_add_uint64_data(uint64_t value) {
+  _impl_.uint64_data_.Add(value);
 }
-inline void TensorProto::add_uint64_data(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void TensorProto::add_uint64_data(uint64_t value) {
   _internal_add_uint64_data(value);
   // @@protoc_insertion_point(field_add:onnx.TensorProto.uint64_data)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 TensorProto::_internal_uint64_data() const {
-  return uint64_data_;
+  return _impl_.uint64_data_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 TensorProto::uint64_data() const {
   // @@protoc_insertion_point(field_list:onnx.TensorProto.uint64_data)
   return _internal_uint64_data();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 TensorProto::_internal_mutable_uint64_data() {
-  return &uint64_data_;
+  return &_impl_.uint64_data_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 TensorProto::mutable_uint64_data() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorProto.uint64_data)
   return _internal_mutable_uint64_data();
@@ -7697,166 +8149,226 @@ TensorProto::mutable_uint64_data() {
 
 // optional .onnx.TensorProto values = 1;
 inline bool SparseTensorProto::_internal_has_values() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || values_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.values_ != nullptr);
   return value;
 }
 inline bool SparseTensorProto::has_values() const {
   return _internal_has_values();
 }
 inline void SparseTensorProto::clear_values() {
-  if (values_ != nullptr) values_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.values_ != nullptr) _impl_.values_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::onnx::TensorProto& SparseTensorProto::_internal_values() const {
-  const ::onnx::TensorProto* p = values_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TensorProto*>(
-      &::onnx::_TensorProto_default_instance_);
+  const ::onnx::TensorProto* p = _impl_.values_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TensorProto&>(
+      ::onnx::_TensorProto_default_instance_);
 }
 inline const ::onnx::TensorProto& SparseTensorProto::values() const {
   // @@protoc_insertion_point(field_get:onnx.SparseTensorProto.values)
   return _internal_values();
 }
+inline void SparseTensorProto::unsafe_arena_set_allocated_values(
+    ::onnx::TensorProto* values) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.values_);
+  }
+  _impl_.values_ = values;
+  if (values) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.SparseTensorProto.values)
+}
 inline ::onnx::TensorProto* SparseTensorProto::release_values() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TensorProto* temp = _impl_.values_;
+  _impl_.values_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TensorProto* SparseTensorProto::unsafe_arena_release_values() {
   // @@protoc_insertion_point(field_release:onnx.SparseTensorProto.values)
-  _has_bits_[0] &= ~0x00000001u;
-  ::onnx::TensorProto* temp = values_;
-  values_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TensorProto* temp = _impl_.values_;
+  _impl_.values_ = nullptr;
   return temp;
 }
 inline ::onnx::TensorProto* SparseTensorProto::_internal_mutable_values() {
-  _has_bits_[0] |= 0x00000001u;
-  if (values_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaNoVirtual());
-    values_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.values_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaForAllocation());
+    _impl_.values_ = p;
   }
-  return values_;
+  return _impl_.values_;
 }
 inline ::onnx::TensorProto* SparseTensorProto::mutable_values() {
+  ::onnx::TensorProto* _msg = _internal_mutable_values();
   // @@protoc_insertion_point(field_mutable:onnx.SparseTensorProto.values)
-  return _internal_mutable_values();
+  return _msg;
 }
 inline void SparseTensorProto::set_allocated_values(::onnx::TensorProto* values) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete values_;
+    delete _impl_.values_;
   }
   if (values) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(values);
     if (message_arena != submessage_arena) {
       values = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, values, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  values_ = values;
+  _impl_.values_ = values;
   // @@protoc_insertion_point(field_set_allocated:onnx.SparseTensorProto.values)
 }
 
 // optional .onnx.TensorProto indices = 2;
 inline bool SparseTensorProto::_internal_has_indices() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || indices_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.indices_ != nullptr);
   return value;
 }
 inline bool SparseTensorProto::has_indices() const {
   return _internal_has_indices();
 }
 inline void SparseTensorProto::clear_indices() {
-  if (indices_ != nullptr) indices_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+  if (_impl_.indices_ != nullptr) _impl_.indices_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline const ::onnx::TensorProto& SparseTensorProto::_internal_indices() const {
-  const ::onnx::TensorProto* p = indices_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TensorProto*>(
-      &::onnx::_TensorProto_default_instance_);
+  const ::onnx::TensorProto* p = _impl_.indices_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TensorProto&>(
+      ::onnx::_TensorProto_default_instance_);
 }
 inline const ::onnx::TensorProto& SparseTensorProto::indices() const {
   // @@protoc_insertion_point(field_get:onnx.SparseTensorProto.indices)
   return _internal_indices();
 }
+inline void SparseTensorProto::unsafe_arena_set_allocated_indices(
+    ::onnx::TensorProto* indices) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.indices_);
+  }
+  _impl_.indices_ = indices;
+  if (indices) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.SparseTensorProto.indices)
+}
 inline ::onnx::TensorProto* SparseTensorProto::release_indices() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::onnx::TensorProto* temp = _impl_.indices_;
+  _impl_.indices_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TensorProto* SparseTensorProto::unsafe_arena_release_indices() {
   // @@protoc_insertion_point(field_release:onnx.SparseTensorProto.indices)
-  _has_bits_[0] &= ~0x00000002u;
-  ::onnx::TensorProto* temp = indices_;
-  indices_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::onnx::TensorProto* temp = _impl_.indices_;
+  _impl_.indices_ = nullptr;
   return temp;
 }
 inline ::onnx::TensorProto* SparseTensorProto::_internal_mutable_indices() {
-  _has_bits_[0] |= 0x00000002u;
-  if (indices_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaNoVirtual());
-    indices_ = p;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.indices_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TensorProto>(GetArenaForAllocation());
+    _impl_.indices_ = p;
   }
-  return indices_;
+  return _impl_.indices_;
 }
 inline ::onnx::TensorProto* SparseTensorProto::mutable_indices() {
+  ::onnx::TensorProto* _msg = _internal_mutable_indices();
   // @@protoc_insertion_point(field_mutable:onnx.SparseTensorProto.indices)
-  return _internal_mutable_indices();
+  return _msg;
 }
 inline void SparseTensorProto::set_allocated_indices(::onnx::TensorProto* indices) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete indices_;
+    delete _impl_.indices_;
   }
   if (indices) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(indices);
     if (message_arena != submessage_arena) {
       indices = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, indices, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  indices_ = indices;
+  _impl_.indices_ = indices;
   // @@protoc_insertion_point(field_set_allocated:onnx.SparseTensorProto.indices)
 }
 
 // repeated int64 dims = 3;
 inline int SparseTensorProto::_internal_dims_size() const {
-  return dims_.size();
+  return _impl_.dims_.size();
 }
 inline int SparseTensorProto::dims_size() const {
   return _internal_dims_size();
 }
 inline void SparseTensorProto::clear_dims() {
-  dims_.Clear();
+  _impl_.dims_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 SparseTensorProto::_internal_dims(int index) const {
-  return dims_.Get(index);
+inline int64_t SparseTensorProto::_internal_dims(int index) const {
+  return _impl_.dims_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 SparseTensorProto::dims(int index) const {
+inline int64_t SparseTensorProto::dims(int index) const {
   // @@protoc_insertion_point(field_get:onnx.SparseTensorProto.dims)
   return _internal_dims(index);
 }
-inline void SparseTensorProto::set_dims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
-  dims_.Set(index, value);
+inline void SparseTensorProto::set_dims(int index, int64_t value) {
+  _impl_.dims_.Set(index, value);
   // @@protoc_insertion_point(field_set:onnx.SparseTensorProto.dims)
 }
-inline void SparseTensorProto::_internal_add_dims(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  dims_.Add(value);
+inline void SparseTensorProto::_internal_add_dims(int64_t value) {
+  _impl_.dims_.Add(value);
 }
-inline void SparseTensorProto::add_dims(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void SparseTensorProto::add_dims(int64_t value) {
   _internal_add_dims(value);
   // @@protoc_insertion_point(field_add:onnx.SparseTensorProto.dims)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 SparseTensorProto::_internal_dims() const {
-  return dims_;
+  return _impl_.dims_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
 SparseTensorProto::dims() const {
   // @@protoc_insertion_point(field_list:onnx.SparseTensorProto.dims)
   return _internal_dims();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 SparseTensorProto::_internal_mutable_dims() {
-  return &dims_;
+  return &_impl_.dims_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
 SparseTensorProto::mutable_dims() {
   // @@protoc_insertion_point(field_mutable_list:onnx.SparseTensorProto.dims)
   return _internal_mutable_dims();
@@ -7866,7 +8378,7 @@ SparseTensorProto::mutable_dims() {
 
 // TensorShapeProto_Dimension
 
-// optional int64 dim_value = 1;
+// int64 dim_value = 1;
 inline bool TensorShapeProto_Dimension::_internal_has_dim_value() const {
   return value_case() == kDimValue;
 }
@@ -7874,37 +8386,37 @@ inline bool TensorShapeProto_Dimension::has_dim_value() const {
   return _internal_has_dim_value();
 }
 inline void TensorShapeProto_Dimension::set_has_dim_value() {
-  _oneof_case_[0] = kDimValue;
+  _impl_._oneof_case_[0] = kDimValue;
 }
 inline void TensorShapeProto_Dimension::clear_dim_value() {
   if (_internal_has_dim_value()) {
-    value_.dim_value_ = PROTOBUF_LONGLONG(0);
+    _impl_.value_.dim_value_ = int64_t{0};
     clear_has_value();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorShapeProto_Dimension::_internal_dim_value() const {
+inline int64_t TensorShapeProto_Dimension::_internal_dim_value() const {
   if (_internal_has_dim_value()) {
-    return value_.dim_value_;
+    return _impl_.value_.dim_value_;
   }
-  return PROTOBUF_LONGLONG(0);
+  return int64_t{0};
 }
-inline void TensorShapeProto_Dimension::_internal_set_dim_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorShapeProto_Dimension::_internal_set_dim_value(int64_t value) {
   if (!_internal_has_dim_value()) {
     clear_value();
     set_has_dim_value();
   }
-  value_.dim_value_ = value;
+  _impl_.value_.dim_value_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 TensorShapeProto_Dimension::dim_value() const {
+inline int64_t TensorShapeProto_Dimension::dim_value() const {
   // @@protoc_insertion_point(field_get:onnx.TensorShapeProto.Dimension.dim_value)
   return _internal_dim_value();
 }
-inline void TensorShapeProto_Dimension::set_dim_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void TensorShapeProto_Dimension::set_dim_value(int64_t value) {
   _internal_set_dim_value(value);
   // @@protoc_insertion_point(field_set:onnx.TensorShapeProto.Dimension.dim_value)
 }
 
-// optional string dim_param = 2;
+// string dim_param = 2;
 inline bool TensorShapeProto_Dimension::_internal_has_dim_param() const {
   return value_case() == kDimParam;
 }
@@ -7912,11 +8424,11 @@ inline bool TensorShapeProto_Dimension::has_dim_param() const {
   return _internal_has_dim_param();
 }
 inline void TensorShapeProto_Dimension::set_has_dim_param() {
-  _oneof_case_[0] = kDimParam;
+  _impl_._oneof_case_[0] = kDimParam;
 }
 inline void TensorShapeProto_Dimension::clear_dim_param() {
   if (_internal_has_dim_param()) {
-    value_.dim_param_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.dim_param_.Destroy();
     clear_has_value();
   }
 }
@@ -7924,72 +8436,48 @@ inline const std::string& TensorShapeProto_Dimension::dim_param() const {
   // @@protoc_insertion_point(field_get:onnx.TensorShapeProto.Dimension.dim_param)
   return _internal_dim_param();
 }
-inline void TensorShapeProto_Dimension::set_dim_param(const std::string& value) {
-  _internal_set_dim_param(value);
+template <typename ArgT0, typename... ArgT>
+inline void TensorShapeProto_Dimension::set_dim_param(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_dim_param()) {
+    clear_value();
+    set_has_dim_param();
+    _impl_.value_.dim_param_.InitDefault();
+  }
+  _impl_.value_.dim_param_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorShapeProto.Dimension.dim_param)
 }
 inline std::string* TensorShapeProto_Dimension::mutable_dim_param() {
+  std::string* _s = _internal_mutable_dim_param();
   // @@protoc_insertion_point(field_mutable:onnx.TensorShapeProto.Dimension.dim_param)
-  return _internal_mutable_dim_param();
+  return _s;
 }
 inline const std::string& TensorShapeProto_Dimension::_internal_dim_param() const {
   if (_internal_has_dim_param()) {
-    return value_.dim_param_.GetNoArena();
+    return _impl_.value_.dim_param_.Get();
   }
-  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
 inline void TensorShapeProto_Dimension::_internal_set_dim_param(const std::string& value) {
   if (!_internal_has_dim_param()) {
     clear_value();
     set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.dim_param_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorShapeProto_Dimension::set_dim_param(std::string&& value) {
-  // @@protoc_insertion_point(field_set:onnx.TensorShapeProto.Dimension.dim_param)
-  if (!_internal_has_dim_param()) {
-    clear_value();
-    set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.dim_param_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorShapeProto.Dimension.dim_param)
-}
-inline void TensorShapeProto_Dimension::set_dim_param(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!_internal_has_dim_param()) {
-    clear_value();
-    set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.dim_param_.InitDefault();
   }
-  value_.dim_param_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorShapeProto.Dimension.dim_param)
-}
-inline void TensorShapeProto_Dimension::set_dim_param(const char* value, size_t size) {
-  if (!_internal_has_dim_param()) {
-    clear_value();
-    set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.dim_param_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorShapeProto.Dimension.dim_param)
+  _impl_.value_.dim_param_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorShapeProto_Dimension::_internal_mutable_dim_param() {
   if (!_internal_has_dim_param()) {
     clear_value();
     set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.dim_param_.InitDefault();
   }
-  return value_.dim_param_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.dim_param_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* TensorShapeProto_Dimension::release_dim_param() {
   // @@protoc_insertion_point(field_release:onnx.TensorShapeProto.Dimension.dim_param)
   if (_internal_has_dim_param()) {
     clear_has_value();
-    return value_.dim_param_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    return _impl_.value_.dim_param_.Release();
   } else {
     return nullptr;
   }
@@ -8000,79 +8488,76 @@ inline void TensorShapeProto_Dimension::set_allocated_dim_param(std::string* dim
   }
   if (dim_param != nullptr) {
     set_has_dim_param();
-    value_.dim_param_.UnsafeSetDefault(dim_param);
+    _impl_.value_.dim_param_.InitAllocated(dim_param, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorShapeProto.Dimension.dim_param)
 }
 
 // optional string denotation = 3;
 inline bool TensorShapeProto_Dimension::_internal_has_denotation() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool TensorShapeProto_Dimension::has_denotation() const {
   return _internal_has_denotation();
 }
 inline void TensorShapeProto_Dimension::clear_denotation() {
-  denotation_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.denotation_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TensorShapeProto_Dimension::denotation() const {
   // @@protoc_insertion_point(field_get:onnx.TensorShapeProto.Dimension.denotation)
   return _internal_denotation();
 }
-inline void TensorShapeProto_Dimension::set_denotation(const std::string& value) {
-  _internal_set_denotation(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorShapeProto_Dimension::set_denotation(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.denotation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TensorShapeProto.Dimension.denotation)
 }
 inline std::string* TensorShapeProto_Dimension::mutable_denotation() {
+  std::string* _s = _internal_mutable_denotation();
   // @@protoc_insertion_point(field_mutable:onnx.TensorShapeProto.Dimension.denotation)
-  return _internal_mutable_denotation();
+  return _s;
 }
 inline const std::string& TensorShapeProto_Dimension::_internal_denotation() const {
-  return denotation_.GetNoArena();
+  return _impl_.denotation_.Get();
 }
 inline void TensorShapeProto_Dimension::_internal_set_denotation(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TensorShapeProto_Dimension::set_denotation(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TensorShapeProto.Dimension.denotation)
-}
-inline void TensorShapeProto_Dimension::set_denotation(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TensorShapeProto.Dimension.denotation)
-}
-inline void TensorShapeProto_Dimension::set_denotation(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TensorShapeProto.Dimension.denotation)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.denotation_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TensorShapeProto_Dimension::_internal_mutable_denotation() {
-  _has_bits_[0] |= 0x00000001u;
-  return denotation_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.denotation_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TensorShapeProto_Dimension::release_denotation() {
   // @@protoc_insertion_point(field_release:onnx.TensorShapeProto.Dimension.denotation)
   if (!_internal_has_denotation()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return denotation_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.denotation_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.denotation_.IsDefault()) {
+    _impl_.denotation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TensorShapeProto_Dimension::set_allocated_denotation(std::string* denotation) {
   if (denotation != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  denotation_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), denotation);
+  _impl_.denotation_.SetAllocated(denotation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.denotation_.IsDefault()) {
+    _impl_.denotation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TensorShapeProto.Dimension.denotation)
 }
 
@@ -8080,10 +8565,10 @@ inline bool TensorShapeProto_Dimension::has_value() const {
   return value_case() != VALUE_NOT_SET;
 }
 inline void TensorShapeProto_Dimension::clear_has_value() {
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 inline TensorShapeProto_Dimension::ValueCase TensorShapeProto_Dimension::value_case() const {
-  return TensorShapeProto_Dimension::ValueCase(_oneof_case_[0]);
+  return TensorShapeProto_Dimension::ValueCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -8091,41 +8576,42 @@ inline TensorShapeProto_Dimension::ValueCase TensorShapeProto_Dimension::value_c
 
 // repeated .onnx.TensorShapeProto.Dimension dim = 1;
 inline int TensorShapeProto::_internal_dim_size() const {
-  return dim_.size();
+  return _impl_.dim_.size();
 }
 inline int TensorShapeProto::dim_size() const {
   return _internal_dim_size();
 }
 inline void TensorShapeProto::clear_dim() {
-  dim_.Clear();
+  _impl_.dim_.Clear();
 }
 inline ::onnx::TensorShapeProto_Dimension* TensorShapeProto::mutable_dim(int index) {
   // @@protoc_insertion_point(field_mutable:onnx.TensorShapeProto.dim)
-  return dim_.Mutable(index);
+  return _impl_.dim_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorShapeProto_Dimension >*
 TensorShapeProto::mutable_dim() {
   // @@protoc_insertion_point(field_mutable_list:onnx.TensorShapeProto.dim)
-  return &dim_;
+  return &_impl_.dim_;
 }
 inline const ::onnx::TensorShapeProto_Dimension& TensorShapeProto::_internal_dim(int index) const {
-  return dim_.Get(index);
+  return _impl_.dim_.Get(index);
 }
 inline const ::onnx::TensorShapeProto_Dimension& TensorShapeProto::dim(int index) const {
   // @@protoc_insertion_point(field_get:onnx.TensorShapeProto.dim)
   return _internal_dim(index);
 }
 inline ::onnx::TensorShapeProto_Dimension* TensorShapeProto::_internal_add_dim() {
-  return dim_.Add();
+  return _impl_.dim_.Add();
 }
 inline ::onnx::TensorShapeProto_Dimension* TensorShapeProto::add_dim() {
+  ::onnx::TensorShapeProto_Dimension* _add = _internal_add_dim();
   // @@protoc_insertion_point(field_add:onnx.TensorShapeProto.dim)
-  return _internal_add_dim();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::onnx::TensorShapeProto_Dimension >&
 TensorShapeProto::dim() const {
   // @@protoc_insertion_point(field_list:onnx.TensorShapeProto.dim)
-  return dim_;
+  return _impl_.dim_;
 }
 
 // -------------------------------------------------------------------
@@ -8134,89 +8620,119 @@ TensorShapeProto::dim() const {
 
 // optional int32 elem_type = 1;
 inline bool TypeProto_Tensor::_internal_has_elem_type() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool TypeProto_Tensor::has_elem_type() const {
   return _internal_has_elem_type();
 }
 inline void TypeProto_Tensor::clear_elem_type() {
-  elem_type_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.elem_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TypeProto_Tensor::_internal_elem_type() const {
-  return elem_type_;
+inline int32_t TypeProto_Tensor::_internal_elem_type() const {
+  return _impl_.elem_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TypeProto_Tensor::elem_type() const {
+inline int32_t TypeProto_Tensor::elem_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.Tensor.elem_type)
   return _internal_elem_type();
 }
-inline void TypeProto_Tensor::_internal_set_elem_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000002u;
-  elem_type_ = value;
+inline void TypeProto_Tensor::_internal_set_elem_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.elem_type_ = value;
 }
-inline void TypeProto_Tensor::set_elem_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TypeProto_Tensor::set_elem_type(int32_t value) {
   _internal_set_elem_type(value);
   // @@protoc_insertion_point(field_set:onnx.TypeProto.Tensor.elem_type)
 }
 
 // optional .onnx.TensorShapeProto shape = 2;
 inline bool TypeProto_Tensor::_internal_has_shape() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || shape_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.shape_ != nullptr);
   return value;
 }
 inline bool TypeProto_Tensor::has_shape() const {
   return _internal_has_shape();
 }
 inline void TypeProto_Tensor::clear_shape() {
-  if (shape_ != nullptr) shape_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.shape_ != nullptr) _impl_.shape_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::onnx::TensorShapeProto& TypeProto_Tensor::_internal_shape() const {
-  const ::onnx::TensorShapeProto* p = shape_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TensorShapeProto*>(
-      &::onnx::_TensorShapeProto_default_instance_);
+  const ::onnx::TensorShapeProto* p = _impl_.shape_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TensorShapeProto&>(
+      ::onnx::_TensorShapeProto_default_instance_);
 }
 inline const ::onnx::TensorShapeProto& TypeProto_Tensor::shape() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.Tensor.shape)
   return _internal_shape();
 }
+inline void TypeProto_Tensor::unsafe_arena_set_allocated_shape(
+    ::onnx::TensorShapeProto* shape) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shape_);
+  }
+  _impl_.shape_ = shape;
+  if (shape) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.Tensor.shape)
+}
 inline ::onnx::TensorShapeProto* TypeProto_Tensor::release_shape() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TensorShapeProto* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TensorShapeProto* TypeProto_Tensor::unsafe_arena_release_shape() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.Tensor.shape)
-  _has_bits_[0] &= ~0x00000001u;
-  ::onnx::TensorShapeProto* temp = shape_;
-  shape_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TensorShapeProto* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
   return temp;
 }
 inline ::onnx::TensorShapeProto* TypeProto_Tensor::_internal_mutable_shape() {
-  _has_bits_[0] |= 0x00000001u;
-  if (shape_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TensorShapeProto>(GetArenaNoVirtual());
-    shape_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.shape_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TensorShapeProto>(GetArenaForAllocation());
+    _impl_.shape_ = p;
   }
-  return shape_;
+  return _impl_.shape_;
 }
 inline ::onnx::TensorShapeProto* TypeProto_Tensor::mutable_shape() {
+  ::onnx::TensorShapeProto* _msg = _internal_mutable_shape();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.Tensor.shape)
-  return _internal_mutable_shape();
+  return _msg;
 }
 inline void TypeProto_Tensor::set_allocated_shape(::onnx::TensorShapeProto* shape) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete shape_;
+    delete _impl_.shape_;
   }
   if (shape) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shape);
     if (message_arena != submessage_arena) {
       shape = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, shape, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  shape_ = shape;
+  _impl_.shape_ = shape;
   // @@protoc_insertion_point(field_set_allocated:onnx.TypeProto.Tensor.shape)
 }
 
@@ -8226,61 +8742,91 @@ inline void TypeProto_Tensor::set_allocated_shape(::onnx::TensorShapeProto* shap
 
 // optional .onnx.TypeProto elem_type = 1;
 inline bool TypeProto_Sequence::_internal_has_elem_type() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || elem_type_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.elem_type_ != nullptr);
   return value;
 }
 inline bool TypeProto_Sequence::has_elem_type() const {
   return _internal_has_elem_type();
 }
 inline void TypeProto_Sequence::clear_elem_type() {
-  if (elem_type_ != nullptr) elem_type_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.elem_type_ != nullptr) _impl_.elem_type_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::onnx::TypeProto& TypeProto_Sequence::_internal_elem_type() const {
-  const ::onnx::TypeProto* p = elem_type_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TypeProto*>(
-      &::onnx::_TypeProto_default_instance_);
+  const ::onnx::TypeProto* p = _impl_.elem_type_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TypeProto&>(
+      ::onnx::_TypeProto_default_instance_);
 }
 inline const ::onnx::TypeProto& TypeProto_Sequence::elem_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.Sequence.elem_type)
   return _internal_elem_type();
 }
+inline void TypeProto_Sequence::unsafe_arena_set_allocated_elem_type(
+    ::onnx::TypeProto* elem_type) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.elem_type_);
+  }
+  _impl_.elem_type_ = elem_type;
+  if (elem_type) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.Sequence.elem_type)
+}
 inline ::onnx::TypeProto* TypeProto_Sequence::release_elem_type() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TypeProto* temp = _impl_.elem_type_;
+  _impl_.elem_type_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TypeProto* TypeProto_Sequence::unsafe_arena_release_elem_type() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.Sequence.elem_type)
-  _has_bits_[0] &= ~0x00000001u;
-  ::onnx::TypeProto* temp = elem_type_;
-  elem_type_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TypeProto* temp = _impl_.elem_type_;
+  _impl_.elem_type_ = nullptr;
   return temp;
 }
 inline ::onnx::TypeProto* TypeProto_Sequence::_internal_mutable_elem_type() {
-  _has_bits_[0] |= 0x00000001u;
-  if (elem_type_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaNoVirtual());
-    elem_type_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.elem_type_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaForAllocation());
+    _impl_.elem_type_ = p;
   }
-  return elem_type_;
+  return _impl_.elem_type_;
 }
 inline ::onnx::TypeProto* TypeProto_Sequence::mutable_elem_type() {
+  ::onnx::TypeProto* _msg = _internal_mutable_elem_type();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.Sequence.elem_type)
-  return _internal_mutable_elem_type();
+  return _msg;
 }
 inline void TypeProto_Sequence::set_allocated_elem_type(::onnx::TypeProto* elem_type) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete elem_type_;
+    delete _impl_.elem_type_;
   }
   if (elem_type) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(elem_type);
     if (message_arena != submessage_arena) {
       elem_type = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, elem_type, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  elem_type_ = elem_type;
+  _impl_.elem_type_ = elem_type;
   // @@protoc_insertion_point(field_set_allocated:onnx.TypeProto.Sequence.elem_type)
 }
 
@@ -8290,89 +8836,119 @@ inline void TypeProto_Sequence::set_allocated_elem_type(::onnx::TypeProto* elem_
 
 // optional int32 key_type = 1;
 inline bool TypeProto_Map::_internal_has_key_type() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool TypeProto_Map::has_key_type() const {
   return _internal_has_key_type();
 }
 inline void TypeProto_Map::clear_key_type() {
-  key_type_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.key_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TypeProto_Map::_internal_key_type() const {
-  return key_type_;
+inline int32_t TypeProto_Map::_internal_key_type() const {
+  return _impl_.key_type_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 TypeProto_Map::key_type() const {
+inline int32_t TypeProto_Map::key_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.Map.key_type)
   return _internal_key_type();
 }
-inline void TypeProto_Map::_internal_set_key_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _has_bits_[0] |= 0x00000002u;
-  key_type_ = value;
+inline void TypeProto_Map::_internal_set_key_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_type_ = value;
 }
-inline void TypeProto_Map::set_key_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TypeProto_Map::set_key_type(int32_t value) {
   _internal_set_key_type(value);
   // @@protoc_insertion_point(field_set:onnx.TypeProto.Map.key_type)
 }
 
 // optional .onnx.TypeProto value_type = 2;
 inline bool TypeProto_Map::_internal_has_value_type() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || value_type_ != nullptr);
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_type_ != nullptr);
   return value;
 }
 inline bool TypeProto_Map::has_value_type() const {
   return _internal_has_value_type();
 }
 inline void TypeProto_Map::clear_value_type() {
-  if (value_type_ != nullptr) value_type_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+  if (_impl_.value_type_ != nullptr) _impl_.value_type_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const ::onnx::TypeProto& TypeProto_Map::_internal_value_type() const {
-  const ::onnx::TypeProto* p = value_type_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::onnx::TypeProto*>(
-      &::onnx::_TypeProto_default_instance_);
+  const ::onnx::TypeProto* p = _impl_.value_type_;
+  return p != nullptr ? *p : reinterpret_cast<const ::onnx::TypeProto&>(
+      ::onnx::_TypeProto_default_instance_);
 }
 inline const ::onnx::TypeProto& TypeProto_Map::value_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.Map.value_type)
   return _internal_value_type();
 }
+inline void TypeProto_Map::unsafe_arena_set_allocated_value_type(
+    ::onnx::TypeProto* value_type) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_type_);
+  }
+  _impl_.value_type_ = value_type;
+  if (value_type) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.Map.value_type)
+}
 inline ::onnx::TypeProto* TypeProto_Map::release_value_type() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TypeProto* temp = _impl_.value_type_;
+  _impl_.value_type_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::onnx::TypeProto* TypeProto_Map::unsafe_arena_release_value_type() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.Map.value_type)
-  _has_bits_[0] &= ~0x00000001u;
-  ::onnx::TypeProto* temp = value_type_;
-  value_type_ = nullptr;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::onnx::TypeProto* temp = _impl_.value_type_;
+  _impl_.value_type_ = nullptr;
   return temp;
 }
 inline ::onnx::TypeProto* TypeProto_Map::_internal_mutable_value_type() {
-  _has_bits_[0] |= 0x00000001u;
-  if (value_type_ == nullptr) {
-    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaNoVirtual());
-    value_type_ = p;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.value_type_ == nullptr) {
+    auto* p = CreateMaybeMessage<::onnx::TypeProto>(GetArenaForAllocation());
+    _impl_.value_type_ = p;
   }
-  return value_type_;
+  return _impl_.value_type_;
 }
 inline ::onnx::TypeProto* TypeProto_Map::mutable_value_type() {
+  ::onnx::TypeProto* _msg = _internal_mutable_value_type();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.Map.value_type)
-  return _internal_mutable_value_type();
+  return _msg;
 }
 inline void TypeProto_Map::set_allocated_value_type(::onnx::TypeProto* value_type) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete value_type_;
+    delete _impl_.value_type_;
   }
   if (value_type) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(value_type);
     if (message_arena != submessage_arena) {
       value_type = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, value_type, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  value_type_ = value_type;
+  _impl_.value_type_ = value_type;
   // @@protoc_insertion_point(field_set_allocated:onnx.TypeProto.Map.value_type)
 }
 
@@ -8380,7 +8956,7 @@ inline void TypeProto_Map::set_allocated_value_type(::onnx::TypeProto* value_typ
 
 // TypeProto
 
-// optional .onnx.TypeProto.Tensor tensor_type = 1;
+// .onnx.TypeProto.Tensor tensor_type = 1;
 inline bool TypeProto::_internal_has_tensor_type() const {
   return value_case() == kTensorType;
 }
@@ -8388,11 +8964,13 @@ inline bool TypeProto::has_tensor_type() const {
   return _internal_has_tensor_type();
 }
 inline void TypeProto::set_has_tensor_type() {
-  _oneof_case_[0] = kTensorType;
+  _impl_._oneof_case_[0] = kTensorType;
 }
 inline void TypeProto::clear_tensor_type() {
   if (_internal_has_tensor_type()) {
-    delete value_.tensor_type_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.tensor_type_;
+    }
     clear_has_value();
   }
 }
@@ -8400,8 +8978,11 @@ inline ::onnx::TypeProto_Tensor* TypeProto::release_tensor_type() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.tensor_type)
   if (_internal_has_tensor_type()) {
     clear_has_value();
-      ::onnx::TypeProto_Tensor* temp = value_.tensor_type_;
-    value_.tensor_type_ = nullptr;
+    ::onnx::TypeProto_Tensor* temp = _impl_.value_.tensor_type_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.tensor_type_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -8409,28 +8990,47 @@ inline ::onnx::TypeProto_Tensor* TypeProto::release_tensor_type() {
 }
 inline const ::onnx::TypeProto_Tensor& TypeProto::_internal_tensor_type() const {
   return _internal_has_tensor_type()
-      ? *value_.tensor_type_
-      : *reinterpret_cast< ::onnx::TypeProto_Tensor*>(&::onnx::_TypeProto_Tensor_default_instance_);
+      ? *_impl_.value_.tensor_type_
+      : reinterpret_cast< ::onnx::TypeProto_Tensor&>(::onnx::_TypeProto_Tensor_default_instance_);
 }
 inline const ::onnx::TypeProto_Tensor& TypeProto::tensor_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.tensor_type)
   return _internal_tensor_type();
 }
+inline ::onnx::TypeProto_Tensor* TypeProto::unsafe_arena_release_tensor_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:onnx.TypeProto.tensor_type)
+  if (_internal_has_tensor_type()) {
+    clear_has_value();
+    ::onnx::TypeProto_Tensor* temp = _impl_.value_.tensor_type_;
+    _impl_.value_.tensor_type_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TypeProto::unsafe_arena_set_allocated_tensor_type(::onnx::TypeProto_Tensor* tensor_type) {
+  clear_value();
+  if (tensor_type) {
+    set_has_tensor_type();
+    _impl_.value_.tensor_type_ = tensor_type;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.tensor_type)
+}
 inline ::onnx::TypeProto_Tensor* TypeProto::_internal_mutable_tensor_type() {
   if (!_internal_has_tensor_type()) {
     clear_value();
     set_has_tensor_type();
-    value_.tensor_type_ = CreateMaybeMessage< ::onnx::TypeProto_Tensor >(
-        GetArenaNoVirtual());
+    _impl_.value_.tensor_type_ = CreateMaybeMessage< ::onnx::TypeProto_Tensor >(GetArenaForAllocation());
   }
-  return value_.tensor_type_;
+  return _impl_.value_.tensor_type_;
 }
 inline ::onnx::TypeProto_Tensor* TypeProto::mutable_tensor_type() {
+  ::onnx::TypeProto_Tensor* _msg = _internal_mutable_tensor_type();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.tensor_type)
-  return _internal_mutable_tensor_type();
+  return _msg;
 }
 
-// optional .onnx.TypeProto.Sequence sequence_type = 4;
+// .onnx.TypeProto.Sequence sequence_type = 4;
 inline bool TypeProto::_internal_has_sequence_type() const {
   return value_case() == kSequenceType;
 }
@@ -8438,11 +9038,13 @@ inline bool TypeProto::has_sequence_type() const {
   return _internal_has_sequence_type();
 }
 inline void TypeProto::set_has_sequence_type() {
-  _oneof_case_[0] = kSequenceType;
+  _impl_._oneof_case_[0] = kSequenceType;
 }
 inline void TypeProto::clear_sequence_type() {
   if (_internal_has_sequence_type()) {
-    delete value_.sequence_type_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.sequence_type_;
+    }
     clear_has_value();
   }
 }
@@ -8450,8 +9052,11 @@ inline ::onnx::TypeProto_Sequence* TypeProto::release_sequence_type() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.sequence_type)
   if (_internal_has_sequence_type()) {
     clear_has_value();
-      ::onnx::TypeProto_Sequence* temp = value_.sequence_type_;
-    value_.sequence_type_ = nullptr;
+    ::onnx::TypeProto_Sequence* temp = _impl_.value_.sequence_type_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.sequence_type_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -8459,28 +9064,47 @@ inline ::onnx::TypeProto_Sequence* TypeProto::release_sequence_type() {
 }
 inline const ::onnx::TypeProto_Sequence& TypeProto::_internal_sequence_type() const {
   return _internal_has_sequence_type()
-      ? *value_.sequence_type_
-      : *reinterpret_cast< ::onnx::TypeProto_Sequence*>(&::onnx::_TypeProto_Sequence_default_instance_);
+      ? *_impl_.value_.sequence_type_
+      : reinterpret_cast< ::onnx::TypeProto_Sequence&>(::onnx::_TypeProto_Sequence_default_instance_);
 }
 inline const ::onnx::TypeProto_Sequence& TypeProto::sequence_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.sequence_type)
   return _internal_sequence_type();
 }
+inline ::onnx::TypeProto_Sequence* TypeProto::unsafe_arena_release_sequence_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:onnx.TypeProto.sequence_type)
+  if (_internal_has_sequence_type()) {
+    clear_has_value();
+    ::onnx::TypeProto_Sequence* temp = _impl_.value_.sequence_type_;
+    _impl_.value_.sequence_type_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TypeProto::unsafe_arena_set_allocated_sequence_type(::onnx::TypeProto_Sequence* sequence_type) {
+  clear_value();
+  if (sequence_type) {
+    set_has_sequence_type();
+    _impl_.value_.sequence_type_ = sequence_type;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.sequence_type)
+}
 inline ::onnx::TypeProto_Sequence* TypeProto::_internal_mutable_sequence_type() {
   if (!_internal_has_sequence_type()) {
     clear_value();
     set_has_sequence_type();
-    value_.sequence_type_ = CreateMaybeMessage< ::onnx::TypeProto_Sequence >(
-        GetArenaNoVirtual());
+    _impl_.value_.sequence_type_ = CreateMaybeMessage< ::onnx::TypeProto_Sequence >(GetArenaForAllocation());
   }
-  return value_.sequence_type_;
+  return _impl_.value_.sequence_type_;
 }
 inline ::onnx::TypeProto_Sequence* TypeProto::mutable_sequence_type() {
+  ::onnx::TypeProto_Sequence* _msg = _internal_mutable_sequence_type();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.sequence_type)
-  return _internal_mutable_sequence_type();
+  return _msg;
 }
 
-// optional .onnx.TypeProto.Map map_type = 5;
+// .onnx.TypeProto.Map map_type = 5;
 inline bool TypeProto::_internal_has_map_type() const {
   return value_case() == kMapType;
 }
@@ -8488,11 +9112,13 @@ inline bool TypeProto::has_map_type() const {
   return _internal_has_map_type();
 }
 inline void TypeProto::set_has_map_type() {
-  _oneof_case_[0] = kMapType;
+  _impl_._oneof_case_[0] = kMapType;
 }
 inline void TypeProto::clear_map_type() {
   if (_internal_has_map_type()) {
-    delete value_.map_type_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.map_type_;
+    }
     clear_has_value();
   }
 }
@@ -8500,8 +9126,11 @@ inline ::onnx::TypeProto_Map* TypeProto::release_map_type() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.map_type)
   if (_internal_has_map_type()) {
     clear_has_value();
-      ::onnx::TypeProto_Map* temp = value_.map_type_;
-    value_.map_type_ = nullptr;
+    ::onnx::TypeProto_Map* temp = _impl_.value_.map_type_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.value_.map_type_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -8509,95 +9138,111 @@ inline ::onnx::TypeProto_Map* TypeProto::release_map_type() {
 }
 inline const ::onnx::TypeProto_Map& TypeProto::_internal_map_type() const {
   return _internal_has_map_type()
-      ? *value_.map_type_
-      : *reinterpret_cast< ::onnx::TypeProto_Map*>(&::onnx::_TypeProto_Map_default_instance_);
+      ? *_impl_.value_.map_type_
+      : reinterpret_cast< ::onnx::TypeProto_Map&>(::onnx::_TypeProto_Map_default_instance_);
 }
 inline const ::onnx::TypeProto_Map& TypeProto::map_type() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.map_type)
   return _internal_map_type();
 }
+inline ::onnx::TypeProto_Map* TypeProto::unsafe_arena_release_map_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:onnx.TypeProto.map_type)
+  if (_internal_has_map_type()) {
+    clear_has_value();
+    ::onnx::TypeProto_Map* temp = _impl_.value_.map_type_;
+    _impl_.value_.map_type_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TypeProto::unsafe_arena_set_allocated_map_type(::onnx::TypeProto_Map* map_type) {
+  clear_value();
+  if (map_type) {
+    set_has_map_type();
+    _impl_.value_.map_type_ = map_type;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:onnx.TypeProto.map_type)
+}
 inline ::onnx::TypeProto_Map* TypeProto::_internal_mutable_map_type() {
   if (!_internal_has_map_type()) {
     clear_value();
     set_has_map_type();
-    value_.map_type_ = CreateMaybeMessage< ::onnx::TypeProto_Map >(
-        GetArenaNoVirtual());
+    _impl_.value_.map_type_ = CreateMaybeMessage< ::onnx::TypeProto_Map >(GetArenaForAllocation());
   }
-  return value_.map_type_;
+  return _impl_.value_.map_type_;
 }
 inline ::onnx::TypeProto_Map* TypeProto::mutable_map_type() {
+  ::onnx::TypeProto_Map* _msg = _internal_mutable_map_type();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.map_type)
-  return _internal_mutable_map_type();
+  return _msg;
 }
 
 // optional string denotation = 6;
 inline bool TypeProto::_internal_has_denotation() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool TypeProto::has_denotation() const {
   return _internal_has_denotation();
 }
 inline void TypeProto::clear_denotation() {
-  denotation_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.denotation_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& TypeProto::denotation() const {
   // @@protoc_insertion_point(field_get:onnx.TypeProto.denotation)
   return _internal_denotation();
 }
-inline void TypeProto::set_denotation(const std::string& value) {
-  _internal_set_denotation(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TypeProto::set_denotation(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.denotation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.TypeProto.denotation)
 }
 inline std::string* TypeProto::mutable_denotation() {
+  std::string* _s = _internal_mutable_denotation();
   // @@protoc_insertion_point(field_mutable:onnx.TypeProto.denotation)
-  return _internal_mutable_denotation();
+  return _s;
 }
 inline const std::string& TypeProto::_internal_denotation() const {
-  return denotation_.GetNoArena();
+  return _impl_.denotation_.Get();
 }
 inline void TypeProto::_internal_set_denotation(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void TypeProto::set_denotation(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.TypeProto.denotation)
-}
-inline void TypeProto::set_denotation(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.TypeProto.denotation)
-}
-inline void TypeProto::set_denotation(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  denotation_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.TypeProto.denotation)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.denotation_.Set(value, GetArenaForAllocation());
 }
 inline std::string* TypeProto::_internal_mutable_denotation() {
-  _has_bits_[0] |= 0x00000001u;
-  return denotation_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.denotation_.Mutable(GetArenaForAllocation());
 }
 inline std::string* TypeProto::release_denotation() {
   // @@protoc_insertion_point(field_release:onnx.TypeProto.denotation)
   if (!_internal_has_denotation()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return denotation_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.denotation_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.denotation_.IsDefault()) {
+    _impl_.denotation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void TypeProto::set_allocated_denotation(std::string* denotation) {
   if (denotation != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.denotation_.SetAllocated(denotation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.denotation_.IsDefault()) {
+    _impl_.denotation_.Set("", GetArenaForAllocation());
   }
-  denotation_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), denotation);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.TypeProto.denotation)
 }
 
@@ -8605,10 +9250,10 @@ inline bool TypeProto::has_value() const {
   return value_case() != VALUE_NOT_SET;
 }
 inline void TypeProto::clear_has_value() {
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 inline TypeProto::ValueCase TypeProto::value_case() const {
-  return TypeProto::ValueCase(_oneof_case_[0]);
+  return TypeProto::ValueCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -8616,99 +9261,96 @@ inline TypeProto::ValueCase TypeProto::value_case() const {
 
 // optional string domain = 1;
 inline bool OperatorSetIdProto::_internal_has_domain() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool OperatorSetIdProto::has_domain() const {
   return _internal_has_domain();
 }
 inline void OperatorSetIdProto::clear_domain() {
-  domain_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.domain_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& OperatorSetIdProto::domain() const {
   // @@protoc_insertion_point(field_get:onnx.OperatorSetIdProto.domain)
   return _internal_domain();
 }
-inline void OperatorSetIdProto::set_domain(const std::string& value) {
-  _internal_set_domain(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OperatorSetIdProto::set_domain(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.domain_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:onnx.OperatorSetIdProto.domain)
 }
 inline std::string* OperatorSetIdProto::mutable_domain() {
+  std::string* _s = _internal_mutable_domain();
   // @@protoc_insertion_point(field_mutable:onnx.OperatorSetIdProto.domain)
-  return _internal_mutable_domain();
+  return _s;
 }
 inline const std::string& OperatorSetIdProto::_internal_domain() const {
-  return domain_.GetNoArena();
+  return _impl_.domain_.Get();
 }
 inline void OperatorSetIdProto::_internal_set_domain(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void OperatorSetIdProto::set_domain(std::string&& value) {
-  _has_bits_[0] |= 0x00000001u;
-  domain_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:onnx.OperatorSetIdProto.domain)
-}
-inline void OperatorSetIdProto::set_domain(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _has_bits_[0] |= 0x00000001u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:onnx.OperatorSetIdProto.domain)
-}
-inline void OperatorSetIdProto::set_domain(const char* value, size_t size) {
-  _has_bits_[0] |= 0x00000001u;
-  domain_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:onnx.OperatorSetIdProto.domain)
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.domain_.Set(value, GetArenaForAllocation());
 }
 inline std::string* OperatorSetIdProto::_internal_mutable_domain() {
-  _has_bits_[0] |= 0x00000001u;
-  return domain_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.domain_.Mutable(GetArenaForAllocation());
 }
 inline std::string* OperatorSetIdProto::release_domain() {
   // @@protoc_insertion_point(field_release:onnx.OperatorSetIdProto.domain)
   if (!_internal_has_domain()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  return domain_.ReleaseNonDefaultNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.domain_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
 inline void OperatorSetIdProto::set_allocated_domain(std::string* domain) {
   if (domain != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.domain_.SetAllocated(domain, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.domain_.IsDefault()) {
+    _impl_.domain_.Set("", GetArenaForAllocation());
   }
-  domain_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), domain);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:onnx.OperatorSetIdProto.domain)
 }
 
 // optional int64 version = 2;
 inline bool OperatorSetIdProto::_internal_has_version() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool OperatorSetIdProto::has_version() const {
   return _internal_has_version();
 }
 inline void OperatorSetIdProto::clear_version() {
-  version_ = PROTOBUF_LONGLONG(0);
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.version_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 OperatorSetIdProto::_internal_version() const {
-  return version_;
+inline int64_t OperatorSetIdProto::_internal_version() const {
+  return _impl_.version_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 OperatorSetIdProto::version() const {
+inline int64_t OperatorSetIdProto::version() const {
   // @@protoc_insertion_point(field_get:onnx.OperatorSetIdProto.version)
   return _internal_version();
 }
-inline void OperatorSetIdProto::_internal_set_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _has_bits_[0] |= 0x00000002u;
-  version_ = value;
+inline void OperatorSetIdProto::_internal_set_version(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.version_ = value;
 }
-inline void OperatorSetIdProto::set_version(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void OperatorSetIdProto::set_version(int64_t value) {
   _internal_set_version(value);
   // @@protoc_insertion_point(field_set:onnx.OperatorSetIdProto.version)
 }
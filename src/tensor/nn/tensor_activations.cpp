@@ -7,6 +7,7 @@
 * All rights reserved
 */
 #include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/cpu_hw.h"
 #include "eddl/hardware/cpu/nn/cpu_nn.h"
 
 #ifdef cGPU
@@ -40,6 +41,32 @@ void ReLu(Tensor *A, Tensor *B) {
     B->tsem->unlock();
 }
 
+// In-place activation applied as the epilogue of a Dense/Conv output (act is one of GEMM_ACT_*)
+void FusedActivation(Tensor *A, int act, float param) {
+    if (act == GEMM_ACT_NONE) return;
+
+    A->tsem->lock();
+    if (A->isCPU()) {
+        cpu_act_epilogue(A->ptr, A->size, act, param);
+    }
+#ifdef cGPU
+    else if (A->isGPU())
+      {
+      if (act == GEMM_ACT_RELU) gpu_relu(A,A);
+      else if (act == GEMM_ACT_LEAKY_RELU) gpu_leaky_relu(A,A,param);
+      else if (act == GEMM_ACT_SIGMOID) gpu_sigmoid(A,A);
+      else if (act == GEMM_ACT_TANH) gpu_tanh(A,A);
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+
+    A->tsem->unlock();
+}
+
 // RELU Derivative, always increment over parent delta
 void D_ReLu(Tensor *D, Tensor *I, Tensor *PD) {
     if ((D->device != I->device) || (D->device != PD->device)) {
@@ -0,0 +1,47 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+
+void Attention(AttentionDescriptor *D) {
+    /////////////////////////////////////////////////////////////////////
+    //// Attention
+    //// O = softmax(Q*K^T/sqrt(head_dim))*V, for every head
+    //// Q, O are (Batch*Lq) x (Heads*Head_dim), K, V are (Batch*Lk) x (Heads*Head_dim)
+    //// The Lq x Lk attention matrix is never stored
+    /////////////////////////////////////////////////////////////////////
+    if ((D->Q->shape[1] != D->heads * D->head_dim) || (D->Q->shape[0] != D->batch * D->lq) || (D->K->shape[0] != D->batch * D->lk))
+        msg("Incompatible dims", "Tensor::Attention");
+
+    D->O->tsem->lock();
+    if (D->Q->isCPU()) {
+        cpu_attention(D);
+    }
+    else {
+        msg("Multi-head attention is only available on CPU", "Tensor::Attention");
+    }
+    D->O->tsem->unlock();
+}
+
+void D_Attention(AttentionDescriptor *D) {
+    /////////////////////////////////////////////////////////////////////
+    //// D_Attention
+    //// From dO computes dQ, dK and dV (not incremented),
+    //// the attention tiles are recomputed
+    /////////////////////////////////////////////////////////////////////
+    D->dQ->tsem->lock();
+    if (D->Q->isCPU()) {
+        cpu_attention_back(D);
+    }
+    else {
+        msg("Multi-head attention is only available on CPU", "Tensor::D_Attention");
+    }
+    D->dQ->tsem->unlock();
+}
@@ -89,3 +89,45 @@ void permute_batch_first(Tensor *A,Tensor *B)
     }
 #endif
 }
+
+
+void LayerNorm(Tensor *A, Tensor *B, Tensor *opa, Tensor *mean, Tensor *sd, Tensor *gamma, Tensor *beta, int rows, float epsilon)
+{
+  if ((A->size%rows)||(mean->size!=rows)||(sd->size!=rows))
+    msg("Incompatible dims","LayerNorm");
+  if ((gamma!=nullptr)&&((A->size/rows)%gamma->size))
+    msg("Incompatible affine dims","LayerNorm");
+
+  if (A->isCPU()) {
+        cpu_layernorm(A,B,opa,mean,sd,gamma,beta,rows,epsilon);
+  }
+#ifdef cGPU
+  else if (A->isGPU())
+      {
+        msg("Not implemented for GPU","LayerNorm");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
+
+void D_LayerNorm(Tensor *D, Tensor *opa, Tensor *sd, Tensor *gamma, Tensor *ggamma, Tensor *gbeta, Tensor *PD, int rows)
+{
+  if (D->isCPU()) {
+        cpu_layernorm_back(D,opa,sd,gamma,ggamma,gbeta,PD,rows);
+  }
+#ifdef cGPU
+  else if (D->isGPU())
+      {
+        msg("Not implemented for GPU","D_LayerNorm");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
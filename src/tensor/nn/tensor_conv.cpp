@@ -21,9 +21,10 @@ void Conv2D(ConvolDescriptor *D) {
     //// Conv2D
     //// Dimensions must be compatible
     //// A is input 4D Tensor, Batch x Channels x Rows x Cols
+    //// (or 3D, Batch x Channels x Length, for 1D convolutions)
     //// D is a ConvolDescriptor
     /////////////////////////////////////////////////////////////////////
-    if ((D->I->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2D");
+    if ((D->I->ndim != 4) && (D->I->ndim != 3)) msg("Tensors are not 3D or 4D", "Tensor::Conv2D");
 
     D->O->tsem->lock();
     if (D->I->isCPU()) {
@@ -42,6 +43,9 @@ void Conv2D(ConvolDescriptor *D) {
     }
 #endif
     D->O->tsem->unlock();
+
+    // the CPU kernel applies the fused activation as an epilogue
+    if (!D->I->isCPU()) FusedActivation(D->O, D->act, D->act_param);
 }
 
 void Conv2D_grad(ConvolDescriptor *D) {
@@ -49,9 +53,10 @@ void Conv2D_grad(ConvolDescriptor *D) {
     //// Conv2D Grad
     //// Dimensions must be compatible
     //// A is input 4D Tensor, Batch x Channels x Rows x Cols
+    //// (or 3D, Batch x Channels x Length, for 1D convolutions)
     //// D is a ConvolDescriptor
     /////////////////////////////////////////////////////////////////////
-    if ((D->I->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2D");
+    if ((D->I->ndim != 4) && (D->I->ndim != 3)) msg("Tensors are not 3D or 4D", "Tensor::Conv2D");
 
     D->gK->tsem->lock();
     if (D->I->isCPU()) {
@@ -76,9 +81,10 @@ void Conv2D_back(ConvolDescriptor *D) {
     //// Conv2D Back
     //// Dimensions must be compatible
     //// A is input 4D Tensor, Batch x Channels x Rows x Cols
+    //// (or 3D, Batch x Channels x Length, for 1D convolutions)
     //// D is a ConvolDescriptor
     /////////////////////////////////////////////////////////////////////
-    if ((D->I->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2D");
+    if ((D->I->ndim != 4) && (D->I->ndim != 3)) msg("Tensors are not 3D or 4D", "Tensor::Conv2D");
 
     D->ID->tsem->lock();
     if (D->I->isCPU()) {
@@ -97,3 +103,95 @@ void Conv2D_back(ConvolDescriptor *D) {
 #endif
     D->ID->tsem->unlock();
 }
+
+
+void ConvT2D(ConvolDescriptor *D, Tensor *A, Tensor *B) {
+    /////////////////////////////////////////////////////////////////////
+    //// ConvT2D
+    //// A is input 4D Tensor, Batch x Channels x Rows x Cols
+    //// B is output 4D Tensor, D the (direct) convolution from B to A
+    /////////////////////////////////////////////////////////////////////
+    if ((A->ndim != 4) || (B->ndim != 4)) msg("Tensors are not 4D", "Tensor::ConvT2D");
+    if ((A->shape[1] != D->nk) || (B->shape[1] != D->iz) || (D->groups != 1)) msg("Incompatible dims", "Tensor::ConvT2D");
+
+    B->tsem->lock();
+    if (A->isCPU()) {
+        cpu_convT2D(D, A, B);
+    }
+    else {
+        msg("Transposed convolutions are only available on CPU", "Tensor::ConvT2D");
+    }
+    B->tsem->unlock();
+}
+
+void ConvT2D_grad(ConvolDescriptor *D, Tensor *A, Tensor *DB) {
+    /////////////////////////////////////////////////////////////////////
+    //// ConvT2D Grad
+    //// A is the input and DB the output delta, uses the lowering of
+    //// ConvT2D_back
+    /////////////////////////////////////////////////////////////////////
+    if ((A->ndim != 4) || (DB->ndim != 4)) msg("Tensors are not 4D", "Tensor::ConvT2D_grad");
+
+    D->gK->tsem->lock();
+    if (A->isCPU()) {
+        cpu_convT2D_grad(D, A, DB);
+    }
+    else {
+        msg("Transposed convolutions are only available on CPU", "Tensor::ConvT2D_grad");
+    }
+    D->gK->tsem->unlock();
+}
+
+void ConvT2D_back(ConvolDescriptor *D, Tensor *DB, Tensor *DA) {
+    /////////////////////////////////////////////////////////////////////
+    //// ConvT2D Back
+    //// DB is the output delta, its convolution is added to DA
+    /////////////////////////////////////////////////////////////////////
+    if ((DB->ndim != 4) || (DA->ndim != 4)) msg("Tensors are not 4D", "Tensor::ConvT2D_back");
+
+    DA->tsem->lock();
+    if (DB->isCPU()) {
+        cpu_convT2D_back(D, DB, DA);
+    }
+    else {
+        msg("Transposed convolutions are only available on CPU", "Tensor::ConvT2D_back");
+    }
+    DA->tsem->unlock();
+}
+
+
+void Dense_int8(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *B) {
+    /////////////////////////////////////////////////////////////////////
+    //// Dense_int8
+    //// A is the float input (batch x K), B the float output (batch x N)
+    //// Q holds the int8 weights and the calibrated input range
+    /////////////////////////////////////////////////////////////////////
+    if ((A->ndim != 2) || (B->ndim != 2)) msg("Tensors are not 2D", "Tensor::Dense_int8");
+    if ((A->shape[1] != Q->ksize) || (B->shape[1] != Q->channels)) msg("Incompatible dims", "Tensor::Dense_int8");
+
+    B->tsem->lock();
+    if (A->isCPU()) {
+        cpu_dense_int8(A, Q, bias, B);
+    }
+    else {
+        msg("Int8 inference is only available on CPU", "Tensor::Dense_int8");
+    }
+    B->tsem->unlock();
+}
+
+void Conv2D_int8(ConvolDescriptor *D, QuantDescriptor *Q) {
+    /////////////////////////////////////////////////////////////////////
+    //// Conv2D_int8
+    //// Same as Conv2D, with the filters taken from Q in int8
+    /////////////////////////////////////////////////////////////////////
+    if ((D->I->ndim != 4) && (D->I->ndim != 3)) msg("Tensors are not 3D or 4D", "Tensor::Conv2D_int8");
+
+    D->O->tsem->lock();
+    if (D->I->isCPU()) {
+        cpu_conv2D_int8(D, Q);
+    }
+    else {
+        msg("Int8 inference is only available on CPU", "Tensor::Conv2D_int8");
+    }
+    D->O->tsem->unlock();
+}
@@ -0,0 +1,107 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+#ifdef cGPU
+#include "eddl/hardware/gpu/gpu_tensor.h"
+#include "eddl/hardware/gpu/gpu_hw.h"
+#include "eddl/hardware/gpu/nn/gpu_nn.h"
+#endif
+
+
+void zero_rows(Tensor *A, const vector<int> &rows)
+{
+  if (A->isCPU()) {
+        cpu_zero_rows(A,rows);
+  }
+#ifdef cGPU
+  else if (A->isGPU())
+      {
+        msg("Row-sparse updates are only available on CPU","zero_rows");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
+
+void inc_rows(Tensor *D, Tensor *G, const vector<int> &ids, const vector<int> &start, const vector<int> &order, bool mask_zeros)
+{
+  if (G->isCPU()) {
+        cpu_inc_rows(D,G,ids,start,order,mask_zeros);
+  }
+#ifdef cGPU
+  else if (G->isGPU())
+      {
+        msg("Row-sparse updates are only available on CPU","inc_rows");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
+
+void sgd_rows(Tensor *W, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu)
+{
+  if (W->isCPU()) {
+        cpu_sgd_rows(W,G,M,rows,lr,mu);
+  }
+#ifdef cGPU
+  else if (W->isGPU())
+      {
+        msg("Row-sparse updates are only available on CPU","sgd_rows");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
+
+void adam_rows(Tensor *W, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1, float beta_2, float epsilon, int t)
+{
+  if (W->isCPU()) {
+        cpu_adam_rows(W,G,M,V,rows,lr,beta_1,beta_2,epsilon,t);
+  }
+#ifdef cGPU
+  else if (W->isGPU())
+      {
+        msg("Row-sparse updates are only available on CPU","adam_rows");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
+
+void rmsprop_rows(Tensor *W, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon)
+{
+  if (W->isCPU()) {
+        cpu_rmsprop_rows(W,G,G1,rows,lr,rho,epsilon);
+  }
+#ifdef cGPU
+  else if (W->isGPU())
+      {
+        msg("Row-sparse updates are only available on CPU","rmsprop_rows");
+      }
+#endif
+#ifdef cFPGA
+  else {
+
+    }
+#endif
+}
@@ -73,6 +73,60 @@ void MPool2D_back(PoolDescriptor *D) {
 
 
 
+void MPool1D(PoolDescriptor *D) {
+    /////////////////////////////////////////////////////////////////////
+    //// MPool1D
+    //// Dimensions must be compatible
+    //// A is input 3D Tensor, Batch x Channels x Length
+    //// D is a PoolDescriptor
+    /////////////////////////////////////////////////////////////////////
+    if ((D->I->ndim != 3)) msg("Tensors are not 3D", "Tensor::MPool1D");
+
+    D->O->tsem->lock();
+    if (D->I->isCPU()) {
+        cpu_mpool1D(D);
+    }
+#ifdef cGPU
+    else if (D->I->isGPU())
+      {
+        gpu_mpool2D(D);
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+    D->O->tsem->unlock();
+}
+
+void MPool1D_back(PoolDescriptor *D) {
+    /////////////////////////////////////////////////////////////////////
+    //// MPool1D_back
+    //// Dimensions must be compatible
+    //// A is input 3D Tensor, Batch x Channels x Length
+    //// D is a PoolDescriptor
+    /////////////////////////////////////////////////////////////////////
+    if ((D->I->ndim != 3)) msg("Tensors are not 3D", "Tensor::MPool1D_back");
+
+    D->ID->tsem->lock();
+    if (D->I->isCPU()) {
+        cpu_mpool1D_back(D);
+    }
+#ifdef cGPU
+    else if (D->I->isGPU())
+      {
+        gpu_mpool2D_back(D);
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+    D->ID->tsem->unlock();
+}
+
 void AvgPool2D(PoolDescriptor *D) {
     /////////////////////////////////////////////////////////////////////
     //// AvgPool2D
@@ -0,0 +1,228 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.6
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include <cmath>
+#include <algorithm>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/tensor_expr.h"
+#include "eddl/hardware/cpu/cpu_hw.h"
+
+using namespace std;
+
+
+ExprNode::ExprNode(int op, Tensor *T, float val, shared_ptr<ExprNode> a, shared_ptr<ExprNode> b) {
+    this->op = op;
+    this->T = T;
+    this->val = val;
+    this->a = a;
+    this->b = b;
+}
+
+Expr::Expr(Tensor *T) {
+    if (T == nullptr) msg("Null tensor", "Expr::Expr");
+    node = make_shared<ExprNode>(EXPR_LOAD, T, 0.0f, nullptr, nullptr);
+}
+
+Expr::Expr(float v) {
+    node = make_shared<ExprNode>(EXPR_CONST, nullptr, v, nullptr, nullptr);
+}
+
+// Operations over constants are folded here
+static float expr_fold(int op, float x, float y) {
+    switch (op) {
+        case EXPR_ADD: return x + y;
+        case EXPR_SUB: return x - y;
+        case EXPR_MUL: return x * y;
+        case EXPR_DIV: return x / y;
+        case EXPR_NEG: return -x;
+        case EXPR_SQR: return x * x;
+        case EXPR_SQRT: return ::sqrtf(x);
+        case EXPR_EXP: return ::expf(x);
+        case EXPR_LOG: return ::logf(x);
+        case EXPR_ABS: return ::fabsf(x);
+        case EXPR_SIGN: return (float)((x > 0.0f) - (x < 0.0f));
+        case EXPR_POW: return ::powf(x, y);
+        case EXPR_MAX: return std::max(x, y);
+        case EXPR_MIN: return std::min(x, y);
+    }
+    return 0.0f;
+}
+
+Expr::Expr(int op, const Expr &a, const Expr &b) {
+    if (a.isconst() && b.isconst())
+        node = make_shared<ExprNode>(EXPR_CONST, nullptr, expr_fold(op, a.node->val, b.node->val), nullptr, nullptr);
+    else
+        node = make_shared<ExprNode>(op, nullptr, 0.0f, a.node, b.node);
+}
+
+// Unary operations, v is the scalar argument of pow, maximum and minimum
+Expr::Expr(int op, const Expr &a, float v) {
+    if (a.isconst())
+        node = make_shared<ExprNode>(EXPR_CONST, nullptr, expr_fold(op, a.node->val, v), nullptr, nullptr);
+    else
+        node = make_shared<ExprNode>(op, nullptr, v, a.node, nullptr);
+}
+
+Expr operator+(const Expr &a, const Expr &b) { return Expr(EXPR_ADD, a, b); }
+Expr operator-(const Expr &a, const Expr &b) { return Expr(EXPR_SUB, a, b); }
+Expr operator*(const Expr &a, const Expr &b) { return Expr(EXPR_MUL, a, b); }
+Expr operator/(const Expr &a, const Expr &b) { return Expr(EXPR_DIV, a, b); }
+Expr operator-(const Expr &a) { return Expr(EXPR_NEG, a, 0.0f); }
+
+Expr sqr(const Expr &a) { return Expr(EXPR_SQR, a, 0.0f); }
+Expr sqrt(const Expr &a) { return Expr(EXPR_SQRT, a, 0.0f); }
+Expr exp(const Expr &a) { return Expr(EXPR_EXP, a, 0.0f); }
+Expr log(const Expr &a) { return Expr(EXPR_LOG, a, 0.0f); }
+Expr abs(const Expr &a) { return Expr(EXPR_ABS, a, 0.0f); }
+Expr sign(const Expr &a) { return Expr(EXPR_SIGN, a, 0.0f); }
+Expr pow(const Expr &a, float e) { return Expr(EXPR_POW, a, e); }
+Expr maximum(const Expr &a, float v) { return Expr(EXPR_MAX, a, v); }
+Expr minimum(const Expr &a, float v) { return Expr(EXPR_MIN, a, v); }
+
+
+// A nullptr output reduces its statement (see Tensor::eval_sum)
+ExprProgram::ExprProgram(const vector<Tensor *> &outs, const vector<Expr> &exprs) {
+    if (outs.size() != exprs.size()) msg("Number of outputs and expressions differ", "ExprProgram");
+
+    depth = 1;
+    for (int i = 0; i < exprs.size(); i++) {
+        emit(exprs[i].node, 0);
+        ops.push_back({EXPR_STORE, (outs[i] == nullptr) ? -1 : tensor_index(outs[i]), 0.0f});
+    }
+
+    if (T.empty()) msg("Expressions without tensors", "ExprProgram");
+    for (int i = 1; i < T.size(); i++) {
+        if (!Tensor::eqsize(T[0], T[i])) msg("Incompatible dims", "ExprProgram");
+        if (T[0]->device != T[i]->device) msg("Tensors in different devices", "ExprProgram");
+    }
+    size = T[0]->size;
+}
+
+int ExprProgram::tensor_index(Tensor *A) {
+    for (int i = 0; i < T.size(); i++)
+        if (T[i] == A) return i;
+    T.push_back(A);
+    return T.size() - 1;
+}
+
+// level is the number of live values below the result of n
+void ExprProgram::emit(const shared_ptr<ExprNode> &n, int level) {
+    depth = std::max(depth, level + 1);
+
+    if (n->op == EXPR_LOAD) ops.push_back({EXPR_LOAD, tensor_index(n->T), 0.0f});
+    else if (n->op == EXPR_CONST) ops.push_back({EXPR_CONST, 0, n->val});
+    else if (n->b == nullptr) {
+        emit(n->a, level);
+        ops.push_back({n->op, 0, n->val});
+    }
+    else if (n->b->op == EXPR_CONST) {
+        emit(n->a, level);
+        ops.push_back({n->op, EXPR_VS, n->b->val});
+    }
+    else if (n->a->op == EXPR_CONST) {
+        emit(n->b, level);
+        ops.push_back({n->op, EXPR_SV, n->a->val});
+    }
+    else {
+        emit(n->a, level);
+        emit(n->b, level + 1);
+        ops.push_back({n->op, EXPR_VV, 0.0f});
+    }
+}
+
+
+// Other devices: the same program with one Tensor operation per instruction
+static float expr_eval_ops(ExprProgram *P) {
+    vector<Tensor *> st;
+    vector<bool> own;
+    float sum = 0.0f;
+
+    for (const ExprOp &o : P->ops) {
+        if (o.op == EXPR_LOAD) {
+            st.push_back(P->T[o.arg]);
+            own.push_back(false);
+            continue;
+        }
+        if (o.op == EXPR_CONST) {
+            st.push_back(new Tensor(P->T[0]->getShape(), P->T[0]->device));
+            st.back()->fill_(o.val);
+            own.push_back(true);
+            continue;
+        }
+
+        Tensor *x = st.back();
+        bool xown = own.back();
+        st.pop_back();
+        own.pop_back();
+
+        if (o.op == EXPR_STORE) {
+            if (o.arg < 0) sum += x->sum();
+            else if (x != P->T[o.arg]) Tensor::copy(x, P->T[o.arg]);
+            if (xown) delete x;
+            continue;
+        }
+
+        if ((o.op <= EXPR_DIV) && (o.arg == EXPR_VV)) {
+            Tensor *a = st.back();
+            Tensor *r = own.back() ? a : new Tensor(a->getShape(), a->device);
+            if (o.op == EXPR_ADD) Tensor::add(1.0f, a, 1.0f, x, r, 0);
+            else if (o.op == EXPR_SUB) Tensor::add(1.0f, a, -1.0f, x, r, 0);
+            else if (o.op == EXPR_MUL) Tensor::el_mult(a, x, r, 0);
+            else Tensor::el_div(a, x, r, 0);
+            if (xown) delete x;
+            st.back() = r;
+            own.back() = true;
+            continue;
+        }
+
+        Tensor *r = xown ? x : x->clone();
+        switch (o.op) {
+            case EXPR_ADD: r->add_(o.val); break;
+            case EXPR_SUB: if (o.arg == EXPR_VS) r->sub_(o.val); else { r->neg_(); r->add_(o.val); } break;
+            case EXPR_MUL: r->mult_(o.val); break;
+            case EXPR_DIV: if (o.arg == EXPR_VS) r->div_(o.val); else r->inv_(o.val); break;
+            case EXPR_NEG: r->neg_(); break;
+            case EXPR_SQR: r->sqr_(); break;
+            case EXPR_SQRT: r->sqrt_(); break;
+            case EXPR_EXP: r->exp_(); break;
+            case EXPR_LOG: r->log_(); break;
+            case EXPR_ABS: r->abs_(); break;
+            case EXPR_SIGN: r->sign_(); break;
+            case EXPR_POW: r->pow_(o.val); break;
+            case EXPR_MAX: r->clampmin_(o.val); break;
+            case EXPR_MIN: r->clampmax_(o.val); break;
+        }
+        st.push_back(r);
+        own.push_back(true);
+    }
+
+    return sum;
+}
+
+static float expr_eval(ExprProgram *P) {
+    if (P->T[0]->isCPU()) {
+        return cpu_eval(P);
+    }
+    return expr_eval_ops(P);
+}
+
+void Tensor::eval(Tensor *A, const Expr &e) {
+    ExprProgram P({A}, {e});
+    expr_eval(&P);
+}
+
+void Tensor::eval(const vector<Tensor*> &A, const vector<Expr> &e) {
+    ExprProgram P(A, e);
+    expr_eval(&P);
+}
+
+float Tensor::eval_sum(const Expr &e) {
+    ExprProgram P({nullptr}, {e});
+    return expr_eval(&P);
+}
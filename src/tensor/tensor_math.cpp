@@ -659,6 +659,95 @@ void Tensor::mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC) {
 }
 
 
+void Tensor::gemm(float alpha, Tensor *A, int tA, Tensor *B, int tB, float beta, Tensor *C, Tensor *bias, int act, float act_param) {
+    ///////////////////////////////////////
+    //// GEMM C=act(alpha*op(A)*op(B)+beta*C+bias)
+    //// tA, tB mean transpose A, B {0,1}
+    //// bias (optional) is a 1D Tensor added to every row of C
+    //// act is one of GEMM_ACT_*, applied while C is in cache
+    //// Only for 2D Tensors
+    ///////////////////////////////////////
+
+    if ((A->device != B->device) || (A->device != C->device)) {A->info();B->info();C->info();msg("Tensors in different devices", "Tensor::gemm");}
+    if ((A->ndim != 2) || (B->ndim != 2) || (C->ndim != 2)) msg("Only 2D tensors", "Tensor::gemm");
+    int m = tA ? A->shape[1] : A->shape[0];
+    int k = tA ? A->shape[0] : A->shape[1];
+    int kb = tB ? B->shape[1] : B->shape[0];
+    int n = tB ? B->shape[0] : B->shape[1];
+    if ((k != kb) || (m != C->shape[0]) || (n != C->shape[1])) msg("Incompatible dims", "Tensor::gemm");
+    if (bias != nullptr) {
+        if (bias->device != C->device) msg("Tensors in different devices", "Tensor::gemm");
+        if ((bias->ndim != 1) || (bias->shape[0] != n)) msg("Incompatible bias dims", "Tensor::gemm");
+    }
+
+    C->tsem->lock();
+
+    if (A->isCPU()) {
+        cpu_gemm(alpha, A, tA, B, tB, beta, C, bias, act, act_param);
+    }
+
+#ifdef cGPU
+    else if (A->isGPU())
+      {
+        if ((alpha != 1.0f) || ((beta != 0.0f) && (beta != 1.0f))) msg("Only alpha=1 and beta in {0,1} on GPU", "Tensor::gemm");
+        gpu_mult2D(A,tA,B,tB,C,(int)beta);
+        if (bias != nullptr) gpu_sum2D_rowwise(C,bias,C);
+        if (act == GEMM_ACT_RELU) gpu_relu(C,C);
+        else if (act == GEMM_ACT_LEAKY_RELU) gpu_leaky_relu(C,C,act_param);
+        else if (act == GEMM_ACT_SIGMOID) gpu_sigmoid(C,C);
+        else if (act == GEMM_ACT_TANH) gpu_tanh(C,C);
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+    C->tsem->unlock();
+}
+
+
+void Tensor::batched_mult2D(Tensor *A, int tA, Tensor *B, int tB, Tensor *C, int incC) {
+    ///////////////////////////////////////
+    //// BATCHED MULT2D C[i]=A[i]*B[i]
+    //// The last two dims hold the matrices, the leading dims
+    //// (batch included) must be equal and are flattened
+    //// tA, tB mean transpose A, B {0,1}
+    //// incC 1 means C+=A*B (increment over C)
+    ///////////////////////////////////////
+
+    if ((A->device != B->device) || (A->device != C->device)) {A->info();B->info();C->info();msg("Tensors in different devices", "Tensor::batched_mult2D");}
+    if ((A->ndim < 3) || (A->ndim != B->ndim) || (A->ndim != C->ndim)) msg("Only 3D (or more) tensors with equal ndim", "Tensor::batched_mult2D");
+    int nd = A->ndim;
+    for (int i = 0; i < nd - 2; i++)
+        if ((A->shape[i] != B->shape[i]) || (A->shape[i] != C->shape[i])) msg("Incompatible batch dims", "Tensor::batched_mult2D");
+    int m = tA ? A->shape[nd - 1] : A->shape[nd - 2];
+    int k = tA ? A->shape[nd - 2] : A->shape[nd - 1];
+    int kb = tB ? B->shape[nd - 1] : B->shape[nd - 2];
+    int n = tB ? B->shape[nd - 2] : B->shape[nd - 1];
+    if ((k != kb) || (m != C->shape[nd - 2]) || (n != C->shape[nd - 1])) msg("Incompatible dims", "Tensor::batched_mult2D");
+
+    C->tsem->lock();
+
+    if (A->isCPU()) {
+        cpu_batched_mult2D(A, tA, B, tB, C, incC);
+    }
+
+#ifdef cGPU
+    else if (A->isGPU())
+      {
+        msg("Not implemented for GPU", "Tensor::batched_mult2D");
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+    C->tsem->unlock();
+}
+
+
 void Tensor::el_mult(Tensor *A, Tensor *B, Tensor *C, int incC) {
     ///////////////////////////////////////
     //// Element Mult C=A.*B
@@ -841,6 +930,23 @@ Tensor* Tensor::round(Tensor *A){
     return t_new;
 }
 
+void Tensor::round_bfloat16_(){
+    if (isCPU()) {
+        cpu_round_bfloat16_(this);
+    }
+#ifdef cGPU
+    else if (isGPU())
+      {
+        msg("Not implemented for GPU", "Tensor::round_bfloat16_");
+      }
+#endif
+#ifdef cFPGA
+    else {
+
+    }
+#endif
+}
+
 void Tensor::rsqrt_(){
     if (isCPU()) {
         cpu_rsqrt_(this);
@@ -2,6 +2,7 @@
 #include <string>
 
 #include "eddl/descriptors/descriptors.h"
+#include "eddl/tensor/nn/tensor_nn.h"
 
 
 using namespace std;
@@ -43,3 +44,239 @@ TEST(Convol2DTestSuite, output_size)
         }
     }
 }
+
+
+static ConvolDescriptor* conv_forward(Tensor *I, Tensor *K, int filters, const vector<int> &ks, const vector<int> &st, int groups, const vector<int> &dil={1, 1}, const string &padding="same"){
+    auto *cd = new ConvolDescriptor(filters, ks, st, padding, false, 0, groups, dil);
+    cd->build(I);
+    Tensor::copy(K, cd->K);
+    Conv2D(cd);
+    return cd;
+}
+
+static void conv_backward(ConvolDescriptor *cd, Tensor *D){
+    cd->D = D;
+    cd->ID = Tensor::zeros(cd->I->shape);
+    cd->gK->fill_(0.0f);
+    Conv2D_grad(cd);
+    Conv2D_back(cd);
+}
+
+TEST(Convol2DTestSuite, grouped_matches_dense)
+{
+    int channels = 4;
+    vector<vector<int>> configs = {  // groups, filters, kernel, stride
+            {2, 6, 3, 1},
+            {4, 4, 3, 1},   // depthwise 3x3
+            {4, 8, 5, 2},   // depthwise 5x5 with multiplier
+            {4, 4, 2, 1},   // depthwise, generic kernel
+    };
+
+    for(auto &cfg : configs){
+        SCOPED_TRACE("groups " + to_string(cfg[0]) + " kernel " + to_string(cfg[2]));
+        int groups = cfg[0], filters = cfg[1];
+        vector<int> ks = {cfg[2], cfg[2]};
+        vector<int> st = {cfg[3], cfg[3]};
+        int kz = channels / groups, nkg = filters / groups, ksize = ks[0] * ks[1];
+
+        Tensor* I = Tensor::randn({2, channels, 9, 7});
+        Tensor* Kg = Tensor::randn({filters, kz, ks[0], ks[1]});
+
+        // Same convolution as a dense one with zeros outside of the groups
+        Tensor* Kd = Tensor::zeros({filters, channels, ks[0], ks[1]});
+        for(int n = 0; n < filters; n++)
+            for(int z = 0; z < kz; z++)
+                for(int k = 0; k < ksize; k++)
+                    Kd->ptr[(n * channels + (n / nkg) * kz + z) * ksize + k] = Kg->ptr[(n * kz + z) * ksize + k];
+
+        ConvolDescriptor *dense = conv_forward(I, Kd, filters, ks, st, 1);
+        ConvolDescriptor *grouped = conv_forward(I, Kg, filters, ks, st, groups);
+
+        Tensor* D = Tensor::randn(dense->O->shape);
+        conv_backward(dense, D);
+        conv_backward(grouped, D);
+
+        ASSERT_TRUE(Tensor::allclose(dense->O, grouped->O, 1e-4f, 1e-4f));
+        ASSERT_TRUE(Tensor::allclose(dense->ID, grouped->ID, 1e-4f, 1e-4f));
+        for(int n = 0; n < filters; n++)
+            for(int z = 0; z < kz; z++)
+                for(int k = 0; k < ksize; k++)
+                    ASSERT_NEAR(dense->gK->ptr[(n * channels + (n / nkg) * kz + z) * ksize + k], grouped->gK->ptr[(n * kz + z) * ksize + k], 1e-3f);
+
+        delete I; delete Kg; delete Kd; delete D;
+    }
+}
+
+TEST(Convol2DTestSuite, dilated_matches_inflated_kernel)
+{
+    int channels = 3;
+    vector<vector<int>> configs = {  // groups, dilation, stride
+            {1, 2, 1},
+            {1, 3, 2},
+            {3, 2, 1},   // depthwise
+    };
+
+    for(auto &cfg : configs){
+        for(string padding : {"same", "valid"}){
+            SCOPED_TRACE("groups " + to_string(cfg[0]) + " dilation " + to_string(cfg[1]) + " " + padding);
+            int groups = cfg[0], d = cfg[1];
+            int filters = 3, kz = channels / groups, ek = 2 * d + 1;
+            vector<int> st = {cfg[2], cfg[2]};
+
+            Tensor* I = Tensor::randn({2, channels, 11, 10});
+            Tensor* K = Tensor::randn({filters, kz, 3, 3});
+
+            // The dilated 3x3 kernel written as a dense (2d+1)x(2d+1) one
+            Tensor* Ke = Tensor::zeros({filters, kz, ek, ek});
+            for(int n = 0; n < filters * kz; n++)
+                for(int i = 0; i < 3; i++)
+                    for(int j = 0; j < 3; j++)
+                        Ke->ptr[(n * ek + i * d) * ek + j * d] = K->ptr[(n * 3 + i) * 3 + j];
+
+            ConvolDescriptor *inflated = conv_forward(I, Ke, filters, {ek, ek}, st, groups, {1, 1}, padding);
+            ConvolDescriptor *dilated = conv_forward(I, K, filters, {3, 3}, st, groups, {d, d}, padding);
+            ASSERT_EQ(inflated->O->shape, dilated->O->shape);
+
+            Tensor* D = Tensor::randn(inflated->O->shape);
+            conv_backward(inflated, D);
+            conv_backward(dilated, D);
+
+            ASSERT_TRUE(Tensor::allclose(inflated->O, dilated->O, 1e-4f, 1e-4f));
+            ASSERT_TRUE(Tensor::allclose(inflated->ID, dilated->ID, 1e-4f, 1e-4f));
+            for(int n = 0; n < filters * kz; n++)
+                for(int i = 0; i < 3; i++)
+                    for(int j = 0; j < 3; j++)
+                        ASSERT_NEAR(inflated->gK->ptr[(n * ek + i * d) * ek + j * d], dilated->gK->ptr[(n * 3 + i) * 3 + j], 1e-3f);
+
+            delete I; delete K; delete Ke; delete D;
+        }
+    }
+}
+
+TEST(Convol2DTestSuite, conv1D_matches_middle_row_conv2D)
+{
+    int channels = 4, length = 13;
+    vector<vector<int>> configs = {  // groups, kernel, stride, dilation
+            {1, 3, 1, 1},
+            {1, 4, 2, 1},
+            {1, 3, 1, 2},
+            {4, 3, 1, 1},   // depthwise
+    };
+
+    for(auto &cfg : configs){
+        for(string padding : {"same", "valid"}){
+            SCOPED_TRACE("groups " + to_string(cfg[0]) + " kernel " + to_string(cfg[1]) + " " + padding);
+            int groups = cfg[0], filters = 4, kz = channels / groups, k = cfg[1];
+
+            // The sequence is the middle row of a 3-row image, seen by a kernel whose other rows are zero
+            Tensor* I1 = Tensor::randn({2, channels, length});
+            Tensor* I2 = Tensor::randn({2, channels, 3, length});
+            for(int n = 0; n < 2 * channels; n++)
+                std::copy(I1->ptr + n * length, I1->ptr + (n + 1) * length, I2->ptr + (n * 3 + 1) * length);
+            Tensor* K1 = Tensor::randn({filters, kz, 1, k});
+            Tensor* K2 = Tensor::zeros({filters, kz, 3, k});
+            for(int n = 0; n < filters * kz; n++)
+                std::copy(K1->ptr + n * k, K1->ptr + (n + 1) * k, K2->ptr + (n * 3 + 1) * k);
+
+            ConvolDescriptor *seq = conv_forward(I1, K1, filters, {1, k}, {1, cfg[2]}, groups, {1, cfg[3]}, padding);
+            ConvolDescriptor *img = conv_forward(I2, K2, filters, {3, k}, {1, cfg[2]}, groups, {1, cfg[3]}, padding);
+            ASSERT_EQ(seq->O->ndim, 3);
+            int orow = img->r / 2, ocols = seq->c;
+            ASSERT_EQ(ocols, img->c);
+
+            // Only the output row centred on the sequence gets a delta
+            Tensor* D1 = Tensor::randn(seq->O->shape);
+            Tensor* D2 = Tensor::zeros(img->O->shape);
+            for(int n = 0; n < 2 * filters; n++)
+                std::copy(D1->ptr + n * ocols, D1->ptr + (n + 1) * ocols, D2->ptr + (n * img->r + orow) * ocols);
+            conv_backward(seq, D1);
+            conv_backward(img, D2);
+
+            for(int n = 0; n < 2 * filters; n++)
+                for(int x = 0; x < ocols; x++)
+                    ASSERT_NEAR(seq->O->ptr[n * ocols + x], img->O->ptr[(n * img->r + orow) * ocols + x], 1e-4f);
+            for(int n = 0; n < 2 * channels; n++)
+                for(int x = 0; x < length; x++)
+                    ASSERT_NEAR(seq->ID->ptr[n * length + x], img->ID->ptr[(n * 3 + 1) * length + x], 1e-4f);
+            for(int n = 0; n < filters * kz; n++)
+                for(int j = 0; j < k; j++)
+                    ASSERT_NEAR(seq->gK->ptr[n * k + j], img->gK->ptr[(n * 3 + 1) * k + j], 1e-3f);
+
+            delete I1; delete I2; delete K1; delete K2; delete D1; delete D2;
+        }
+    }
+}
+
+TEST(Convol2DTestSuite, transposed_matches_scatter)
+{
+    int in_ch = 3, filters = 2, h = 5, w = 4;
+    vector<vector<int>> configs = {  // kernel, stride, dilation, pad, output padding
+            {3, 2, 1, 1, 1},
+            {4, 2, 1, 1, 0},
+            {3, 1, 2, 0, 0},
+            {2, 3, 1, 0, 2},
+    };
+
+    for(auto &cfg : configs){
+        SCOPED_TRACE("kernel " + to_string(cfg[0]) + " stride " + to_string(cfg[1]) + " dilation " + to_string(cfg[2]));
+        int k = cfg[0], s = cfg[1], d = cfg[2], p = cfg[3];
+        int rows = (h - 1) * s + (k - 1) * d + 1 - 2 * p + cfg[4];
+        int cols = (w - 1) * s + (k - 1) * d + 1 - 2 * p + cfg[4];
+
+        // The transposed convolution is the one from its output (B) back to its input (A)
+        Tensor* A = Tensor::randn({2, in_ch, h, w});
+        Tensor* B = new Tensor({2, filters, rows, cols});
+        auto *cd = new ConvolDescriptor({in_ch, k, k}, {s, s}, {p, p, p, p}, 0, 1, {d, d});
+        cd->use_bias = true;
+        cd->build(B);
+        delete cd->bias; delete cd->gbias;
+        cd->bias = Tensor::randn({filters});
+        cd->gbias = Tensor::zeros({filters});
+        cd->K->rand_normal(0.0f, 1.0f);
+        cd->gK->fill_(0.0f);
+
+        // Scatter reference
+        Tensor* DB = Tensor::randn(B->shape);
+        Tensor* ref_B = Tensor::zeros(B->shape);
+        Tensor* ref_DA = Tensor::zeros(A->shape);
+        Tensor* ref_gK = Tensor::zeros(cd->K->shape);
+        for(int b = 0; b < 2; b++)
+            for(int f = 0; f < filters; f++)
+                for(int y = 0; y < rows; y++)
+                    for(int x = 0; x < cols; x++)
+                        ref_B->ptr[((b * filters + f) * rows + y) * cols + x] = cd->bias->ptr[f];
+        for(int b = 0; b < 2; b++)
+            for(int c = 0; c < in_ch; c++)
+                for(int i = 0; i < h; i++)
+                    for(int j = 0; j < w; j++)
+                        for(int f = 0; f < filters; f++)
+                            for(int ki = 0; ki < k; ki++)
+                                for(int kj = 0; kj < k; kj++) {
+                                    int y = i * s - p + ki * d, x = j * s - p + kj * d;
+                                    if ((y < 0) || (y >= rows) || (x < 0) || (x >= cols)) continue;
+                                    int a = ((b * in_ch + c) * h + i) * w + j;
+                                    int o = ((b * filters + f) * rows + y) * cols + x;
+                                    int kk = ((c * filters + f) * k + ki) * k + kj;
+                                    ref_B->ptr[o] += A->ptr[a] * cd->K->ptr[kk];
+                                    ref_DA->ptr[a] += DB->ptr[o] * cd->K->ptr[kk];
+                                    ref_gK->ptr[kk] += A->ptr[a] * DB->ptr[o];
+                                }
+
+        Tensor* DA = Tensor::zeros(A->shape);
+        ConvT2D(cd, A, B);
+        ConvT2D_back(cd, DB, DA);
+        ConvT2D_grad(cd, A, DB);
+
+        ASSERT_TRUE(Tensor::allclose(ref_B, B, 1e-4f, 1e-4f));
+        ASSERT_TRUE(Tensor::allclose(ref_DA, DA, 1e-4f, 1e-4f));
+        ASSERT_TRUE(Tensor::allclose(ref_gK, cd->gK, 1e-3f, 1e-3f));
+        for(int f = 0; f < filters; f++) {
+            float sum = 0.0f;
+            for(int b = 0; b < 2; b++)
+                for(int i = 0; i < rows * cols; i++) sum += DB->ptr[(b * filters + f) * rows * cols + i];
+            ASSERT_NEAR(sum, cd->gbias->ptr[f], 1e-3f);
+        }
+
+        delete A; delete B; delete DB; delete DA; delete ref_B; delete ref_DA; delete ref_gK;
+    }
+}
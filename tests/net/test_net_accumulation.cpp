@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+static model dense_net(float l2=0.0f){
+    layer in = Input({4});
+    layer l = Dense(in, 8);
+    if (l2 > 0.0f) l = L2(l, l2);
+    l = ReLu(l);
+    layer out = Dense(l, 2);
+    if (l2 > 0.0f) out = L2(out, l2);
+
+    model net = Model({in}, {out});
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(1));
+    return net;
+}
+
+
+static void check_accumulation(float l2)
+{
+    model net_full = dense_net(l2);
+    model net_acc = dense_net(l2);
+
+    // Same starting point
+    for(int i=0; i<net_full->layers.size(); i++){
+        net_full->layers[i]->copy(net_acc->layers[i]);
+    }
+
+    Tensor* x = Tensor::randn({8, 4});
+    Tensor* y = Tensor::randn({8, 2});
+    vector<int> indices = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    net_full->train_batch({x}, {y}, indices);
+    net_acc->train_batch({x}, {y}, indices, 0, 4);
+
+    for(int i=0; i<net_full->layers.size(); i++){
+        for(int j=0; j<net_full->layers[i]->params.size(); j++){
+            ASSERT_TRUE(Tensor::allclose(net_full->layers[i]->params[j], net_acc->layers[i]->params[j], 1e-4f, 1e-5f));
+        }
+    }
+
+    delete x;
+    delete y;
+    delete net_full;
+    delete net_acc;
+}
+
+TEST(NetTestSuite, accumulation_matches_full_batch)
+{
+    check_accumulation(0.0f);
+}
+
+// The weight decay is applied once per logical batch, not per micro-batch
+TEST(NetTestSuite, accumulation_regularizer_matches_full_batch)
+{
+    check_accumulation(0.05f);
+}
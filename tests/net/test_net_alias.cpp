@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/layers/core/layer_core.h"
+
+
+using namespace eddl;
+
+
+// In TSMODE random DA and Dropout alias their parent and the Dropout scaling
+// goes to the next Dense, with the same outputs as the copying layers
+TEST(NetTestSuite, eval_aliasing_matches_copies)
+{
+    layer in = Input({1, 8, 8});
+    layer da = RandomFlip(in, 1);
+    layer l = Reshape(da, {-1});
+    l = ReLu(Dense(l, 16));
+    layer drop = Dropout(l, 0.25f);
+    layer dense = Dense(drop, 3);
+    layer out = Softmax(dense);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({6, 1, 8, 8});
+    Tensor *y = predict(net, {x})[0];
+
+    ASSERT_TRUE(net->isaliased);
+    ASSERT_EQ(da->output->ptr, in->output->ptr);
+    ASSERT_EQ(drop->output->ptr, l->output->ptr);
+    ASSERT_FLOAT_EQ(((LDense *)dense)->alpha, 0.75f);
+
+    // The layers of a session do not alias, they copy and scale
+    InferenceSession *s = inference_session(net, 6);
+    Tensor *ref = s->predict({x})[0];
+    ASSERT_TRUE(Tensor::allclose(ref, y, 1e-5f, 1e-6f));
+
+    // Resizing keeps the aliases
+    Tensor *y2 = predict(net, {x}, 4)[0];
+    ASSERT_TRUE(Tensor::allclose(ref, y2, 1e-5f, 1e-6f));
+    ASSERT_EQ(drop->output->ptr, l->output->ptr);
+
+    net->setmode(TRMODE);
+    ASSERT_FALSE(net->isaliased);
+    ASSERT_NE(drop->output->ptr, l->output->ptr);
+    ASSERT_FLOAT_EQ(((LDense *)dense)->alpha, 1.0f);
+
+    delete s;
+    delete x;
+    delete y;
+    delete y2;
+    delete ref;
+    delete net;
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+// Single-sample requests from several threads are batched and each one gets
+// its own row of the output
+TEST(NetTestSuite, batch_queue_coalesces_requests)
+{
+    layer in = Input({6});
+    layer out = Softmax(Dense(ReLu(Dense(in, 8)), 3));
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    int n = 32;
+    Tensor *x = Tensor::randn({n, 6});
+    Tensor *ref = predict(net, {x})[0];
+
+    vector<Tensor *> xs;
+    for (int i = 0; i < n; i++) {
+        xs.push_back(new Tensor({6}));
+        std::copy(x->ptr + i * 6, x->ptr + (i + 1) * 6, xs[i]->ptr);
+    }
+
+    auto check = [&](int i, vtensor y) {
+        ASSERT_EQ(y[0]->shape[0], 1);
+        for (int k = 0; k < 3; k++) ASSERT_NEAR(y[0]->ptr[k], ref->ptr[i * 3 + k], 1e-5f);
+        delete y[0];
+    };
+
+    // A long wait: the first 8 requests go in a single batch
+    BatchQueue *q = batch_queue(net, 8, 1000000);
+    vector<future<vtensor>> f;
+    for (int i = 0; i < 8; i++) f.push_back(q->submit({xs[i]}));
+    for (int i = 0; i < 8; i++) check(i, f[i].get());
+    ASSERT_EQ(q->stats().batch_size[8], 1);
+    delete q;
+
+    // Concurrent clients
+    q = batch_queue(net, 8, 200);
+    int nthreads = 4;
+    vector<thread> th;
+    for (int t = 0; t < nthreads; t++)
+        th.push_back(thread([&, t]() {
+            for (int i = t; i < n; i += nthreads) check(i, q->submit({xs[i]}).get());
+        }));
+    for (auto &t : th) t.join();
+
+    BatchQueueStats st = q->stats();
+    long served = 0, lat = 0;
+    for (int b = 1; b <= 8; b++) served += b * st.batch_size[b];
+    for (int k = 0; k < st.latency.size(); k++) lat += st.latency[k];
+    ASSERT_EQ(st.requests, n);
+    ASSERT_EQ(served, n);
+    ASSERT_EQ(lat, n);
+    ASSERT_EQ(st.queue_depth, 0);
+    delete q;
+
+    for (int i = 0; i < n; i++) delete xs[i];
+    delete x;
+    delete ref;
+    delete net;
+}
+
+TEST(NetTestSuite, batch_queue_rejects_bad_max_batch)
+{
+    layer in = Input({6});
+    model net = Model({in}, {Dense(in, 3)});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    ASSERT_THROW(batch_queue(net, 0, 100), std::runtime_error);
+    ASSERT_THROW(batch_queue(net, -5, 100), std::runtime_error);
+
+    delete net;
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/net/cluster.h"
+
+
+using namespace eddl;
+
+
+// Ranks on threads of this process, linked by Unix domain sockets
+static string socket_prefix(const string &name) {
+    return "/tmp/eddl_test_" + name + "_" + to_string(getpid());
+}
+
+TEST(NetTestSuite, cluster_all_reduce_and_broadcast)
+{
+    const int n = 3;
+    string address = socket_prefix("ring");
+    vector<vector<Tensor *>> T(n);
+    vector<Tensor *> avg = {Tensor::zeros({5, 7}), Tensor::zeros({1})};
+    for (int r = 0; r < n; r++)
+        for (int t = 0; t < avg.size(); t++) {
+            T[r].push_back(Tensor::randn(avg[t]->shape));
+            Tensor::inc(T[r][t], avg[t]);
+        }
+    for (int t = 0; t < avg.size(); t++) avg[t]->div_(n);
+
+    vector<Tensor *> root;
+    for (int t = 0; t < avg.size(); t++) root.push_back(Tensor::randn(avg[t]->shape));
+    vector<vector<Tensor *>> B(n);
+    for (int r = 0; r < n; r++)
+        for (int t = 0; t < avg.size(); t++) B[r].push_back(r == 1 ? root[t]->clone() : Tensor::zeros(avg[t]->shape));
+
+    vector<thread> th;
+    for (int r = 0; r < n; r++)
+        th.push_back(thread([&, r]() {
+            Cluster c(r, n, "unix", address);
+            c.all_reduce(T[r], true);
+            c.broadcast(B[r], 1);
+        }));
+    for (int r = 0; r < n; r++) th[r].join();
+
+    for (int r = 0; r < n; r++)
+        for (int t = 0; t < avg.size(); t++) {
+            ASSERT_TRUE(Tensor::allclose(T[r][t], avg[t], 1e-5f, 1e-6f));
+            ASSERT_TRUE(Tensor::allclose(B[r][t], root[t], 0.0f, 0.0f));
+            delete T[r][t];
+            delete B[r][t];
+        }
+    for (int t = 0; t < avg.size(); t++) {
+        delete avg[t];
+        delete root[t];
+    }
+}
+
+static model cluster_net() {
+    layer in = Input({8});
+    layer l = ReLu(Dense(in, 16));
+    layer out = Softmax(Dense(l, 4));
+    return Model({in}, {out});
+}
+
+static model cluster_embedding_net() {
+    layer in = Input({3});
+    layer l = Reshape(Embedding(in, 20, 3, 4), {-1});
+    layer out = Softmax(Dense(l, 4));
+    return Model({in}, {out});
+}
+
+// Two processes with half of the batch each train as one with all of it
+static void check_cluster_training(model (*make)(), const string &name, Tensor *x, Tensor *y)
+{
+    const int n = 2;
+    string address = socket_prefix(name);
+    vector<string> cfg;
+    for (int r = 0; r < n; r++) {
+        cfg.push_back(address + "_" + to_string(r) + ".cfg");
+        ofstream f(cfg[r]);
+        f << "# test job\n" << "workers " << n << "\nrank " << r << "\ntransport unix\n"
+          << "address " << address << "\nthreads 1\nlsb 0\n";
+    }
+
+    vector<model> nets;
+    for (int r = 0; r < n; r++) nets.push_back(make());
+    vector<thread> th;
+    for (int r = 0; r < n; r++)
+        th.push_back(thread([&, r]() {
+            build(nets[r], sgd(0.1f, 0.9f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_COMPSS(cfg[r]));
+        }));
+    for (int r = 0; r < n; r++) th[r].join();
+
+    // Both start from the weights of rank 0, and so does the reference
+    model ref = make();
+    build(ref, sgd(0.1f, 0.9f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+    for (int i = 0; i < ref->layers.size(); i++)
+        for (int j = 0; j < ref->layers[i]->params.size(); j++) {
+            ASSERT_TRUE(Tensor::allclose(nets[0]->layers[i]->params[j], nets[1]->layers[i]->params[j], 0.0f, 0.0f));
+            Tensor::copy(nets[0]->layers[i]->params[j], ref->layers[i]->params[j]);
+        }
+
+    th.clear();
+    for (int r = 0; r < n; r++)
+        th.push_back(thread([&, r]() {
+            for (int it = 0; it < 3; it++) train_batch(nets[r], {x}, {y});
+        }));
+    for (int r = 0; r < n; r++) th[r].join();
+    for (int it = 0; it < 3; it++) train_batch(ref, {x}, {y});
+
+    for (int r = 0; r < n; r++)
+        for (int i = 0; i < ref->layers.size(); i++)
+            for (int j = 0; j < ref->layers[i]->params.size(); j++)
+                ASSERT_TRUE(Tensor::allclose(nets[r]->layers[i]->params[j], ref->layers[i]->params[j], 1e-4f, 1e-5f));
+
+    delete ref;
+    for (int r = 0; r < n; r++) {
+        delete nets[r];
+        unlink(cfg[r].c_str());
+    }
+}
+
+TEST(NetTestSuite, cluster_training_matches_single_process)
+{
+    Tensor *x = Tensor::randn({6, 8});
+    Tensor *y = Tensor::zeros({6, 4});
+    for (int i = 0; i < 6; i++) y->ptr[i * 4 + i % 4] = 1.0f;
+
+    check_cluster_training(cluster_net, "train", x, y);
+
+    delete x;
+    delete y;
+}
+
+// Each rank sees different words, all of them are updated in both ranks
+TEST(NetTestSuite, cluster_training_embedding_rows)
+{
+    Tensor *x = new Tensor({6, 3});
+    for (int i = 0; i < 18; i++) x->ptr[i] = (float)(i < 9 ? 1 + i % 5 : 10 + i % 7);
+    Tensor *y = Tensor::zeros({6, 4});
+    for (int i = 0; i < 6; i++) y->ptr[i * 4 + i % 4] = 1.0f;
+
+    check_cluster_training(cluster_embedding_net, "embedding", x, y);
+
+    delete x;
+    delete y;
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/net/collectives.h"
+
+
+// Every replica ends with the average, for sizes that do not split evenly
+static void check_all_reduce(int n, int algo) {
+    vector<vector<int>> shapes = {{3, 5}, {7}, {2, 2, 3}, {1}};
+    vector<vector<Tensor *>> R(n);
+    vector<Tensor *> avg;
+
+    for (int t = 0; t < shapes.size(); t++) avg.push_back(Tensor::zeros(shapes[t]));
+    for (int i = 0; i < n; i++)
+        for (int t = 0; t < shapes.size(); t++) {
+            Tensor *T = Tensor::randn(shapes[t]);
+            R[i].push_back(T);
+            Tensor::inc(T, avg[t]);
+        }
+    for (int t = 0; t < avg.size(); t++) avg[t]->div_(n);
+
+    Collective C(R, algo);
+    C.all_reduce(true);
+
+    for (int i = 0; i < n; i++)
+        for (int t = 0; t < shapes.size(); t++) {
+            ASSERT_TRUE(Tensor::allclose(R[i][t], avg[t], 1e-5f, 1e-6f));
+            delete R[i][t];
+        }
+    for (int t = 0; t < avg.size(); t++) delete avg[t];
+}
+
+TEST(NetTestSuite, collective_all_reduce)
+{
+    for (int n = 1; n <= 5; n++) {
+        check_all_reduce(n, AR_RING);
+        check_all_reduce(n, AR_HALVING);
+    }
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/layers/core/layer_core.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+// Only the rows of the words in the batch get gradients and updates
+TEST(NetTestSuite, embedding_sparse_rows)
+{
+    layer in = Input({3});
+    layer l = Embedding(in, 50, 3, 4);
+    layer out = Dense(l, 2);
+    model net = Model({in}, {out});
+    build(net, adam(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    LEmbedding *emb = (LEmbedding *)net->layers[1];
+    Tensor *E0 = emb->E->clone();
+
+    Tensor *x = new Tensor({2, 3});
+    float ids[] = {5, 5, 7, 9, 5, 0};
+    for (int i = 0; i < 6; i++) x->ptr[i] = ids[i];
+    Tensor *y = Tensor::randn({2, 2});
+    vector<int> indices = {0, 1};
+
+    net->train_batch({x}, {y}, indices);
+
+    vector<int> rows = *emb->sparse_rows(0);
+    sort(rows.begin(), rows.end());
+    ASSERT_EQ(rows, vector<int>({0, 5, 7, 9}));
+
+    for (int r = 0; r < 50; r++) {
+        bool used = find(rows.begin(), rows.end(), r) != rows.end();
+        float diff = 0.0f;
+        for (int j = 0; j < 4; j++) diff += fabs(emb->E->ptr[r * 4 + j] - E0->ptr[r * 4 + j]);
+        if (used) ASSERT_GT(diff, 0.0f);
+        else ASSERT_EQ(diff, 0.0f);
+    }
+
+    net->reset_grads();
+    ASSERT_TRUE(emb->sparse_rows(0)->empty());
+    ASSERT_EQ(emb->gE->sum_abs(), 0.0f);
+
+    delete E0;
+    delete x;
+    delete y;
+    delete net;
+}
+
+
+// In an unrolled net every time step is a shared copy of the embedding, the
+// rows they touch are the ones the optimizer updates
+TEST(NetTestSuite, embedding_sparse_rows_recurrent)
+{
+    layer in = Input({1});
+    layer l = Embedding(in, 20, 1, 4);
+    l = LSTM(l, 8);
+    layer out = Dense(l, 2);
+    model net = Model({in}, {out});
+    build(net, sgd(0.5f), {"mse"}, {"mse"}, CS_CPU(2));
+
+    LEmbedding *emb = (LEmbedding *)net->layers[1];
+    Tensor *E0 = emb->E->clone();
+
+    Tensor *x = new Tensor({8, 5, 1});
+    for (int i = 0; i < x->size; i++) x->ptr[i] = (float)(1 + (i * 3) % 10);
+    Tensor *y = Tensor::randn({8, 2});
+
+    fit(net, {x}, {y}, 4, 3);
+
+    for (int r = 0; r < 20; r++) {
+        float diff = 0.0f;
+        for (int j = 0; j < 4; j++) diff += fabs(emb->E->ptr[r * 4 + j] - E0->ptr[r * 4 + j]);
+        if ((r >= 1) && (r <= 10)) ASSERT_GT(diff, 0.0f);
+        else ASSERT_EQ(diff, 0.0f);
+    }
+
+    delete E0;
+    delete x;
+    delete y;
+    delete net;
+}
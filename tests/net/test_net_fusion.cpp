@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/layers/core/layer_core.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+TEST(NetTestSuite, fused_dense_activation_matches_reference)
+{
+    layer in = Input({8});
+    layer d = Dense(in, 5);
+    layer out = ReLu(d);
+
+    model net = Model({in}, {out});
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(1));
+    ASSERT_TRUE(((LActivation *)out)->fused);
+
+    Tensor* x = Tensor::randn({4, 8});
+    Tensor* y = predict(net, {x})[0];
+
+    LDense *ld = (LDense *)d;
+    Tensor* ref = new Tensor({4, 5});
+    Tensor::mult2D(x, 0, ld->W, 0, ref, 0);
+    Tensor::sum2D_rowwise(ref, ld->bias, ref);
+    ref->clamp_(0.0f, 1e30f);
+
+    ASSERT_TRUE(Tensor::allclose(y, ref, 1e-5f, 1e-5f));
+
+    delete x;
+    delete y;
+    delete ref;
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+static model small_net() {
+    layer in = Input({1, 6, 6});
+    layer l = ReLu(Conv(in, 2, {3, 3}));
+    l = Reshape(l, {-1});
+    layer out = Softmax(Dense(l, 3));
+    return Model({in}, {out});
+}
+
+static model embedding_net() {
+    layer in = Input({3});
+    layer l = Embedding(in, 20, 3, 4);
+    layer out = Dense(Reshape(l, {-1}), 2);
+    return Model({in}, {out});
+}
+
+static model attention_net() {
+    layer in = Input({5, 8});
+    layer l = Reshape(MultiHeadAttention(in, 2, 4), {-1});
+    layer out = Dense(LayerNormalization(l), 3);
+    return Model({in}, {out});
+}
+
+// Same outputs as a regular build, without gradients and refusing training
+static void check_inference(model (*make)(), Tensor *x) {
+    model net = make();
+    build(net, adam(0.001f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    model inet = make();
+    build_inference(inet, CS_CPU(1), false);
+    ASSERT_TRUE(inet->isinference);
+    ASSERT_EQ(inet->optimizer, nullptr);
+
+    for (int i = 0; i < net->layers.size(); i++) {
+        for (int j = 0; j < net->layers[i]->params.size(); j++)
+            Tensor::copy(net->layers[i]->params[j], inet->layers[i]->params[j]);
+        for (int j = 0; j < inet->layers[i]->gradients.size(); j++)
+            ASSERT_EQ(inet->layers[i]->gradients[j], nullptr);
+    }
+
+    Tensor *ref = predict(net, {x})[0];
+    Tensor *p = predict(inet, {x})[0];
+    ASSERT_TRUE(Tensor::allclose(ref, p, 1e-5f, 1e-6f));
+
+    Tensor *y = Tensor::zeros(ref->shape);
+    ASSERT_THROW(fit(inet, {x}, {y}, 5, 1), std::runtime_error);
+    ASSERT_THROW(setlr(inet, {0.01f}), std::runtime_error);
+
+    delete y;
+    delete ref;
+    delete p;
+    delete net;
+    delete inet;
+}
+
+TEST(NetTestSuite, inference_only_build)
+{
+    Tensor *x = Tensor::randn({5, 1, 6, 6});
+    check_inference(small_net, x);
+    delete x;
+}
+
+// The layers that alias their gradients (gE, gWq...) work without them
+TEST(NetTestSuite, inference_only_build_embedding_attention)
+{
+    Tensor *ids = new Tensor({5, 3});
+    for (int i = 0; i < ids->size; i++) ids->ptr[i] = (float)((i * 7) % 20);
+    check_inference(embedding_net, ids);
+
+    Tensor *x = Tensor::randn({5, 5, 8});
+    check_inference(attention_net, x);
+
+    delete ids;
+    delete x;
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+static model scaled_net(){
+    layer in = Input({4});
+    layer l = ReLu(Dense(in, 8));
+    layer out = Dense(l, 2);
+
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+    return net;
+}
+
+static bool same_params(model a, model b){
+    for(int i=0; i<a->layers.size(); i++)
+        for(int j=0; j<a->layers[i]->params.size(); j++)
+            if (!Tensor::allclose(a->layers[i]->params[j], b->layers[i]->params[j], 1e-5f, 1e-6f)) return false;
+    return true;
+}
+
+// An overflowed step is skipped and halves the scale, good steps grow it
+TEST(NetTestSuite, loss_scale_skips_overflow)
+{
+    model net = scaled_net();
+    model ref = scaled_net();
+    for(int i=0; i<net->layers.size(); i++) net->layers[i]->copy(ref->layers[i]);
+
+    Tensor* x = Tensor::randn({8, 4});
+    Tensor* y = Tensor::full({8, 2}, 100.0f);
+    vector<int> indices = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    set_loss_scale(net, 3e38f, true, 2);
+    net->train_batch({x}, {y}, indices);
+    ASSERT_TRUE(same_params(net, ref));
+    ASSERT_FLOAT_EQ(net->optimizer->get_loss_scale(), 1.5e38f);
+
+    // A power of two scales and unscales exactly
+    set_loss_scale(net, 4.0f, true, 2);
+    for(int it=0; it<2; it++) {
+        net->train_batch({x}, {y}, indices);
+        ref->train_batch({x}, {y}, indices);
+    }
+    ASSERT_TRUE(same_params(net, ref));
+    ASSERT_FLOAT_EQ(net->optimizer->get_loss_scale(), 8.0f);
+
+    delete x;
+    delete y;
+    delete net;
+    delete ref;
+}
+
+// bfloat16 rounds the activations after every layer, float32 goes back to
+// the float32 ones
+TEST(NetTestSuite, mixed_precision_rounds_activations)
+{
+    model net = scaled_net();
+    Tensor* x = Tensor::randn({8, 4});
+
+    set_mixed_precision(net, "bfloat16");
+    forward(net, {x});
+    Tensor* out = net->lout[0]->output->clone();
+    Tensor* rounded = out->clone();
+    rounded->round_bfloat16_();
+    ASSERT_TRUE(Tensor::allclose(out, rounded, 0.0f, 0.0f));
+
+    set_mixed_precision(net, "float32");
+    forward(net, {x});
+    Tensor* full = net->lout[0]->output->clone();
+    Tensor::copy(full, rounded);
+    rounded->round_bfloat16_();
+    ASSERT_FALSE(Tensor::allclose(full, rounded, 0.0f, 0.0f));
+
+    delete x;
+    delete out;
+    delete rounded;
+    delete full;
+    delete net;
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+// Branches, so the backward also runs on the task graph with several threads
+static model overlap_net() {
+    layer in = Input({2, 8, 8});
+    layer a = ReLu(Conv(in, 4, {3, 3}));
+    layer b = ReLu(Conv(in, 4, {1, 1}));
+    layer c = Reshape(Add({a, b}), {-1});
+    layer d = Concat({Dense(c, 16), Dense(Reshape(in, {-1}), 16)});
+    layer out = Softmax(Dense(ReLu(d), 5));
+    return Model({in}, {out});
+}
+
+static void check_overlap(optimizer (*opt)(), int threads) {
+    model ref = overlap_net();
+    build(ref, opt(), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(threads));
+    model ovl = overlap_net();
+    build(ovl, opt(), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(threads));
+    set_overlap_update(ovl);
+
+    for (int i = 0; i < ref->layers.size(); i++)
+        for (int j = 0; j < ref->layers[i]->params.size(); j++)
+            Tensor::copy(ref->layers[i]->params[j], ovl->layers[i]->params[j]);
+
+    Tensor *x = Tensor::randn({6, 2, 8, 8});
+    Tensor *y = Tensor::zeros({6, 5});
+    for (int i = 0; i < 6; i++) y->ptr[i * 5 + i % 5] = 1.0f;
+
+    for (int it = 0; it < 3; it++) {
+        train_batch(ref, {x}, {y});
+        train_batch(ovl, {x}, {y});
+    }
+
+    for (int i = 0; i < ref->layers.size(); i++)
+        for (int j = 0; j < ref->layers[i]->params.size(); j++)
+            ASSERT_TRUE(Tensor::allclose(ref->layers[i]->params[j], ovl->layers[i]->params[j], 1e-4f, 1e-5f));
+
+    delete x;
+    delete y;
+    delete ref;
+    delete ovl;
+}
+
+static optimizer sgd_momentum() { return sgd(0.05f, 0.9f); }
+static optimizer adam_default() { return adam(0.01f); }
+
+// Same weights as the update after the whole backward
+TEST(NetTestSuite, overlap_update_matches_regular_step)
+{
+    check_overlap(sgd_momentum, 1);
+    check_overlap(adam_default, 1);
+    check_overlap(sgd_momentum, 4);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/net/pipeline.h"
+
+
+using namespace eddl;
+
+
+static model deep_net() {
+    layer in = Input({1, 8, 8});
+    layer l = ReLu(Conv(in, 4, {3, 3}));
+    layer skip = Reshape(l, {-1});
+    l = ReLu(Conv(l, 4, {3, 3}));
+    l = Reshape(MaxPool(l, {2, 2}), {-1});
+    l = Concat({ReLu(Dense(l, 16)), Dense(skip, 16)});
+    l = ReLu(Dense(l, 16));
+    layer out = Softmax(Dense(l, 4));
+    return Model({in}, {out});
+}
+
+// Same step as accumulating the gradients of the micro-batches in order
+TEST(NetTestSuite, pipeline_matches_accumulation)
+{
+    model ref = deep_net();
+    build(ref, sgd(0.1f, 0.9f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+    model net = deep_net();
+    build(net, sgd(0.1f, 0.9f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(3));
+
+    for (int i = 0; i < ref->layers.size(); i++)
+        for (int j = 0; j < ref->layers[i]->params.size(); j++)
+            Tensor::copy(ref->layers[i]->params[j], net->layers[i]->params[j]);
+
+    set_pipeline(net, 3, 4);
+    ASSERT_EQ(net->pipeline->first.size(), 4);
+    ASSERT_EQ(net->pipeline->lanes.size(), 3);
+
+    Tensor *x = Tensor::randn({8, 1, 8, 8});
+    Tensor *y = Tensor::zeros({8, 4});
+    for (int i = 0; i < 8; i++) y->ptr[i * 4 + i % 4] = 1.0f;
+    vector<int> ind = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    for (int it = 0; it < 3; it++) {
+        train_batch(ref, {x}, {y}, ind, 4);
+        train_batch(net, {x}, {y}, ind);
+    }
+    ASSERT_NEAR(ref->fiterr[0], net->fiterr[0], 1e-3f);
+
+    for (int i = 0; i < ref->layers.size(); i++)
+        for (int j = 0; j < ref->layers[i]->params.size(); j++)
+            ASSERT_TRUE(Tensor::allclose(ref->layers[i]->params[j], net->layers[i]->params[j], 1e-4f, 1e-5f));
+
+    // The batch must split in micro-batches
+    vector<int> odd = {0, 1, 2, 3, 4, 5};
+    ASSERT_THROW(train_batch(net, {x}, {y}, odd), std::runtime_error);
+
+    set_pipeline(net, 0, 0);
+    ASSERT_EQ(net->pipeline, nullptr);
+
+    delete x;
+    delete y;
+    delete ref;
+    delete net;
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/hardware/cpu/nn/cpu_nn.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+TEST(NetTestSuite, quantization_int8_close_to_float)
+{
+    layer in = Input({1, 8, 8});
+    layer l = ReLu(Conv(in, 4, {3, 3}));
+    l = Reshape(l, {-1});
+    layer out = Dense(l, 3);
+
+    model net = Model({in}, {out});
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor* x = Tensor::randu({16, 1, 8, 8});
+
+    Tensor* y_float = predict(net, {x})[0];
+    quantize(net, {x});
+    Tensor* y_int8 = predict(net, {x})[0];
+
+    // Quantization error must be small compared to the output range
+    float range = y_float->max() - y_float->min();
+    Tensor* diff = Tensor::sub(y_float, y_int8);
+    diff->abs_();
+    ASSERT_GT(diff->max(), 0.0f);  // int8 path was taken
+    ASSERT_LT(diff->max(), 0.05f * range);
+
+    delete x;
+    delete y_float;
+    delete y_int8;
+    delete diff;
+}
+
+
+// Grouped convolution, K not a multiple of 4 and N not a multiple of 16
+static model quant_net() {
+    layer in = Input({4, 9, 9});
+    layer l = ReLu(Conv(in, 6, {3, 3}, {1, 1}, "same", true, 2));
+    l = ReLu(Conv(l, 20, {1, 1}));
+    l = Reshape(l, {-1});
+    layer out = Dense(l, 35);
+    return Model({in}, {out});
+}
+
+TEST(NetTestSuite, quantization_int8_grouped_conv)
+{
+    model net = quant_net();
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(2));
+
+    Tensor* x = Tensor::randu({8, 4, 9, 9});
+    Tensor* y_float = predict(net, {x})[0];
+    quantize(net, {x});
+    ASSERT_TRUE(((LConv *) net->layers[1])->qd->quantized);
+    Tensor* y_int8 = predict(net, {x})[0];
+
+    float range = y_float->max() - y_float->min();
+    Tensor* diff = Tensor::sub(y_float, y_int8);
+    diff->abs_();
+    ASSERT_LT(diff->max(), 0.05f * range);
+
+    delete x;
+    delete y_float;
+    delete y_int8;
+    delete diff;
+    delete net;
+}
+
+// The SIMD kernels compute the same int32 sums as the scalar one
+TEST(NetTestSuite, quantization_int8_kernels_match)
+{
+    model net = quant_net();
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(2));
+
+    Tensor* x = Tensor::randu({5, 4, 9, 9});
+    quantize(net, {x});
+
+    int best = cpu_int8_isa();
+    cpu_set_int8_isa(INT8_SCALAR);
+    Tensor* y_ref = predict(net, {x})[0];
+    for (int isa = INT8_AVX2; isa <= best; isa++) {
+        cpu_set_int8_isa(isa);
+        Tensor* y = predict(net, {x})[0];
+        ASSERT_TRUE(Tensor::allclose(y, y_ref, 0.0f, 0.0f));
+        delete y;
+    }
+    cpu_set_int8_isa(-1);
+
+    delete x;
+    delete y_ref;
+    delete net;
+}
+
+// Inference-only nets keep the int8 weights only, with the same outputs
+TEST(NetTestSuite, quantization_releases_float_weights)
+{
+    model net = quant_net();
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(1));
+    model inet = quant_net();
+    build_inference(inet, CS_CPU(1), false);
+    for (int i = 0; i < net->layers.size(); i++)
+        for (int j = 0; j < net->layers[i]->params.size(); j++)
+            Tensor::copy(net->layers[i]->params[j], inet->layers[i]->params[j]);
+
+    Tensor* x = Tensor::randu({8, 4, 9, 9});
+    quantize(net, {x});
+    quantize(inet, {x});
+
+    LDense* d = (LDense *) inet->layers[inet->layers.size() - 1];
+    ASSERT_EQ(d->W->ptr, nullptr);
+    LDense* fd = (LDense *) net->layers[net->layers.size() - 1];
+    ASSERT_NE(fd->W->ptr, nullptr);
+
+    // The export reads the int8 weights back from the packed ones
+    QuantDescriptor* q = fd->qd;
+    for (int n = 0; n < q->channels; n++)
+        for (int k = 0; k < q->ksize; k++)
+            ASSERT_EQ(q->weight(n, k), (int)std::round(fd->W->ptr[k * q->channels + n] / q->w_scale[n]));
+
+    Tensor* ref = predict(net, {x})[0];
+    Tensor* y = predict(inet, {x})[0];
+    ASSERT_TRUE(Tensor::allclose(y, ref, 0.0f, 0.0f));
+
+    ASSERT_THROW(save(inet, "quantized.bin"), std::runtime_error);
+    ASSERT_THROW(quantize(inet, {x}), std::runtime_error);
+
+    delete x;
+    delete ref;
+    delete y;
+    delete net;
+    delete inet;
+}
+
+// MatMul has no int8 path, it is kept in float32
+TEST(NetTestSuite, quantization_keeps_matmul_float)
+{
+    layer in = Input({4, 6});
+    layer out = MatMul({in, Reshape(Dense(Reshape(in, {-1}), 12), {6, 2})});
+    model net = Model({in}, {out});
+    build(net, sgd(0.1f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor* x = Tensor::randu({8, 4, 6});
+    quantize(net, {x});
+    for (int i = 0; i < net->layers.size(); i++) {
+        LDense* d = dynamic_cast<LDense *>(net->layers[i]);
+        if (d != nullptr) ASSERT_TRUE(d->qd->quantized);
+    }
+    Tensor* y = predict(net, {x})[0];
+    ASSERT_EQ(y->shape, vector<int>({8, 4, 2}));
+
+    delete x;
+    delete y;
+    delete net;
+}
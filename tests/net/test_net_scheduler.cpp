@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+// Branches, a residual Add and a Reshape that shares its parent's delta with
+// a sibling branch
+static model branchy_net() {
+    layer in = Input({2, 8, 8});
+    layer a = ReLu(Conv(in, 4, {3, 3}));
+    layer b = ReLu(Conv(in, 4, {1, 1}));
+    layer c = Add({a, b});
+    layer f1 = Reshape(c, {-1});
+    layer f2 = Dense(Reshape(in, {-1}), 32);
+    layer f3 = Dense(Reshape(MaxPool(c, {2, 2}), {-1}), 32);
+    layer d = Concat({Dense(f1, 32), f2, f3});
+    layer out = Softmax(Dense(d, 5));
+    return Model({in}, {out});
+}
+
+// Same forward and training step as the sequential order
+TEST(NetTestSuite, layer_scheduler_matches_sequential)
+{
+    model seq = branchy_net();
+    build(seq, sgd(0.1f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+    model par = branchy_net();
+    build(par, sgd(0.1f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(4));
+    ASSERT_NE(par->fsched, nullptr);
+    ASSERT_NE(par->bsched, nullptr);
+    ASSERT_GT(par->fsched->width, 1);
+
+    for (int i = 0; i < seq->layers.size(); i++)
+        for (int j = 0; j < seq->layers[i]->params.size(); j++)
+            Tensor::copy(seq->layers[i]->params[j], par->layers[i]->params[j]);
+
+    Tensor *x = Tensor::randn({6, 2, 8, 8});
+    Tensor *y = Tensor::zeros({6, 5});
+    for (int i = 0; i < 6; i++) y->ptr[i * 5 + i % 5] = 1.0f;
+
+    for (int it = 0; it < 3; it++) {
+        train_batch(seq, {x}, {y});
+        train_batch(par, {x}, {y});
+    }
+
+    for (int i = 0; i < seq->layers.size(); i++)
+        for (int j = 0; j < seq->layers[i]->params.size(); j++)
+            ASSERT_TRUE(Tensor::allclose(seq->layers[i]->params[j], par->layers[i]->params[j], 1e-4f, 1e-5f));
+
+    Tensor *ref = predict(seq, {x})[0];
+    Tensor *p = predict(par, {x})[0];
+    ASSERT_TRUE(Tensor::allclose(ref, p, 1e-4f, 1e-5f));
+
+    delete x;
+    delete y;
+    delete ref;
+    delete p;
+    delete seq;
+    delete par;
+}
+
+
+static model unrolled_bn_net() {
+    layer in = Input({3});
+    layer l = BatchNormalization(Dense(in, 4));
+    l = LSTM(l, 8);
+    layer out = Dense(l, 2);
+    return Model({in}, {out});
+}
+
+// The time steps of an unrolled net are shared copies that update the same
+// running statistics, the forward scheduler keeps them in order
+TEST(NetTestSuite, layer_scheduler_orders_shared_copies)
+{
+    model seq = unrolled_bn_net();
+    build(seq, sgd(0.0f), {"mse"}, {"mse"}, CS_CPU(1));
+    model par = unrolled_bn_net();
+    build(par, sgd(0.0f), {"mse"}, {"mse"}, CS_CPU(8));
+
+    for (int i = 0; i < seq->layers.size(); i++)
+        for (int j = 0; j < seq->layers[i]->params.size(); j++)
+            Tensor::copy(seq->layers[i]->params[j], par->layers[i]->params[j]);
+
+    // fit draws the batches with rand()
+    Tensor *x = Tensor::randn({8, 5, 3});
+    Tensor *y = Tensor::randn({8, 2});
+    srand(1);
+    fit(seq, {x}, {y}, 4, 1);
+    srand(1);
+    fit(par, {x}, {y}, 4, 1);
+
+    for (int i = 0; i < seq->layers.size(); i++)
+        for (int j = 0; j < seq->layers[i]->params.size(); j++)
+            ASSERT_TRUE(Tensor::allclose(seq->layers[i]->params[j], par->layers[i]->params[j], 1e-4f, 1e-5f));
+
+    delete x;
+    delete y;
+    delete seq;
+    delete par;
+}
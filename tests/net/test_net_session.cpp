@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace std;
+using namespace eddl;
+
+
+// Concurrent sessions give the same outputs as Net::predict
+TEST(NetTestSuite, inference_sessions_concurrent)
+{
+    layer in = Input({1, 8, 8});
+    layer l = ReLu(Conv(in, 4, {3, 3}));
+    l = MaxPool(l, {2, 2});
+    l = Reshape(l, {-1});
+    l = LayerNormalization(l, 1e-5f);
+    layer out = Softmax(Dense(l, 3));
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    int nthreads = 4;
+    vector<Tensor *> x, ref;
+    for (int t = 0; t < nthreads; t++) {
+        x.push_back(Tensor::randn({10, 1, 8, 8}));
+        ref.push_back(net->predict({x[t]})[0]);
+    }
+
+    // max_batch smaller than the input, 4+4+2 samples
+    vector<InferenceSession *> s;
+    for (int t = 0; t < nthreads; t++) s.push_back(inference_session(net, 4));
+
+    vector<Tensor *> y(nthreads);
+    vector<thread> th;
+    for (int t = 0; t < nthreads; t++)
+        th.push_back(thread([&, t]() { for (int k = 0; k < 5; k++) { if (k) delete y[t]; y[t] = s[t]->predict({x[t]})[0]; } }));
+    for (auto &t : th) t.join();
+
+    for (int t = 0; t < nthreads; t++) {
+        ASSERT_TRUE(Tensor::allclose(ref[t], y[t], 1e-4f, 1e-5f));
+        delete s[t];
+        delete x[t];
+        delete y[t];
+        delete ref[t];
+    }
+
+    delete net;
+}
+
+// Sessions of a quantized net run in int8 as Net::predict does
+TEST(NetTestSuite, inference_session_quantized)
+{
+    layer in = Input({2, 6, 6});
+    layer l = ReLu(Conv(in, 8, {3, 3}));
+    l = Reshape(l, {-1});
+    layer out = Dense(l, 5);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor* x = Tensor::randu({6, 2, 6, 6});
+    Tensor* y_float = net->predict({x})[0];
+    quantize(net, {x});
+    Tensor* ref = net->predict({x})[0];
+    ASSERT_FALSE(Tensor::allclose(ref, y_float, 1e-6f, 1e-7f));
+
+    InferenceSession *s = inference_session(net, 4);
+    Tensor* y = s->predict({x})[0];
+    ASSERT_TRUE(Tensor::allclose(ref, y, 1e-5f, 1e-6f));
+
+    delete s;
+    delete x;
+    delete y;
+    delete y_float;
+    delete ref;
+    delete net;
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+// Chunked predict/evaluate with a last partial chunk (4+4+2 samples)
+TEST(NetTestSuite, stream_predict_evaluate_partial_batch)
+{
+    layer in = Input({6});
+    layer out = Softmax(Dense(ReLu(Dense(in, 8)), 3));
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({10, 6});
+    Tensor *y = Tensor::zeros({10, 3});
+    for (int i = 0; i < 10; i++) y->ptr[i * 3 + (i % 3)] = 1.0f;
+
+    Tensor *ref = predict(net, {x}, 10)[0];
+    Tensor *p = predict(net, {x}, 4)[0];
+    ASSERT_EQ(net->batch_size, 4);
+    ASSERT_TRUE(Tensor::allclose(ref, p, 1e-5f, 1e-6f));
+
+    // All the samples are evaluated, the padding of the last batch is not
+    evaluate(net, {x}, {y}, 4);
+    ASSERT_EQ(net->inferenced_samples, 10);
+    ASSERT_NEAR(net->total_loss[0], net->losses[0]->value(y, ref), 1e-3);
+    ASSERT_NEAR(net->total_metric[0], net->metrics[0]->value(y, ref), 1e-5);
+
+    delete x;
+    delete y;
+    delete ref;
+    delete p;
+    delete net;
+}
+
+
+// Without a batch, predict keeps the batch size set on the net, even 1,
+// and uses up to STREAM_BATCH right after build
+TEST(NetTestSuite, stream_predict_default_batch)
+{
+    layer in = Input({6});
+    layer out = Dense(in, 3);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({10, 6});
+    Tensor *p = predict(net, {x})[0];
+    ASSERT_EQ(net->batch_size, 10);
+    delete p;
+
+    net->resize(1);
+    p = predict(net, {x})[0];
+    ASSERT_EQ(net->batch_size, 1);
+
+    delete x;
+    delete p;
+    delete net;
+}
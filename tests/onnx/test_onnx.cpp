@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <random>
 #include <string>
+#include <fstream>
 
 #include "eddl/apis/eddl.h"
 #include "eddl/serialization/onnx/eddl_onnx.h"
@@ -123,3 +124,126 @@ TEST(ONNXTestSuite, onnx_import){
 
 }
 
+
+TEST(ONNXTestSuite, onnx_import_external_data){
+    // Generate random name
+    int rdn_name = dist6(mt);
+    string fname = "onnx_net_" + to_string(rdn_name) + ".onnx";
+    string fdata = fname + ".data";
+
+    // Get some network
+    Net* net_export = get_network();
+    build(net_export, sgd(0.01), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(), true);
+    net_export->resize(1);
+
+    // Export network to ONNX, with the weights in a side file
+    save_net_to_onnx_file(net_export, fname, true);
+    std::ifstream data_file(fdata, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(data_file.good());
+    ASSERT_GT((long)data_file.tellg(), 0L);
+    data_file.close();
+
+    // Import net
+    Net* net_import = import_net_from_onnx_file(fname);
+    build(net_import, sgd(0.01), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(), false);
+    net_import->resize(1);
+
+    // Delete files
+    std::remove(fname.c_str());
+    std::remove(fdata.c_str());
+
+    ASSERT_EQ(net_export->layers.size(), net_import->layers.size());
+    for(int i=0; i<net_export->layers.size(); i++){
+        for(int j=0; j<net_export->layers[i]->params.size(); j++){
+            ASSERT_TRUE(Tensor::equal2(net_export->layers[i]->params[j], net_import->layers[i]->params[j]));
+        }
+    }
+}
+
+
+TEST(ONNXTestSuite, onnx_import_conv1D){
+    // Generate random name
+    int rdn_name = dist6(mt);
+    string fname = "onnx_net_" + to_string(rdn_name) + ".onnx";
+
+    // Sequence model: (channels, length) inputs
+    layer in = Input({3, 20});
+    layer l = ReLu(Conv1D(in, 4, {3}, {1}, "same", true, 1, {2}));
+    l = MaxPool1D(l, {3}, {2}, "same");
+    l = Reshape(l, {-1});
+    layer out = Dense(l, 5);
+    Net* net_export = Model({in}, {out});
+    build(net_export, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), true);
+    net_export->resize(2);
+
+    // Export and import
+    save_net_to_onnx_file(net_export, fname);
+    Net* net_import = import_net_from_onnx_file(fname);
+    build(net_import, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), false);
+    net_import->resize(2);
+    std::remove(fname.c_str());
+
+    // Same layers, same params, same outputs
+    ASSERT_EQ(net_export->layers.size(), net_import->layers.size());
+    for(int i=0; i<net_export->layers.size(); i++){
+        ASSERT_EQ(net_export->layers[i]->output->shape, net_import->layers[i]->output->shape);
+        for(int j=0; j<net_export->layers[i]->params.size(); j++){
+            ASSERT_TRUE(Tensor::equal2(net_export->layers[i]->params[j], net_import->layers[i]->params[j]));
+        }
+    }
+
+    Tensor* x = Tensor::randn({2, 3, 20});
+    vtensor y_export = net_export->predict({x});
+    vtensor y_import = net_import->predict({x});
+    ASSERT_TRUE(Tensor::allclose(y_export[0], y_import[0], 1e-5f, 1e-5f));
+    delete x;
+}
+
+
+TEST(ONNXTestSuite, onnx_compressed_weights_delta){
+    int modes[] = {COMPRESS_NONE, COMPRESS_BF16, COMPRESS_INT8, COMPRESS_TOPK};
+
+    for(int mode : modes){
+        SCOPED_TRACE("compression " + to_string(mode));
+        layer in = Input({16});
+        layer out = Dense(ReLu(Dense(in, 32, true, "fc1")), 4, true, "fc2");
+        model net_src = Model({in}, {out});
+        build(net_src, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), true);
+
+        in = Input({16});
+        out = Dense(ReLu(Dense(in, 32, true, "fc1")), 4, true, "fc2");
+        model net_dst = Model({in}, {out});
+        build(net_dst, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), false);
+        for(int i=0; i<net_src->layers.size(); i++){
+            net_src->layers[i]->copy(net_dst->layers[i]);
+        }
+
+        // Layers are matched by name. First exchange takes the snapshot of the shared weights
+        void* buffer = nullptr;
+        size_t size = serialize_weights_delta_to_onnx_pointer(net_src, buffer, mode, 0.25f);
+        apply_grads_from_onnx_pointer(net_dst, buffer, size);
+        delete [] (char*)buffer;
+
+        // Local update, sent as a (compressed) delta
+        for(Layer* l : net_src->layers){
+            for(Tensor* p : l->params){
+                Tensor* noise = Tensor::randn(p->shape);
+                noise->mult_(0.01f);
+                p->add_(noise);
+                delete noise;
+            }
+        }
+        // The residuals left by the compression are sent in the next exchanges
+        for(int k=0; k<4; k++){
+            size = serialize_weights_delta_to_onnx_pointer(net_src, buffer, mode, 0.25f);
+            apply_grads_from_onnx_pointer(net_dst, buffer, size);
+            delete [] (char*)buffer;
+        }
+
+        for(int i=0; i<net_src->layers.size(); i++){
+            for(int j=0; j<net_src->layers[i]->params.size(); j++){
+                ASSERT_TRUE(Tensor::allclose(net_src->layers[i]->params[j], net_dst->layers[i]->params[j], 1e-2f, 1e-3f));
+            }
+        }
+    }
+}
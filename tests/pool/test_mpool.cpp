@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 
 #include "eddl/tensor/tensor.h"
 #include "eddl/tensor/nn/tensor_nn.h"
@@ -270,3 +271,146 @@ TEST(MaxPoolTestSuite, mpool_k3x3_s2x2_pad_same)
     MPool2D_back(pd);
     ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
 }
+
+
+TEST(MaxPoolTestSuite, mpool1D_k3_s2_pad_valid)
+{
+    auto* t_seq = new Tensor({1, 1, 7}, new float[7]{0, 3, 1, 5, 2, 2, 4});
+    auto* t_fwrd = new Tensor({1, 1, 3}, new float[3]{3, 5, 4});
+    auto* t_bwrd = new Tensor({1, 1, 7}, new float[7]{0, 1, 0, 1, 0, 0, 1});
+
+    // Operation
+    auto *pd = new PoolDescriptor({1, 3}, {1, 2}, "valid");
+    pd->build(t_seq);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+    pd->indX = new Tensor(pd->O->getShape());
+    pd->indY = new Tensor(pd->O->getShape());
+
+    // Forward
+    MPool1D(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    MPool1D_back(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
+}
+
+
+TEST(MaxPoolTestSuite, mpool1D_k3_s1_pad_same)
+{
+    // Padding never wins the max, even with negative values
+    auto* t_seq = new Tensor({1, 1, 4}, new float[4]{-1, -3, -2, -5});
+    auto* t_fwrd = new Tensor({1, 1, 4}, new float[4]{-1, -1, -2, -2});
+    auto* t_bwrd = new Tensor({1, 1, 4}, new float[4]{2, 0, 2, 0});
+
+    // Operation
+    auto *pd = new PoolDescriptor({1, 3}, {1, 1}, "same");
+    pd->build(t_seq);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+    pd->indX = new Tensor(pd->O->getShape());
+    pd->indY = new Tensor(pd->O->getShape());
+
+    // Forward
+    MPool1D(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    MPool1D_back(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
+}
+
+
+TEST(MaxPoolTestSuite, mpool_k2x2_s2x2_pad_same_negative)
+{
+    // Padded positions are not part of the max, even when all values are negative
+    auto *ptr_img = new float[3*3]{-1, -2, -3,
+                                   -4, -5, -6,
+                                   -7, -8, -9};
+    auto* t_image = new Tensor({1, 1, 3, 3}, ptr_img);
+
+    auto *ptr_fwrd = new float[2*2]{-1, -3,
+                                    -7, -9};
+    auto* t_fwrd = new Tensor({1, 1, 2, 2}, ptr_fwrd);
+
+    auto *ptr_bwrd = new float[3*3]{1, 0, 1,
+                                    0, 0, 0,
+                                    1, 0, 1};
+    auto* t_bwrd = new Tensor({1, 1, 3, 3}, ptr_bwrd);
+
+    auto *pd = new PoolDescriptor({2, 2}, {2, 2}, "same");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    MPool2D(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_fwrd, pd->O, 10e-5f));
+
+    MPool2D_back(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
+}
+
+
+TEST(MaxPoolTestSuite, mpool_global)
+{
+    Tensor* t_image = Tensor::randn({2, 3, 5, 7});
+
+    auto *pd = new PoolDescriptor({5, 7}, {1, 1}, "none");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    MPool2D(pd);
+    MPool2D_back(pd);
+    for (int p = 0; p < 6; p++) {
+        float *plane = t_image->ptr + p * 35;
+        int arg = (int)(std::max_element(plane, plane + 35) - plane);
+        ASSERT_FLOAT_EQ(pd->O->ptr[p], plane[arg]);
+        ASSERT_FLOAT_EQ(pd->ID->ptr[p * 35 + arg], 1.0f);
+    }
+    ASSERT_FLOAT_EQ(pd->ID->sum(), 6.0f);
+}
+
+
+TEST(MaxPoolTestSuite, mpool_pad_larger_than_kernel)
+{
+    // Windows lying entirely in the padding output 0 and take no gradient
+    auto* t_image = new Tensor({1, 1, 2, 2}, new float[4]{1, 2,
+                                                         3, 4});
+    auto* t_fwrd = new Tensor({1, 1, 3, 3}, new float[9]{0, 0, 0,
+                                                        0, 4, 0,
+                                                        0, 0, 0});
+    auto* t_bwrd = new Tensor({1, 1, 2, 2}, new float[4]{0, 0,
+                                                        0, 1});
+
+    auto *pd = new PoolDescriptor({2, 2}, {2, 2}, vector<int>{2, 2, 2, 2});
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    MPool2D(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_fwrd, pd->O, 10e-5f));
+
+    MPool2D_back(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
+}
+
+
+TEST(MaxPoolTestSuite, mpool1D_pad_larger_than_kernel)
+{
+    auto* t_seq = new Tensor({1, 1, 3}, new float[3]{5, 1, 2});
+    auto* t_fwrd = new Tensor({1, 1, 4}, new float[4]{0, 5, 2, 0});
+    auto* t_bwrd = new Tensor({1, 1, 3}, new float[3]{1, 0, 1});
+
+    auto *pd = new PoolDescriptor({1, 2}, {1, 2}, vector<int>{0, 0, 2, 3});
+    pd->build(t_seq);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    MPool1D(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_fwrd, pd->O, 10e-5f));
+
+    MPool1D_back(pd);
+    ASSERT_TRUE((bool)Tensor::equal2(t_bwrd, pd->ID, 10e-5f));
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/descriptors/descriptors.h"
+
+
+// Materializes the whole attention matrix, one head at a time
+static void naive_attention(AttentionDescriptor *D, Tensor *O) {
+    int hd = D->heads * D->head_dim;
+    for (int b = 0; b < D->batch; b++)
+    for (int h = 0; h < D->heads; h++)
+    for (int i = 0; i < D->lq; i++) {
+        std::vector<float> s(D->lk);
+        float mx = -1e30f, sum = 0.0f;
+        int nk = D->causal ? i + 1 : D->lk;
+        for (int j = 0; j < nk; j++) {
+            s[j] = 0.0f;
+            for (int d = 0; d < D->head_dim; d++)
+                s[j] += D->Q->ptr[(b * D->lq + i) * hd + h * D->head_dim + d] * D->K->ptr[(b * D->lk + j) * hd + h * D->head_dim + d];
+            s[j] *= D->scale;
+            mx = std::max(mx, s[j]);
+        }
+        for (int j = 0; j < nk; j++) { s[j] = std::exp(s[j] - mx); sum += s[j]; }
+        for (int d = 0; d < D->head_dim; d++) {
+            float acc = 0.0f;
+            for (int j = 0; j < nk; j++) acc += s[j] * D->V->ptr[(b * D->lk + j) * hd + h * D->head_dim + d];
+            O->ptr[(b * D->lq + i) * hd + h * D->head_dim + d] = acc / sum;
+        }
+    }
+}
+
+TEST(TensorTestSuite, tensor_attention_matches_naive)
+{
+    for (int causal = 0; causal < 2; causal++) {
+        int lk = causal ? 70 : 130;
+        AttentionDescriptor *D = new AttentionDescriptor(3, 8, causal);
+        D->tile = 16;  // several partial tiles
+        D->build(2, 70, lk, DEV_CPU);
+        D->Q->rand_normal(0.0f, 1.0f);
+        D->K->rand_normal(0.0f, 1.0f);
+        D->V->rand_normal(0.0f, 1.0f);
+
+        Attention(D);
+        Tensor *ref = new Tensor(D->O->shape);
+        naive_attention(D, ref);
+        ASSERT_TRUE(Tensor::allclose(D->O, ref, 1e-4f, 1e-5f));
+
+        delete ref;
+        delete D;
+    }
+}
+
+TEST(TensorTestSuite, tensor_attention_grad_matches_numerical)
+{
+    // loss = sum(O .* G), so dO = G
+    AttentionDescriptor *D = new AttentionDescriptor(2, 4, true);
+    D->tile = 4;
+    D->build(1, 10, 10, DEV_CPU);
+    D->Q->rand_normal(0.0f, 1.0f);
+    D->K->rand_normal(0.0f, 1.0f);
+    D->V->rand_normal(0.0f, 1.0f);
+    D->dO->rand_normal(0.0f, 1.0f);
+
+    Attention(D);
+    D_Attention(D);
+
+    const float eps = 1e-2f;
+    Tensor *inputs[3] = {D->Q, D->K, D->V};
+    Tensor *grads[3] = {D->dQ, D->dK, D->dV};
+    for (int t = 0; t < 3; t++)
+    for (int i = 0; i < inputs[t]->size; i += 7) {
+        float x = inputs[t]->ptr[i];
+        float f[2];
+        for (int s = 0; s < 2; s++) {
+            inputs[t]->ptr[i] = x + (s ? -eps : eps);
+            Attention(D);
+            f[s] = 0.0f;
+            for (int j = 0; j < D->O->size; j++) f[s] += D->O->ptr[j] * D->dO->ptr[j];
+        }
+        inputs[t]->ptr[i] = x;
+        ASSERT_NEAR(grads[t]->ptr[i], (f[0] - f[1]) / (2 * eps), 5e-3f);
+    }
+
+    delete D;
+}
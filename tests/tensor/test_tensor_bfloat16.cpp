@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/tensor/tensor.h"
+
+
+using namespace std;
+
+
+TEST(TensorTestSuite, tensor_round_bfloat16)
+{
+    // bfloat16 keeps 7 explicit mantissa bits
+    float eps = std::pow(2.0f, -7);
+    Tensor* t = new Tensor({6});
+    t->ptr[0] = 1.0f + eps;             // Representable
+    t->ptr[1] = 1.0f + eps/2.0f;        // Tie => even (1.0)
+    t->ptr[2] = 1.0f + 3.0f*eps/2.0f;   // Tie => even (1.0 + 2*eps)
+    t->ptr[3] = 1.0f + 0.75f*eps;       // Nearest (1.0 + eps)
+    t->ptr[4] = -3.0f;
+    t->ptr[5] = NAN;
+
+    t->round_bfloat16_();
+
+    ASSERT_EQ(t->ptr[0], 1.0f + eps);
+    ASSERT_EQ(t->ptr[1], 1.0f);
+    ASSERT_EQ(t->ptr[2], 1.0f + 2.0f*eps);
+    ASSERT_EQ(t->ptr[3], 1.0f + eps);
+    ASSERT_EQ(t->ptr[4], -3.0f);
+    ASSERT_TRUE(std::isnan(t->ptr[5]));
+
+    delete t;
+}
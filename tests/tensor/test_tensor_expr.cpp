@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/tensor_expr.h"
+
+
+// Several blocks plus a partial one
+TEST(TensorTestSuite, tensor_expr_matches_ops)
+{
+    Tensor *A = Tensor::randn({50, 51});
+    Tensor *B = Tensor::randn({50, 51});
+    Tensor *C = new Tensor({50, 51});
+
+    Tensor::eval(C, sqrt(abs(Expr(A) * 2.0f - Expr(B))) / (1.0f + sqr(Expr(B))) - exp(-Expr(A)));
+
+    for (int i = 0; i < A->size; i++) {
+        float a = A->ptr[i], b = B->ptr[i];
+        ASSERT_NEAR(C->ptr[i], std::sqrt(std::fabs(a * 2.0f - b)) / (1.0f + b * b) - std::exp(-a), 1e-4);
+    }
+
+    float s = Tensor::eval_sum(sqr(Expr(A) - Expr(B)));
+    double ref = 0.0;
+    for (int i = 0; i < A->size; i++) ref += (A->ptr[i] - B->ptr[i]) * (A->ptr[i] - B->ptr[i]);
+    ASSERT_NEAR(s, ref, 1e-3 * ref);
+
+    delete A;
+    delete B;
+    delete C;
+}
+
+// Later statements read the values written by the former ones
+TEST(TensorTestSuite, tensor_expr_statements_in_order)
+{
+    Tensor *M = Tensor::randn({1000});
+    Tensor *G = Tensor::randn({1000});
+    Tensor *W = Tensor::randn({1000});
+    Tensor *M0 = M->clone();
+    Tensor *W0 = W->clone();
+
+    Tensor::eval({M, W}, {0.9f * Expr(M) + 0.1f * Expr(G), Expr(W) - 0.5f * Expr(M)});
+
+    for (int i = 0; i < M->size; i++) {
+        float m = 0.9f * M0->ptr[i] + 0.1f * G->ptr[i];
+        ASSERT_NEAR(M->ptr[i], m, 1e-5);
+        ASSERT_NEAR(W->ptr[i], W0->ptr[i] - 0.5f * m, 1e-5);
+    }
+
+    delete M; delete G; delete W; delete M0; delete W0;
+}
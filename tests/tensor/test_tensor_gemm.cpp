@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <algorithm>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+
+
+TEST(TensorTestSuite, tensor_gemm_matches_mult2D)
+{
+    Tensor* A = Tensor::randn({7, 5});
+    Tensor* At = Tensor::randn({5, 7});
+    Tensor* B = Tensor::randn({5, 300});
+    Tensor* Bt = Tensor::randn({300, 5});
+    Tensor* bias = Tensor::randn({300});
+    Tensor* C0 = Tensor::randn({7, 300});
+
+    for (int tA = 0; tA < 2; tA++)
+    for (int tB = 0; tB < 2; tB++) {
+        Tensor* a = tA ? At : A;
+        Tensor* b = tB ? Bt : B;
+
+        // ref = sigmoid(0.5*op(A)*op(B) + 2*C0 + bias)
+        Tensor* ref = new Tensor({7, 300});
+        Tensor::mult2D(a, tA, b, tB, ref, 0);
+        ref->mult_(0.5f);
+        Tensor* c = C0->clone();
+        c->mult_(2.0f);
+        Tensor::inc(c, ref);
+        Tensor::sum2D_rowwise(ref, bias, ref);
+        Sigmoid(ref, ref);
+
+        Tensor* C = C0->clone();
+        Tensor::gemm(0.5f, a, tA, b, tB, 2.0f, C, bias, GEMM_ACT_SIGMOID);
+        ASSERT_TRUE(Tensor::allclose(C, ref, 1e-5f, 1e-5f));
+
+        // Plain product (beta=0, no epilogue)
+        Tensor::gemm(1.0f, a, tA, b, tB, 0.0f, C);
+        Tensor::mult2D(a, tA, b, tB, ref, 0);
+        ASSERT_TRUE(Tensor::allclose(C, ref, 1e-5f, 1e-5f));
+
+        delete ref;
+        delete c;
+        delete C;
+    }
+
+    delete A;
+    delete At;
+    delete B;
+    delete Bt;
+    delete bias;
+    delete C0;
+}
+
+TEST(TensorTestSuite, tensor_batched_mult2D_matches_mult2D)
+{
+    Tensor* A = Tensor::randn({2, 3, 4, 5});
+    Tensor* B = Tensor::randn({2, 3, 6, 5});
+    Tensor* C = new Tensor({2, 3, 4, 6});
+
+    // C[i] = A[i] * B[i]^T
+    Tensor::batched_mult2D(A, 0, B, 1, C, 0);
+
+    Tensor* a = new Tensor({4, 5});
+    Tensor* b = new Tensor({6, 5});
+    Tensor* c = new Tensor({4, 6});
+    for (int i = 0; i < 6; i++) {
+        std::copy(A->ptr + i * 20, A->ptr + (i + 1) * 20, a->ptr);
+        std::copy(B->ptr + i * 30, B->ptr + (i + 1) * 30, b->ptr);
+        Tensor::mult2D(a, 0, b, 1, c, 0);
+        for (int j = 0; j < 24; j++) ASSERT_NEAR(C->ptr[i * 24 + j], c->ptr[j], 1e-5f);
+    }
+
+    delete A;
+    delete B;
+    delete C;
+    delete a;
+    delete b;
+    delete c;
+}
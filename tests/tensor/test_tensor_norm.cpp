@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+
+
+// GroupNorm over {2,6,3,3} with 3 groups, channel-wise affine
+TEST(TensorTestSuite, tensor_groupnorm_matches_naive)
+{
+    int b = 2, z = 6, hw = 9, g = 3, cpg = z / g;
+    Tensor *A = Tensor::randn({b, z, 3, 3});
+    Tensor *B = new Tensor({b, z, 3, 3});
+    Tensor *opa = new Tensor({b, z, 3, 3});
+    Tensor *mean = new Tensor({b * g});
+    Tensor *sd = new Tensor({b * g});
+    Tensor *gamma = Tensor::randn({cpg});
+    Tensor *beta = Tensor::randn({cpg});
+
+    LayerNorm(A, B, opa, mean, sd, gamma, beta, b * g, 1e-5f);
+
+    int n = cpg * hw;
+    for (int r = 0; r < b * g; r++) {
+        float *x = A->ptr + r * n;
+        double mu = 0.0, var = 0.0;
+        for (int j = 0; j < n; j++) mu += x[j];
+        mu /= n;
+        for (int j = 0; j < n; j++) var += (x[j] - mu) * (x[j] - mu);
+        var /= n;
+        for (int j = 0; j < n; j++) {
+            double ref = gamma->ptr[j / hw] * (x[j] - mu) / std::sqrt(var + 1e-5) + beta->ptr[j / hw];
+            ASSERT_NEAR(B->ptr[r * n + j], ref, 1e-4);
+        }
+    }
+
+    delete A; delete B; delete opa; delete mean; delete sd; delete gamma; delete beta;
+}
+
+// Checks the fused backward against central differences of E = sum(W*Y)
+TEST(TensorTestSuite, tensor_layernorm_backward_numerical)
+{
+    int b = 3, d = 7;
+    Tensor *A = Tensor::randn({b, d});
+    Tensor *W = Tensor::randn({b, d});
+    Tensor *Y = new Tensor({b, d});
+    Tensor *opa = new Tensor({b, d});
+    Tensor *mean = new Tensor({b});
+    Tensor *sd = new Tensor({b});
+    Tensor *gamma = Tensor::randn({d});
+    Tensor *beta = Tensor::randn({d});
+    Tensor *gg = Tensor::zeros({d});
+    Tensor *gb = Tensor::zeros({d});
+    Tensor *PD = Tensor::zeros({b, d});
+
+    auto energy = [&]() {
+        LayerNorm(A, Y, opa, mean, sd, gamma, beta, b, 1e-5f);
+        double e = 0.0;
+        for (int i = 0; i < Y->size; i++) e += W->ptr[i] * Y->ptr[i];
+        return e;
+    };
+
+    energy();
+    D_LayerNorm(W, opa, sd, gamma, gg, gb, PD, b);
+
+    float h = 1e-2f;
+    for (int i = 0; i < A->size; i++) {
+        float x = A->ptr[i];
+        A->ptr[i] = x + h; double ep = energy();
+        A->ptr[i] = x - h; double em = energy();
+        A->ptr[i] = x;
+        ASSERT_NEAR(PD->ptr[i], (ep - em) / (2 * h), 2e-2);
+    }
+
+    // gamma/beta gradients are averaged over the batch
+    energy();
+    for (int j = 0; j < d; j++) {
+        double sg = 0.0, sb = 0.0;
+        for (int r = 0; r < b; r++) { sg += W->ptr[r * d + j] * opa->ptr[r * d + j]; sb += W->ptr[r * d + j]; }
+        ASSERT_NEAR(gg->ptr[j], sg / b, 1e-4);
+        ASSERT_NEAR(gb->ptr[j], sb / b, 1e-4);
+    }
+
+    delete A; delete W; delete Y; delete opa; delete mean; delete sd;
+    delete gamma; delete beta; delete gg; delete gb; delete PD;
+}